@@ -127,7 +127,12 @@ bool ResourceLoader::has_cached(const String &p_path) {
 
 Ref<Resource> ResourceLoader::get_cached_ref(const String &p_path) {
 	String local_path = ::ResourceLoader::_validate_local_path(p_path);
-	return ResourceCache::get_ref(local_path);
+	Ref<Resource> res = ResourceCache::get_ref(local_path);
+	if (res.is_valid()) {
+		res->materialize();
+	}
+	ResourceCache::touch(res);
+	return res;
 }
 
 bool ResourceLoader::exists(const String &p_path, const String &p_type_hint) {
@@ -146,6 +151,35 @@ Vector<String> ResourceLoader::list_directory(const String &p_directory) {
 	return ::ResourceLoader::list_directory(p_directory);
 }
 
+void ResourceLoader::set_lazy_subresource_loading(const String &p_path, bool p_enabled) {
+	String local_path = ::ResourceLoader::_validate_local_path(p_path);
+	::ResourceLoader::set_lazy_subresource_loading(local_path, p_enabled);
+}
+
+bool ResourceLoader::is_lazy_subresource_loading(const String &p_path) {
+	String local_path = ::ResourceLoader::_validate_local_path(p_path);
+	return ::ResourceLoader::is_lazy_subresource_loading(local_path);
+}
+
+void ResourceLoader::set_streaming_budget(int64_t p_bytes) {
+	ERR_FAIL_COND_MSG(p_bytes < 0, "The streaming budget can't be negative.");
+	ResourceCache::set_streaming_budget(p_bytes);
+}
+
+int64_t ResourceLoader::get_streaming_budget() const {
+	return ResourceCache::get_streaming_budget();
+}
+
+void ResourceLoader::set_streamable(const String &p_path, bool p_streamable) {
+	String local_path = ::ResourceLoader::_validate_local_path(p_path);
+	ResourceCache::set_streamable(local_path, p_streamable);
+}
+
+bool ResourceLoader::is_streamable(const String &p_path) {
+	String local_path = ::ResourceLoader::_validate_local_path(p_path);
+	return ResourceCache::is_streamable(local_path);
+}
+
 void ResourceLoader::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("load_threaded_request", "path", "type_hint", "use_sub_threads", "cache_mode"), &ResourceLoader::load_threaded_request, DEFVAL(""), DEFVAL(false), DEFVAL(CACHE_MODE_REUSE));
 	ClassDB::bind_method(D_METHOD("load_threaded_get_status", "path", "progress"), &ResourceLoader::load_threaded_get_status, DEFVAL_ARRAY);
@@ -164,6 +198,14 @@ void ResourceLoader::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_resource_type", "path"), &ResourceLoader::get_resource_type);
 	ClassDB::bind_method(D_METHOD("list_directory", "directory_path"), &ResourceLoader::list_directory);
 
+	ClassDB::bind_method(D_METHOD("set_lazy_subresource_loading", "path", "enabled"), &ResourceLoader::set_lazy_subresource_loading);
+	ClassDB::bind_method(D_METHOD("is_lazy_subresource_loading", "path"), &ResourceLoader::is_lazy_subresource_loading);
+
+	ClassDB::bind_method(D_METHOD("set_streaming_budget", "bytes"), &ResourceLoader::set_streaming_budget);
+	ClassDB::bind_method(D_METHOD("get_streaming_budget"), &ResourceLoader::get_streaming_budget);
+	ClassDB::bind_method(D_METHOD("set_streamable", "path", "streamable"), &ResourceLoader::set_streamable);
+	ClassDB::bind_method(D_METHOD("is_streamable", "path"), &ResourceLoader::is_streamable);
+
 	BIND_ENUM_CONSTANT(THREAD_LOAD_INVALID_RESOURCE);
 	BIND_ENUM_CONSTANT(THREAD_LOAD_IN_PROGRESS);
 	BIND_ENUM_CONSTANT(THREAD_LOAD_FAILED);
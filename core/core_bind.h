@@ -86,6 +86,14 @@ public:
 	ResourceUID::ID get_resource_uid(const String &p_path);
 	String get_resource_type(const String &p_path);
 
+	void set_lazy_subresource_loading(const String &p_path, bool p_enabled);
+	bool is_lazy_subresource_loading(const String &p_path);
+
+	void set_streaming_budget(int64_t p_bytes);
+	int64_t get_streaming_budget() const;
+	void set_streamable(const String &p_path, bool p_streamable);
+	bool is_streamable(const String &p_path);
+
 	Vector<String> list_directory(const String &p_directory);
 
 	ResourceLoader() { singleton = this; }
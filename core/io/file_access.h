@@ -35,6 +35,7 @@
 #include "core/object/ref_counted.h"
 #include "core/os/memory.h"
 #include "core/string/ustring.h"
+#include "core/templates/span.h"
 #include "core/typedefs.h"
 #include "core/variant/type_info.h"
 
@@ -190,6 +191,8 @@ public:
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const = 0; ///< get an array of bytes, needs to be overwritten by children.
 	Vector<uint8_t> get_buffer(int64_t p_length) const;
+	virtual Span<uint8_t> get_mapped_data() const { return Span<uint8_t>(); } ///< the whole file, memory-mapped read-only, or empty if not supported. Valid until the file is closed.
+	virtual const uint8_t *get_buffer_view(uint64_t p_length) const { return nullptr; } ///< zero-copy read: returns the next p_length bytes and advances, or nullptr (position unchanged) if the data isn't memory-mapped, use get_buffer() then.
 	virtual String get_line() const;
 	virtual String get_token() const;
 	virtual Vector<String> get_csv_line(const String &p_delim = ",") const;
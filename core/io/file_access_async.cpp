@@ -0,0 +1,258 @@
+/**************************************************************************/
+/*  file_access_async.cpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "file_access_async.h"
+
+#include "core/config/project_settings.h"
+#include "core/io/file_access.h"
+#include "core/io/file_access_pack.h"
+
+void FileAccessAsync::_finish_read(Read *p_read, Error p_error) {
+	MutexLock lock(mutex);
+
+	if (p_read->discard) {
+		// Nobody waits for prefetches.
+		memdelete(p_read);
+		return;
+	}
+
+	p_read->error = p_error;
+	p_read->completed = true;
+	read_completed.notify_all();
+}
+
+bool FileAccessAsync::_get_os_file_range(const String &p_path, uint64_t p_offset, int64_t p_length, OSFileRange &r_range) {
+	PackedData *packed_data = PackedData::get_singleton();
+	if (packed_data && !packed_data->is_disabled() && packed_data->has_path(p_path)) {
+		String pack_path;
+		uint64_t file_offset = 0;
+		uint64_t file_size = 0;
+		if (!packed_data->get_file_location(p_path, pack_path, file_offset, file_size) || p_offset > file_size) {
+			return false; // Needs to be read through FileAccess.
+		}
+
+		r_range.path = ProjectSettings::get_singleton()->globalize_path(pack_path);
+		r_range.offset = file_offset + p_offset;
+		r_range.length = file_size - p_offset;
+		if (p_length >= 0) {
+			r_range.length = MIN(p_length, r_range.length);
+		}
+	} else {
+		r_range.path = ProjectSettings::get_singleton()->globalize_path(p_path);
+		r_range.offset = p_offset;
+		r_range.length = p_length;
+	}
+
+	return r_range.path.is_absolute_path() && !r_range.path.contains("://");
+}
+
+Error FileAccessAsync::_read_file(Read *p_read) {
+	Error err = OK;
+	Ref<FileAccess> f = FileAccess::open(p_read->path, FileAccess::READ, &err);
+	if (f.is_null()) {
+		return err;
+	}
+
+	const uint64_t file_length = f->get_length();
+	if (p_read->offset > file_length) {
+		return ERR_FILE_EOF;
+	}
+
+	uint64_t length = file_length - p_read->offset;
+	if (p_read->length >= 0) {
+		length = MIN(uint64_t(p_read->length), length);
+	}
+	f->seek(p_read->offset);
+
+	if (p_read->discard) {
+		uint8_t buffer[16384];
+		while (length > 0) {
+			uint64_t read = f->get_buffer(buffer, MIN(length, sizeof(buffer)));
+			if (read == 0) {
+				break;
+			}
+			length -= read;
+		}
+		return OK;
+	}
+
+	err = p_read->data.resize(length);
+	if (err) {
+		return err;
+	}
+	uint64_t read = f->get_buffer(p_read->data.ptrw(), length);
+	if (read < length) {
+		p_read->data.resize(read);
+	}
+	return OK;
+}
+
+void FileAccessAsync::_io_thread_func(void *p_self) {
+	FileAccessAsync *self = (FileAccessAsync *)p_self;
+
+	while (true) {
+		self->queue_semaphore.wait();
+
+		Read *read = nullptr;
+		{
+			MutexLock lock(self->mutex);
+			if (self->exiting) {
+				return;
+			}
+			if (self->queue.is_empty()) {
+				continue;
+			}
+			read = self->queue.front()->get();
+			self->queue.pop_front();
+		}
+
+		Error err = _read_file(read);
+		self->_finish_read(read, err);
+	}
+}
+
+void FileAccessAsync::_submit(Read *p_read) {
+	if (_submit_native(p_read)) {
+		return;
+	}
+
+#ifdef THREADS_ENABLED
+	MutexLock lock(mutex);
+	if (!io_threads_started) {
+		for (Thread &thread : io_threads) {
+			thread.start(&FileAccessAsync::_io_thread_func, this);
+		}
+		io_threads_started = true;
+	}
+	queue.push_back(p_read);
+	queue_semaphore.post();
+#else
+	Error err = _read_file(p_read);
+	_finish_read(p_read, err);
+#endif
+}
+
+FileAccessAsync *FileAccessAsync::create() {
+	if (_create) {
+		return _create();
+	}
+	return memnew(FileAccessAsync);
+}
+
+FileAccessAsync::ReadID FileAccessAsync::read(const String &p_path, uint64_t p_offset, int64_t p_length) {
+	Read *read = memnew(Read);
+	read->path = p_path;
+	read->offset = p_offset;
+	read->length = p_length;
+
+	ReadID id;
+	{
+		MutexLock lock(mutex);
+		id = ++last_read_id;
+		reads.insert(id, read);
+	}
+
+	_submit(read);
+	return id;
+}
+
+void FileAccessAsync::prefetch(const String &p_path) {
+	Read *read = memnew(Read);
+	read->path = p_path;
+	read->discard = true;
+	_submit(read);
+}
+
+bool FileAccessAsync::is_read_completed(ReadID p_id) {
+	MutexLock lock(mutex);
+	Read **read = reads.getptr(p_id);
+	ERR_FAIL_NULL_V_MSG(read, false, "Invalid or already released read ID.");
+	return (*read)->completed;
+}
+
+Error FileAccessAsync::wait_for_read(ReadID p_id, Vector<uint8_t> *r_data) {
+	Read *read = nullptr;
+	{
+		MutexLock lock(mutex);
+		Read **read_ptr = reads.getptr(p_id);
+		ERR_FAIL_NULL_V_MSG(read_ptr, ERR_INVALID_PARAMETER, "Invalid or already released read ID.");
+		read = *read_ptr;
+		while (!read->completed) {
+			read_completed.wait(lock);
+		}
+		reads.erase(p_id);
+	}
+
+	Error err = read->error;
+	if (r_data) {
+		*r_data = read->data;
+	}
+	memdelete(read);
+	return err;
+}
+
+FileAccessAsync::FileAccessAsync() {
+	singleton = this;
+}
+
+FileAccessAsync::~FileAccessAsync() {
+	{
+		MutexLock lock(mutex);
+		exiting = true;
+	}
+
+	if (io_threads_started) {
+		queue_semaphore.post(IO_THREAD_COUNT);
+		for (Thread &thread : io_threads) {
+			thread.wait_to_finish();
+		}
+	}
+
+	// The I/O threads finish the read they are on before exiting, the ones still queued are cancelled.
+	// Native backends have completed theirs in their destructor, so every tracked read can be freed.
+	for (Read *read : queue) {
+		if (read->discard) {
+			memdelete(read);
+		} else {
+			read->error = ERR_UNAVAILABLE;
+			read->completed = true;
+		}
+	}
+	queue.clear();
+	for (const KeyValue<ReadID, Read *> &E : reads) {
+		DEV_ASSERT(E.value->completed);
+		memdelete(E.value);
+	}
+	reads.clear();
+
+	if (singleton == this) {
+		singleton = nullptr;
+	}
+}
@@ -0,0 +1,108 @@
+/**************************************************************************/
+/*  file_access_async.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/os/condition_variable.h"
+#include "core/os/mutex.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
+#include "core/string/ustring.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/list.h"
+
+// Asynchronous file reads. Many reads can be submitted at once, then polled or waited for.
+// By default, reads are done through FileAccess by a few dedicated I/O threads. Platforms
+// can provide a native backend for the files it can read directly from the host filesystem.
+class FileAccessAsync {
+public:
+	typedef int64_t ReadID;
+	static constexpr ReadID INVALID_READ_ID = -1;
+
+protected:
+	struct Read {
+		String path;
+		uint64_t offset = 0;
+		int64_t length = -1; // Until the end of the file.
+		bool discard = false; // Prefetch, the data is only read to get it cached by the OS.
+		Vector<uint8_t> data;
+		Error error = OK;
+		bool completed = false;
+	};
+
+	// A read resolved to a range of a host filesystem file.
+	struct OSFileRange {
+		String path;
+		uint64_t offset = 0;
+		int64_t length = -1;
+	};
+
+	static inline FileAccessAsync *(*_create)() = nullptr;
+
+	// Returns `true` if the backend took the read, it must then call `_finish_read()` once done.
+	// Reads taken by the backend must all be finished by the time its destructor returns.
+	virtual bool _submit_native(Read *p_read) { return false; }
+	void _finish_read(Read *p_read, Error p_error);
+	static bool _get_os_file_range(const String &p_path, uint64_t p_offset, int64_t p_length, OSFileRange &r_range);
+
+private:
+	static inline FileAccessAsync *singleton = nullptr;
+
+	static constexpr int IO_THREAD_COUNT = 4;
+	Thread io_threads[IO_THREAD_COUNT];
+	bool io_threads_started = false;
+	bool exiting = false;
+	List<Read *> queue;
+	Semaphore queue_semaphore;
+
+	BinaryMutex mutex;
+	ConditionVariable read_completed;
+	HashMap<ReadID, Read *> reads;
+	ReadID last_read_id = 0;
+
+	static void _io_thread_func(void *p_self);
+	static Error _read_file(Read *p_read);
+	void _submit(Read *p_read);
+
+public:
+	static FileAccessAsync *get_singleton() { return singleton; }
+	static FileAccessAsync *create();
+
+	// Reads are clamped to the end of the file.
+	ReadID read(const String &p_path, uint64_t p_offset = 0, int64_t p_length = -1);
+	// Reads a file in the background without keeping its data, so that later reads hit the OS cache.
+	void prefetch(const String &p_path);
+	bool is_read_completed(ReadID p_id);
+	// Waits for the read to complete and releases it.
+	Error wait_for_read(ReadID p_id, Vector<uint8_t> *r_data = nullptr);
+
+	FileAccessAsync();
+	virtual ~FileAccessAsync();
+};
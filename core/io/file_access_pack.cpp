@@ -132,6 +132,36 @@ void PackedData::add_pack_source(PackSource *p_source) {
 	}
 }
 
+void PackedData::add_mapped_pack(const String &p_pkg_path, const Ref<FileAccess> &p_file) {
+	ERR_FAIL_COND(p_file.is_null() || p_file->get_mapped_data().is_empty());
+	mapped_packs[p_pkg_path] = p_file;
+}
+
+Ref<FileAccess> PackedData::get_mapped_pack(const String &p_pkg_path) const {
+	HashMap<String, Ref<FileAccess>>::ConstIterator E = mapped_packs.find(p_pkg_path);
+	if (!E) {
+		return Ref<FileAccess>();
+	}
+	return E->value;
+}
+
+bool PackedData::get_file_location(const String &p_path, String &r_pkg_path, uint64_t &r_offset, uint64_t &r_size) {
+	HashMap<PathMD5, PackedFile, PathMD5>::Iterator E = files.find(_get_simplified_path(p_path));
+	if (!E) {
+		return false;
+	}
+
+	const PackedFile &pf = E->value;
+	if (pf.offset == 0 || pf.encrypted || pf.bundle || !pf.src || !pf.src->has_raw_files() || has_delta_patches(p_path)) {
+		return false;
+	}
+
+	r_pkg_path = pf.pack;
+	r_offset = pf.offset;
+	r_size = pf.size;
+	return true;
+}
+
 uint8_t *PackedData::get_file_hash(const String &p_path) {
 	String simplified_path = p_path.simplify_path().trim_prefix("res://");
 	PathMD5 pmd5(simplified_path.md5_buffer());
@@ -184,6 +214,7 @@ void PackedData::_get_file_paths(PackedDir *p_dir, const String &p_parent_dir, H
 void PackedData::clear() {
 	files.clear();
 	delta_patches.clear();
+	mapped_packs.clear();
 	_free_packed_dirs(root);
 	root = memnew(PackedDir);
 }
@@ -324,6 +355,10 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 
 	// Read directory.
 	int file_count = f->get_32();
+
+	// Kept to register the memory mapping once the directory has been validated.
+	Ref<FileAccess> pack_file = f;
+
 	if (enc_directory) {
 		Ref<FileAccessEncrypted> fae;
 		fae.instantiate();
@@ -349,24 +384,46 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		f = fae;
 	}
 
-	for (int i = 0; i < file_count; i++) {
+	struct DirEntry {
+		String path;
+		uint64_t ofs = 0;
+		uint64_t size = 0;
+		uint8_t md5[16] = {};
+		uint32_t flags = 0;
+	};
+
+	// The whole directory is read and validated before anything is registered, so a truncated
+	// or corrupt pack leaves no partial state behind.
+	constexpr uint64_t MIN_ENTRY_SIZE = 4 + 8 + 8 + 16 + 4; // Path length, offset, size, MD5 and flags.
+	ERR_FAIL_COND_V_MSG(file_count < 0 || f->eof_reached() || uint64_t(file_count) > (f->get_length() - f->get_position()) / MIN_ENTRY_SIZE, false, vformat("Invalid pack directory in \"%s\".", p_path));
+	LocalVector<DirEntry> entries;
+	entries.resize(file_count);
+	for (DirEntry &entry : entries) {
 		uint32_t sl = f->get_32();
+		ERR_FAIL_COND_V_MSG(f->eof_reached() || sl > f->get_length() - f->get_position(), false, vformat("Invalid pack directory in \"%s\".", p_path));
 		CharString cs;
 		cs.resize_uninitialized(sl + 1);
 		f->get_buffer((uint8_t *)cs.ptr(), sl);
 		cs[sl] = 0;
 
-		String path = String::utf8(cs.ptr(), sl);
-		uint64_t ofs = f->get_64();
-		uint64_t size = f->get_64();
-		uint8_t md5[16];
-		f->get_buffer(md5, 16);
-		uint32_t flags = f->get_32();
+		entry.path = String::utf8(cs.ptr(), sl);
+		entry.ofs = f->get_64();
+		entry.size = f->get_64();
+		f->get_buffer(entry.md5, 16);
+		entry.flags = f->get_32();
+		ERR_FAIL_COND_V_MSG(f->eof_reached(), false, vformat("Invalid pack directory in \"%s\".", p_path));
+	}
+
+	// Map the whole pack once, so its files are read from memory instead of opening the pack for each of them.
+	if (!sparse_bundle && !pack_file->get_mapped_data().is_empty()) {
+		PackedData::get_singleton()->add_mapped_pack(p_path, pack_file);
+	}
 
-		if (flags & PACK_FILE_REMOVAL) { // The file was removed.
-			PackedData::get_singleton()->remove_path(path);
+	for (const DirEntry &entry : entries) {
+		if (entry.flags & PACK_FILE_REMOVAL) { // The file was removed.
+			PackedData::get_singleton()->remove_path(entry.path);
 		} else {
-			PackedData::get_singleton()->add_path(p_path, path, file_base + ofs, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED), sparse_bundle, (flags & PACK_FILE_DELTA), salt);
+			PackedData::get_singleton()->add_path(p_path, entry.path, file_base + entry.ofs, entry.size, entry.md5, this, p_replace_files, (entry.flags & PACK_FILE_ENCRYPTED), sparse_bundle, (entry.flags & PACK_FILE_DELTA), salt);
 		}
 	}
 
@@ -433,7 +490,9 @@ Error FileAccessPack::open_internal(const String &p_path, int p_mode_flags) {
 }
 
 bool FileAccessPack::is_open() const {
-	if (f.is_valid()) {
+	if (mapped) {
+		return true;
+	} else if (f.is_valid()) {
 		return f->is_open();
 	} else {
 		return false;
@@ -441,7 +500,7 @@ bool FileAccessPack::is_open() const {
 }
 
 void FileAccessPack::seek(uint64_t p_position) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(!mapped && f.is_null(), "File must be opened before use.");
 
 	if (p_position > pf.size) {
 		eof = true;
@@ -449,7 +508,9 @@ void FileAccessPack::seek(uint64_t p_position) {
 		eof = false;
 	}
 
-	f->seek(off + p_position);
+	if (!mapped) {
+		f->seek(off + p_position);
+	}
 	pos = p_position;
 }
 
@@ -470,7 +531,7 @@ bool FileAccessPack::eof_reached() const {
 }
 
 uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
-	ERR_FAIL_COND_V_MSG(f.is_null(), -1, "File must be opened before use.");
+	ERR_FAIL_COND_V_MSG(!mapped && f.is_null(), -1, "File must be opened before use.");
 	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
 
 	if (eof) {
@@ -488,16 +549,36 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	if (to_read <= 0) {
 		return 0;
 	}
-	f->get_buffer(p_dst, to_read);
+	if (mapped) {
+		memcpy(p_dst, mapped + pos - to_read, to_read);
+	} else {
+		f->get_buffer(p_dst, to_read);
+	}
 
 	return to_read;
 }
 
+Span<uint8_t> FileAccessPack::get_mapped_data() const {
+	return Span<uint8_t>(mapped, mapped ? pf.size : 0);
+}
+
+const uint8_t *FileAccessPack::get_buffer_view(uint64_t p_length) const {
+	if (!mapped || eof || pos > pf.size || p_length > pf.size - pos) {
+		return nullptr;
+	}
+
+	const uint8_t *view = mapped + pos;
+	pos += p_length;
+	return view;
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(!mapped && f.is_null(), "File must be opened before use.");
 
 	FileAccess::set_big_endian(p_big_endian);
-	f->set_big_endian(p_big_endian);
+	if (f.is_valid()) {
+		f->set_big_endian(p_big_endian);
+	}
 }
 
 Error FileAccessPack::get_error() const {
@@ -521,6 +602,8 @@ bool FileAccessPack::file_exists(const String &p_name) {
 
 void FileAccessPack::close() {
 	f = Ref<FileAccess>();
+	mapped_pack = Ref<FileAccess>();
+	mapped = nullptr;
 }
 
 FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const Vector<uint8_t> &p_decryption_key) {
@@ -545,10 +628,21 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 		ERR_FAIL_COND_MSG(err != OK, vformat(R"(Can't open pack-referenced file "%s" from sparse pack "%s" due to error "%s".)", simplified_path, pf.pack, error_names[err]));
 		off = 0; // For the sparse pack offset is always zero.
 	} else {
-		Error err = OK;
-		f = FileAccess::open(pf.pack, FileAccess::READ, &err);
-		ERR_FAIL_COND_MSG(err != OK, vformat(R"(Can't open pack-referenced file "%s" from pack "%s" due to error "%s".)", p_path, pf.pack, error_names[err]));
-		f->seek(pf.offset);
+		if (!pf.encrypted) {
+			mapped_pack = PackedData::get_singleton()->get_mapped_pack(pf.pack);
+		}
+
+		if (mapped_pack.is_valid()) {
+			// Read straight from the memory-mapped pack.
+			Span<uint8_t> data = mapped_pack->get_mapped_data();
+			ERR_FAIL_COND_MSG(pf.offset > data.size() || pf.size > data.size() - pf.offset, vformat(R"(Pack-referenced file "%s" is out of the bounds of pack "%s".)", p_path, pf.pack));
+			mapped = data.ptr() + pf.offset;
+		} else {
+			Error err = OK;
+			f = FileAccess::open(pf.pack, FileAccess::READ, &err);
+			ERR_FAIL_COND_MSG(err != OK, vformat(R"(Can't open pack-referenced file "%s" from pack "%s" due to error "%s".)", p_path, pf.pack, error_names[err]));
+			f->seek(pf.offset);
+		}
 		off = pf.offset;
 	}
 
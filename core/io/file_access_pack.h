@@ -112,6 +112,9 @@ private:
 
 	Vector<PackSource *> sources;
 
+	// Pack files kept open with their contents memory-mapped, shared by the files read from them.
+	HashMap<String, Ref<FileAccess>> mapped_packs;
+
 	PackedDir *root = nullptr;
 
 	static inline PackedData *singleton = nullptr;
@@ -131,6 +134,9 @@ private:
 
 public:
 	void add_pack_source(PackSource *p_source);
+	void add_mapped_pack(const String &p_pkg_path, const Ref<FileAccess> &p_file); // for PackSource
+	Ref<FileAccess> get_mapped_pack(const String &p_pkg_path) const;
+	bool get_file_location(const String &p_path, String &r_pkg_path, uint64_t &r_offset, uint64_t &r_size);
 	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false, bool p_bundle = false, bool p_delta = false, const String &p_salt = String()); // for PackSource
 	void remove_path(const String &p_path);
 	uint8_t *get_file_hash(const String &p_path);
@@ -162,6 +168,8 @@ class PackSource {
 public:
 	virtual bool try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset, const Vector<uint8_t> &p_decryption_key = Vector<uint8_t>()) = 0;
 	virtual Ref<FileAccess> get_file(const String &p_path, PackedData::PackedFile *p_file, const Vector<uint8_t> &p_decryption_key = Vector<uint8_t>()) = 0;
+	// Whether files are stored as-is at their offset in the pack, so they can be read without opening them.
+	virtual bool has_raw_files() const { return false; }
 	virtual ~PackSource() {}
 };
 
@@ -169,6 +177,7 @@ class PackedSourcePCK : public PackSource {
 public:
 	virtual bool try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset, const Vector<uint8_t> &p_decryption_key = Vector<uint8_t>()) override;
 	virtual Ref<FileAccess> get_file(const String &p_path, PackedData::PackedFile *p_file, const Vector<uint8_t> &p_decryption_key = Vector<uint8_t>()) override;
+	virtual bool has_raw_files() const override { return true; }
 };
 
 class PackedSourceDirectory : public PackSource {
@@ -189,6 +198,11 @@ class FileAccessPack : public FileAccess {
 	uint64_t off;
 
 	Ref<FileAccess> f;
+
+	// When the pack is memory-mapped, the file is read from `mapped` instead of `f`.
+	Ref<FileAccess> mapped_pack;
+	const uint8_t *mapped = nullptr;
+
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override;
 	virtual uint64_t _get_modified_time(const String &p_file) override { return 0; }
 	virtual uint64_t _get_access_time(const String &p_file) override { return 0; }
@@ -215,6 +229,8 @@ public:
 	virtual bool eof_reached() const override;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual Span<uint8_t> get_mapped_data() const override;
+	virtual const uint8_t *get_buffer_view(uint64_t p_length) const override;
 
 	virtual void set_big_endian(bool p_big_endian) override;
 
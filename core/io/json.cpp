@@ -30,6 +30,7 @@
 
 #include "json.h"
 
+#include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/object/class_db.h"
 #include "core/object/script_language.h"
@@ -48,13 +49,116 @@ const char *JSON::tk_name[TK_MAX] = {
 	"EOF",
 };
 
-void JSON::_add_indent(String &r_result, const String &p_indent, int p_size) {
+// Writes UTF-8 directly for `JSON::stringify_utf8()`, without building a UTF-32 `String` first.
+class JSONUTF8Writer {
+	LocalVector<uint8_t> buffer;
+
+	_FORCE_INLINE_ void _append_char(char32_t p_char) {
+		if (p_char < 0x80) {
+			buffer.push_back(p_char);
+		} else if (p_char < 0x800) {
+			buffer.push_back(0xc0 | (p_char >> 6));
+			buffer.push_back(0x80 | (p_char & 0x3f));
+		} else if (p_char < 0x10000) {
+			buffer.push_back(0xe0 | (p_char >> 12));
+			buffer.push_back(0x80 | ((p_char >> 6) & 0x3f));
+			buffer.push_back(0x80 | (p_char & 0x3f));
+		} else if (p_char <= 0x10ffff) {
+			buffer.push_back(0xf0 | (p_char >> 18));
+			buffer.push_back(0x80 | ((p_char >> 12) & 0x3f));
+			buffer.push_back(0x80 | ((p_char >> 6) & 0x3f));
+			buffer.push_back(0x80 | (p_char & 0x3f));
+		} else {
+			_append_char(0xfffd);
+		}
+	}
+
+public:
+	void operator+=(char p_char) {
+		buffer.push_back(p_char);
+	}
+
+	void operator+=(const char *p_str) {
+		while (*p_str) {
+			buffer.push_back(*p_str++);
+		}
+	}
+
+	void operator+=(const String &p_str) {
+		const char32_t *src = p_str.ptr();
+		for (int i = 0; i < p_str.length(); i++) {
+			_append_char(src[i]);
+		}
+	}
+
+	void append_escaped(const String &p_str) {
+		const char32_t *src = p_str.ptr();
+		for (int i = 0; i < p_str.length(); i++) {
+			const char escape = _escape_char(src[i]);
+			if (escape) {
+				buffer.push_back('\\');
+				buffer.push_back(escape);
+			} else {
+				_append_char(src[i]);
+			}
+		}
+	}
+
+	// Same escapes as `String::json_escape()`.
+	static char _escape_char(char32_t p_char) {
+		switch (p_char) {
+			case '\\':
+				return '\\';
+			case '\b':
+				return 'b';
+			case '\f':
+				return 'f';
+			case '\n':
+				return 'n';
+			case '\r':
+				return 'r';
+			case '\t':
+				return 't';
+			case '\v':
+				return 'v';
+			case '"':
+				return '"';
+			default:
+				return 0;
+		}
+	}
+
+	PackedByteArray to_bytes() const {
+		PackedByteArray bytes;
+		bytes.resize(buffer.size());
+		if (!buffer.is_empty()) {
+			memcpy(bytes.ptrw(), buffer.ptr(), buffer.size());
+		}
+		return bytes;
+	}
+
+	JSONUTF8Writer() {
+		buffer.reserve(256);
+	}
+};
+
+static void _append_escaped(String &r_result, const String &p_str) {
+	r_result += p_str.json_escape();
+}
+
+static void _append_escaped(JSONUTF8Writer &r_result, const String &p_str) {
+	r_result.append_escaped(p_str);
+}
+
+template <typename W>
+void JSON::_add_indent(W &r_result, const String &p_indent, int p_size) {
 	for (int i = 0; i < p_size; i++) {
 		r_result += p_indent;
 	}
 }
 
-void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
+template <typename W>
+void JSON::_stringify(W &r_result, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
 	if (p_cur_indent > Variant::MAX_RECURSION_DEPTH) {
 		r_result += "...";
 		ERR_FAIL_MSG("JSON structure is too deep. Bailing.");
@@ -192,15 +296,87 @@ void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_in
 		}
 		default:
 			r_result += '"';
-			r_result += String(p_var).json_escape();
+			_append_escaped(r_result, String(p_var));
 			r_result += '"';
 			return;
 	}
 }
 
-Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str) {
+template <typename C>
+static _FORCE_INLINE_ char32_t _char_at(const C *p_str, int64_t p_index, int64_t p_len) {
+	return p_index < p_len ? (char32_t)p_str[p_index] : 0;
+}
+
+// Returns how many characters at the start of a string token can be copied as-is, i.e. the
+// distance to the next quote, backslash, newline or terminator.
+static int64_t _plain_run_length(const char32_t *p_str, int64_t p_len) {
+	int64_t i = 0;
+	while (i < p_len) {
+		const char32_t c = p_str[i];
+		if (c == '"' || c == '\\' || c == '\n' || c == 0) {
+			break;
+		}
+		i++;
+	}
+	return i;
+}
+
+static int64_t _plain_run_length(const uint8_t *p_str, int64_t p_len) {
+	// Test eight bytes at a time: `(v - 0x01..01) & ~v & 0x80..80` is non-zero iff a byte of `v` is zero.
+	constexpr uint64_t ONES = 0x0101010101010101ULL;
+	constexpr uint64_t HIGHS = 0x8080808080808080ULL;
+	int64_t i = 0;
+	while (i + 8 <= p_len) {
+		uint64_t v;
+		memcpy(&v, p_str + i, sizeof(v));
+		const uint64_t quote = v ^ (ONES * '"');
+		const uint64_t backslash = v ^ (ONES * '\\');
+		const uint64_t newline = v ^ (ONES * '\n');
+		const uint64_t special = ((v - ONES) & ~v) | ((quote - ONES) & ~quote) | ((backslash - ONES) & ~backslash) | ((newline - ONES) & ~newline);
+		if (special & HIGHS) {
+			break;
+		}
+		i += 8;
+	}
+	while (i < p_len) {
+		const uint8_t c = p_str[i];
+		if (c == '"' || c == '\\' || c == '\n' || c == 0) {
+			break;
+		}
+		i++;
+	}
+	return i;
+}
+
+static void _append_run(String &r_str, const char32_t *p_str, int64_t p_len) {
+	r_str.append_utf32(Span(p_str, p_len));
+}
+
+static void _append_run(String &r_str, const uint8_t *p_str, int64_t p_len) {
+	bool ascii = true;
+	for (int64_t i = 0; i < p_len; i++) {
+		if (p_str[i] > 127) {
+			ascii = false;
+			break;
+		}
+	}
+	if (ascii) {
+		r_str.append_ascii(Span((const char *)p_str, p_len));
+		return;
+	}
+	if (p_len >= 3 && p_str[0] == 0xef && p_str[1] == 0xbb && p_str[2] == 0xbf) {
+		// `append_utf8()` would drop this as a byte order mark, but inside a string it's a character.
+		r_str += (char32_t)0xfeff;
+		p_str += 3;
+		p_len -= 3;
+	}
+	r_str.append_utf8((const char *)p_str, p_len);
+}
+
+template <typename C>
+Error JSON::_get_token(const C *p_str, int64_t &index, int64_t p_len, Token &r_token, int &line, String &r_err_str) {
 	while (p_len > 0) {
-		switch (p_str[index]) {
+		switch (_char_at(p_str, index, p_len)) {
 			case '\n': {
 				line++;
 				index++;
@@ -244,16 +420,24 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 				index++;
 				String str;
 				while (true) {
-					if (p_str[index] == 0) {
+					// Copy runs of characters that need no special handling in one go.
+					const int64_t run = _plain_run_length(p_str + index, p_len - index);
+					if (run > 0) {
+						_append_run(str, p_str + index, run);
+						index += run;
+						continue;
+					}
+
+					if (_char_at(p_str, index, p_len) == 0) {
 						r_err_str = "Unterminated string";
 						return ERR_PARSE_ERROR;
-					} else if (p_str[index] == '"') {
+					} else if (_char_at(p_str, index, p_len) == '"') {
 						index++;
 						break;
-					} else if (p_str[index] == '\\') {
+					} else if (_char_at(p_str, index, p_len) == '\\') {
 						//escaped characters...
 						index++;
-						char32_t next = p_str[index];
+						char32_t next = _char_at(p_str, index, p_len);
 						if (next == 0) {
 							r_err_str = "Unterminated string";
 							return ERR_PARSE_ERROR;
@@ -279,7 +463,7 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 							case 'u': {
 								// hex number
 								for (int j = 0; j < 4; j++) {
-									char32_t c = p_str[index + j + 1];
+									char32_t c = _char_at(p_str, index + j + 1, p_len);
 									if (c == 0) {
 										r_err_str = "Unterminated string";
 										return ERR_PARSE_ERROR;
@@ -308,14 +492,14 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 								index += 4; //will add at the end anyway
 
 								if ((res & 0xfffffc00) == 0xd800) {
-									if (p_str[index + 1] != '\\' || p_str[index + 2] != 'u') {
+									if (_char_at(p_str, index + 1, p_len) != '\\' || _char_at(p_str, index + 2, p_len) != 'u') {
 										r_err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
 										return ERR_PARSE_ERROR;
 									}
 									index += 2;
 									char32_t trail = 0;
 									for (int j = 0; j < 4; j++) {
-										char32_t c = p_str[index + j + 1];
+										char32_t c = _char_at(p_str, index + j + 1, p_len);
 										if (c == 0) {
 											r_err_str = "Unterminated string";
 											return ERR_PARSE_ERROR;
@@ -368,10 +552,10 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 						str += res;
 
 					} else {
-						if (p_str[index] == '\n') {
+						if (_char_at(p_str, index, p_len) == '\n') {
 							line++;
 						}
-						str += p_str[index];
+						str += _char_at(p_str, index, p_len);
 					}
 					index++;
 				}
@@ -382,25 +566,51 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 
 			} break;
 			default: {
-				if (p_str[index] <= 32) {
+				if (_char_at(p_str, index, p_len) <= 32) {
 					index++;
 					break;
 				}
 
-				if (p_str[index] == '-' || is_digit(p_str[index])) {
+				if (_char_at(p_str, index, p_len) == '-' || is_digit(_char_at(p_str, index, p_len))) {
 					//a number
-					const char32_t *rptr;
-					double number = String::to_float(&p_str[index], &rptr);
-					index += (rptr - &p_str[index]);
+					double number;
+					if constexpr (std::is_same_v<C, char32_t>) {
+						const char32_t *rptr;
+						number = String::to_float(&p_str[index], &rptr);
+						index += (rptr - &p_str[index]);
+					} else {
+						// UTF-8 input isn't necessarily null-terminated, so the number is copied out first.
+						// Most numbers fit on the stack, longer ones (e.g. with many digits) go to the heap.
+						int64_t count = 0;
+						while (true) {
+							const char32_t c = _char_at(p_str, index + count, p_len);
+							if (!is_digit(c) && c != '-' && c != '+' && c != '.' && c != 'e' && c != 'E') {
+								break;
+							}
+							count++;
+						}
+						char stack_buffer[64];
+						LocalVector<char> heap_buffer;
+						char *buffer = stack_buffer;
+						if (count >= (int64_t)sizeof(stack_buffer)) {
+							heap_buffer.resize(count + 1);
+							buffer = heap_buffer.ptr();
+						}
+						memcpy(buffer, p_str + index, count);
+						buffer[count] = 0;
+						const char *rptr;
+						number = String::to_float(buffer, &rptr);
+						index += (rptr - buffer);
+					}
 					r_token.type = TK_NUMBER;
 					r_token.value = number;
 					return OK;
 
-				} else if (is_ascii_alphabet_char(p_str[index])) {
+				} else if (is_ascii_alphabet_char(_char_at(p_str, index, p_len))) {
 					String id;
 
-					while (is_ascii_alphabet_char(p_str[index])) {
-						id += p_str[index];
+					while (is_ascii_alphabet_char(_char_at(p_str, index, p_len))) {
+						id += _char_at(p_str, index, p_len);
 						index++;
 					}
 
@@ -419,7 +629,8 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 	return ERR_PARSE_ERROR;
 }
 
-Error JSON::_parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <typename C>
+Error JSON::_parse_value(Variant &value, Token &token, const C *p_str, int64_t &index, int64_t p_len, int &line, int p_depth, String &r_err_str) {
 	if (p_depth > Variant::MAX_RECURSION_DEPTH) {
 		r_err_str = "JSON structure is too deep";
 		return ERR_OUT_OF_MEMORY;
@@ -463,7 +674,8 @@ Error JSON::_parse_value(Variant &value, Token &token, const char32_t *p_str, in
 	return OK;
 }
 
-Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <typename C>
+Error JSON::_parse_array(Array &array, const C *p_str, int64_t &index, int64_t p_len, int &line, int p_depth, String &r_err_str) {
 	Token token;
 	bool need_comma = false;
 
@@ -501,7 +713,8 @@ Error JSON::_parse_array(Array &array, const char32_t *p_str, int &index, int p_
 	return ERR_PARSE_ERROR;
 }
 
-Error JSON::_parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str) {
+template <typename C>
+Error JSON::_parse_object(Dictionary &object, const C *p_str, int64_t &index, int64_t p_len, int &line, int p_depth, String &r_err_str) {
 	bool at_key = true;
 	String key;
 	Token token;
@@ -571,8 +784,8 @@ void JSON::set_data(const Variant &p_data) {
 
 Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line) {
 	const char32_t *str = p_json.ptr();
-	int idx = 0;
-	int len = p_json.length();
+	int64_t idx = 0;
+	int64_t len = p_json.length();
 	Token token;
 	r_err_line = 0;
 	String aux_key;
@@ -600,6 +813,37 @@ Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_st
 	return err;
 }
 
+Error JSON::_parse_utf8(const uint8_t *p_json, int64_t p_len, Variant &r_ret, String &r_err_str, int &r_err_line) {
+	// Skip the byte order mark, like `String::utf8()` does.
+	if (p_len >= 3 && p_json[0] == 0xef && p_json[1] == 0xbb && p_json[2] == 0xbf) {
+		p_json += 3;
+		p_len -= 3;
+	}
+
+	int64_t idx = 0;
+	Token token;
+	r_err_line = 0;
+
+	Error err = _get_token(p_json, idx, p_len, token, r_err_line, r_err_str);
+	if (err) {
+		return err;
+	}
+
+	err = _parse_value(r_ret, token, p_json, idx, p_len, r_err_line, 0, r_err_str);
+
+	if (err == OK && idx < p_len) {
+		err = _get_token(p_json, idx, p_len, token, r_err_line, r_err_str);
+
+		if (err || token.type != TK_EOF) {
+			r_err_str = "Expected 'EOF'";
+			r_ret = Variant();
+			return ERR_PARSE_ERROR;
+		}
+	}
+
+	return err;
+}
+
 Error JSON::parse(const String &p_json_string, bool p_keep_text) {
 	Error err = _parse_string(p_json_string, data, err_str, err_line);
 	if (err == Error::OK) {
@@ -611,6 +855,28 @@ Error JSON::parse(const String &p_json_string, bool p_keep_text) {
 	return err;
 }
 
+Error JSON::parse_utf8(const PackedByteArray &p_json_utf8, bool p_keep_text) {
+	Error err = _parse_utf8(p_json_utf8.ptr(), p_json_utf8.size(), data, err_str, err_line);
+	if (err == Error::OK) {
+		err_line = 0;
+	}
+	if (p_keep_text) {
+		text = String::utf8((const char *)p_json_utf8.ptr(), p_json_utf8.size());
+	}
+	return err;
+}
+
+Error JSON::parse_file(const String &p_path, bool p_keep_text) {
+	Error err;
+	const Vector<uint8_t> bytes = FileAccess::get_file_as_bytes(p_path, &err);
+	if (err != OK) {
+		err_str = vformat("Cannot open file '%s'.", p_path);
+		err_line = 0;
+		return err;
+	}
+	return parse_utf8(bytes, p_keep_text);
+}
+
 String JSON::get_parsed_text() const {
 	return text;
 }
@@ -622,6 +888,13 @@ String JSON::stringify(const Variant &p_var, const String &p_indent, bool p_sort
 	return result;
 }
 
+PackedByteArray JSON::stringify_utf8(const Variant &p_var, const String &p_indent, bool p_sort_keys, bool p_full_precision) {
+	JSONUTF8Writer result;
+	HashSet<const void *> markers;
+	_stringify(result, p_var, p_indent, 0, p_sort_keys, markers, p_full_precision);
+	return result.to_bytes();
+}
+
 Variant JSON::parse_string(const String &p_json_string) {
 	Ref<JSON> json;
 	json.instantiate();
@@ -632,8 +905,11 @@ Variant JSON::parse_string(const String &p_json_string) {
 
 void JSON::_bind_methods() {
 	ClassDB::bind_static_method("JSON", D_METHOD("stringify", "data", "indent", "sort_keys", "full_precision"), &JSON::stringify, DEFVAL(""), DEFVAL(true), DEFVAL(false));
+	ClassDB::bind_static_method("JSON", D_METHOD("stringify_utf8", "data", "indent", "sort_keys", "full_precision"), &JSON::stringify_utf8, DEFVAL(""), DEFVAL(true), DEFVAL(false));
 	ClassDB::bind_static_method("JSON", D_METHOD("parse_string", "json_string"), &JSON::parse_string);
 	ClassDB::bind_method(D_METHOD("parse", "json_text", "keep_text"), &JSON::parse, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("parse_utf8", "json_utf8", "keep_text"), &JSON::parse_utf8, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("parse_file", "path", "keep_text"), &JSON::parse_file, DEFVAL(false));
 
 	ClassDB::bind_method(D_METHOD("get_data"), &JSON::get_data);
 	ClassDB::bind_method(D_METHOD("set_data", "data"), &JSON::set_data);
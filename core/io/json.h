@@ -69,13 +69,20 @@ class JSON : public Resource {
 
 	static const char *tk_name[];
 
-	static void _add_indent(String &r_result, const String &p_indent, int p_size);
-	static void _stringify(String &r_result, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision);
-	static Error _get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str);
-	static Error _parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
-	static Error _parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
-	static Error _parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
+	template <typename W>
+	static void _add_indent(W &r_result, const String &p_indent, int p_size);
+	template <typename W>
+	static void _stringify(W &r_result, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision);
+	template <typename C>
+	static Error _get_token(const C *p_str, int64_t &index, int64_t p_len, Token &r_token, int &line, String &r_err_str);
+	template <typename C>
+	static Error _parse_value(Variant &value, Token &token, const C *p_str, int64_t &index, int64_t p_len, int &line, int p_depth, String &r_err_str);
+	template <typename C>
+	static Error _parse_array(Array &array, const C *p_str, int64_t &index, int64_t p_len, int &line, int p_depth, String &r_err_str);
+	template <typename C>
+	static Error _parse_object(Dictionary &object, const C *p_str, int64_t &index, int64_t p_len, int &line, int p_depth, String &r_err_str);
 	static Error _parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line);
+	static Error _parse_utf8(const uint8_t *p_json, int64_t p_len, Variant &r_ret, String &r_err_str, int &r_err_line);
 
 	static Variant _from_native(const Variant &p_variant, bool p_full_objects, int p_depth);
 	static Variant _to_native(const Variant &p_json, bool p_allow_objects, int p_depth);
@@ -85,9 +92,12 @@ protected:
 
 public:
 	Error parse(const String &p_json_string, bool p_keep_text = false);
+	Error parse_utf8(const PackedByteArray &p_json_utf8, bool p_keep_text = false);
+	Error parse_file(const String &p_path, bool p_keep_text = false);
 	String get_parsed_text() const;
 
 	static String stringify(const Variant &p_var, const String &p_indent = "", bool p_sort_keys = true, bool p_full_precision = false);
+	static PackedByteArray stringify_utf8(const Variant &p_var, const String &p_indent = "", bool p_sort_keys = true, bool p_full_precision = false);
 	static Variant parse_string(const String &p_json_string);
 
 	_FORCE_INLINE_ static Variant from_native(const Variant &p_variant, bool p_full_objects = false) {
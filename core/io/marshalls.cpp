@@ -34,6 +34,7 @@
 #include "core/object/class_db.h"
 #include "core/object/ref_counted.h"
 #include "core/object/script_language.h"
+#include "core/templates/hash_set.h"
 #include "core/variant/container_type_validate.h"
 
 #include <climits>
@@ -71,6 +72,11 @@ ObjectID EncodedObjectAsID::get_object_id() const {
 #define HEADER_DATA_FIELD_TYPED_ARRAY_MASK (0b11 << 16)
 #define HEADER_DATA_FIELD_TYPED_ARRAY_SHIFT 16
 
+// For `Variant::ARRAY` and `Variant::DICTIONARY`.
+// The element headers (key and value headers for dictionaries) follow the count once,
+// instead of preceding every element. A zero shared header means elements have their own.
+#define HEADER_DATA_FLAG_OMIT_ELEMENT_HEADERS (1 << 20)
+
 // For `Variant::DICTIONARY`.
 // Occupies bits 16 and 17.
 #define HEADER_DATA_FIELD_TYPED_DICTIONARY_KEY_MASK (0b11 << 16)
@@ -183,27 +189,297 @@ static Error _decode_container_type(const uint8_t *&buf, int &len, int *r_len, b
 	ERR_FAIL_V_MSG(ERR_INVALID_DATA, "Invalid container type kind."); // Future proofing.
 }
 
-Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len, bool p_allow_objects, int p_depth) {
-	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Variant is too deep. Bailing.");
-	const uint8_t *buf = p_buffer;
-	int len = p_len;
+static Error _decode_variant_data(Variant &r_variant, uint32_t p_header, const uint8_t *p_buffer, int p_len, int *r_len, bool p_allow_objects, int p_depth);
+
+// Types whose header can be shared by all elements of a typed container,
+// as their data never depends on per-element flags other than `HEADER_DATA_FLAG_64`.
+static bool _is_shareable_header_type(Variant::Type p_type) {
+	switch (p_type) {
+		case Variant::NIL:
+		case Variant::OBJECT:
+		case Variant::CALLABLE:
+		case Variant::SIGNAL:
+		case Variant::DICTIONARY:
+		case Variant::ARRAY:
+			return false;
+		default:
+			return true;
+	}
+}
 
+static bool _is_same_container_type(const ContainerType &p_a, const ContainerType &p_b) {
+	return p_a.builtin_type == p_b.builtin_type && p_a.class_name == p_b.class_name && p_a.script == p_b.script;
+}
+
+static Error _decode_shared_element_header(const uint8_t *&buf, int &len, int *r_len, const ContainerType &p_type, uint32_t &r_header) {
 	ERR_FAIL_COND_V(len < 4, ERR_INVALID_DATA);
 
-	uint32_t header = decode_uint32(buf);
+	r_header = decode_uint32(buf);
+	buf += 4;
+	len -= 4;
+	if (r_len) {
+		(*r_len) += 4;
+	}
 
-	ERR_FAIL_COND_V((header & HEADER_TYPE_MASK) >= Variant::VARIANT_MAX, ERR_INVALID_DATA);
+	if (r_header == 0) {
+		return OK; // Elements have their own headers.
+	}
+
+	ERR_FAIL_COND_V((r_header & ~(HEADER_TYPE_MASK | HEADER_DATA_FLAG_64)) != 0, ERR_INVALID_DATA);
+	Variant::Type type = Variant::Type(r_header & HEADER_TYPE_MASK);
+	ERR_FAIL_COND_V(type != p_type.builtin_type || !_is_shareable_header_type(type), ERR_INVALID_DATA);
+	return OK;
+}
+
+static Error _decode_container_element(Variant &r_elem, uint32_t p_shared_header, bool p_in_place, const uint8_t *&buf, int &len, int *r_len, bool p_allow_objects, int p_depth) {
+	int used = 0;
+	Error err;
+	if (p_shared_header) {
+		err = _decode_variant_data(r_elem, p_shared_header, buf, len, &used, p_allow_objects, p_depth);
+	} else if (p_in_place) {
+		err = decode_variant_in_place(r_elem, buf, len, &used, p_allow_objects, p_depth);
+	} else {
+		err = decode_variant(r_elem, buf, len, &used, p_allow_objects, p_depth);
+	}
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Error when trying to decode Variant.");
+
+	buf += used;
+	len -= used;
+	if (r_len) {
+		(*r_len) += used;
+	}
+	return OK;
+}
+
+// When `p_in_place` is `true` and `r_dict` has the encoded key and value types, its entries are updated
+// in place (decoding into the existing values where possible) and entries missing from the data are removed.
+// Otherwise `r_dict` is replaced with a new dictionary.
+static Error _decode_dictionary(Dictionary &r_dict, bool p_in_place, uint32_t p_header, const uint8_t *&buf, int &len, int *r_len, bool p_allow_objects, int p_depth) {
+	ContainerType key_type;
+
+	{
+		ContainerTypeKind key_type_kind = GET_CONTAINER_TYPE_KIND(p_header, TYPED_DICTIONARY_KEY);
+		Error err = _decode_container_type(buf, len, r_len, p_allow_objects, key_type_kind, key_type);
+		if (err) {
+			return err;
+		}
+	}
+
+	ContainerType value_type;
+
+	{
+		ContainerTypeKind value_type_kind = GET_CONTAINER_TYPE_KIND(p_header, TYPED_DICTIONARY_VALUE);
+		Error err = _decode_container_type(buf, len, r_len, p_allow_objects, value_type_kind, value_type);
+		if (err) {
+			return err;
+		}
+	}
+
+	ERR_FAIL_COND_V(len < 4, ERR_INVALID_DATA);
+
+	int32_t count = decode_uint32(buf);
+	//bool shared = count & 0x80000000;
+	count &= 0x7FFFFFFF;
+
+	buf += 4;
+	len -= 4;
+
+	if (r_len) {
+		(*r_len) += 4; // Size of count number.
+	}
+
+	uint32_t key_header = 0;
+	uint32_t value_header = 0;
+	if (p_header & HEADER_DATA_FLAG_OMIT_ELEMENT_HEADERS) {
+		Error err = _decode_shared_element_header(buf, len, r_len, key_type, key_header);
+		if (err) {
+			return err;
+		}
+		err = _decode_shared_element_header(buf, len, r_len, value_type, value_header);
+		if (err) {
+			return err;
+		}
+	}
+
+	if (p_in_place && !(_is_same_container_type(r_dict.get_key_type(), key_type) && _is_same_container_type(r_dict.get_value_type(), value_type))) {
+		p_in_place = false;
+	}
+	if (!p_in_place) {
+		r_dict = Dictionary();
+		if (key_type.builtin_type != Variant::NIL || value_type.builtin_type != Variant::NIL) {
+			r_dict.set_typed(key_type, value_type);
+		}
+	}
+
+	// Decoded keys, to remove the previous entries that are not in the data afterwards.
+	HashSet<Variant, HashMapHasherDefault, StringLikeVariantComparator> decoded_keys;
+	const bool track_keys = p_in_place && !r_dict.is_empty();
+
+	for (int i = 0; i < count; i++) {
+		Variant key;
+		Error err = _decode_container_element(key, key_header, false, buf, len, r_len, p_allow_objects, p_depth + 1);
+		if (err) {
+			return err;
+		}
+
+		Variant value;
+		const Variant *existing = nullptr;
+		if (track_keys) {
+			existing = r_dict.getptr(key);
+			if (existing) {
+				value = *existing;
+			}
+			decoded_keys.insert(key);
+		}
+
+		err = _decode_container_element(value, value_header, existing != nullptr, buf, len, r_len, p_allow_objects, p_depth + 1);
+		if (err) {
+			return err;
+		}
+
+		r_dict[key] = value;
+	}
+
+	if (track_keys && r_dict.size() > (int)decoded_keys.size()) {
+		const Array keys = r_dict.keys();
+		for (const Variant &key : keys) {
+			if (!decoded_keys.has(key)) {
+				r_dict.erase(key);
+			}
+		}
+	}
+
+	return OK;
+}
+
+// When `p_in_place` is `true` and `r_array` has the encoded element type, it is resized
+// and its elements are decoded in place. Otherwise `r_array` is replaced with a new array.
+static Error _decode_array(Array &r_array, bool p_in_place, uint32_t p_header, const uint8_t *&buf, int &len, int *r_len, bool p_allow_objects, int p_depth) {
+	ContainerType type;
+
+	{
+		ContainerTypeKind type_kind = GET_CONTAINER_TYPE_KIND(p_header, TYPED_ARRAY);
+		Error err = _decode_container_type(buf, len, r_len, p_allow_objects, type_kind, type);
+		if (err) {
+			return err;
+		}
+	}
+
+	ERR_FAIL_COND_V(len < 4, ERR_INVALID_DATA);
+
+	int32_t count = decode_uint32(buf);
+	//bool shared = count & 0x80000000;
+	count &= 0x7FFFFFFF;
 
 	buf += 4;
 	len -= 4;
+
+	if (r_len) {
+		(*r_len) += 4; // Size of count number.
+	}
+
+	uint32_t elem_header = 0;
+	if (p_header & HEADER_DATA_FLAG_OMIT_ELEMENT_HEADERS) {
+		Error err = _decode_shared_element_header(buf, len, r_len, type, elem_header);
+		if (err) {
+			return err;
+		}
+	}
+
+	// Every element takes at least 4 bytes, check before allocating.
+	ERR_FAIL_COND_V(count > len / 4, ERR_INVALID_DATA);
+
+	if (p_in_place && !_is_same_container_type(r_array.get_element_type(), type)) {
+		p_in_place = false;
+	}
+	if (!p_in_place) {
+		r_array = Array();
+		if (type.builtin_type != Variant::NIL) {
+			r_array.set_typed(type);
+		}
+	}
+
+	const int reused = MIN(r_array.size(), count);
+	ERR_FAIL_COND_V(r_array.resize(count) != OK, ERR_OUT_OF_MEMORY);
+
+	for (int i = 0; i < count; i++) {
+		Variant elem;
+		if (i < reused) {
+			elem = r_array[i];
+		}
+
+		Error err = _decode_container_element(elem, elem_header, i < reused, buf, len, r_len, p_allow_objects, p_depth + 1);
+		if (err) {
+			return err;
+		}
+
+		r_array.set(i, elem);
+	}
+
+	return OK;
+}
+
+Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len, bool p_allow_objects, int p_depth) {
+	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Variant is too deep. Bailing.");
+	ERR_FAIL_COND_V(p_len < 4, ERR_INVALID_DATA);
+
+	uint32_t header = decode_uint32(p_buffer);
+
+	ERR_FAIL_COND_V((header & HEADER_TYPE_MASK) >= Variant::VARIANT_MAX, ERR_INVALID_DATA);
+
 	if (r_len) {
 		*r_len = 4;
 	}
 
+	return _decode_variant_data(r_variant, header, p_buffer + 4, p_len - 4, r_len, p_allow_objects, p_depth);
+}
+
+Error decode_variant_in_place(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len, bool p_allow_objects, int p_depth) {
+	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Variant is too deep. Bailing.");
+	ERR_FAIL_COND_V(p_len < 4, ERR_INVALID_DATA);
+
+	uint32_t header = decode_uint32(p_buffer);
+	Variant::Type type = Variant::Type(header & HEADER_TYPE_MASK);
+
+	if (type != r_variant.get_type() || (type != Variant::ARRAY && type != Variant::DICTIONARY)) {
+		return decode_variant(r_variant, p_buffer, p_len, r_len, p_allow_objects, p_depth);
+	}
+
+	if (r_len) {
+		*r_len = 4;
+	}
+
+	const uint8_t *buf = p_buffer + 4;
+	int len = p_len - 4;
+
+	if (type == Variant::ARRAY) {
+		Array array = r_variant;
+		Error err = _decode_array(array, true, header, buf, len, r_len, p_allow_objects, p_depth);
+		if (err) {
+			return err;
+		}
+		r_variant = array;
+	} else {
+		Dictionary dict = r_variant;
+		Error err = _decode_dictionary(dict, true, header, buf, len, r_len, p_allow_objects, p_depth);
+		if (err) {
+			return err;
+		}
+		r_variant = dict;
+	}
+
+	return OK;
+}
+
+// Decodes the data following a variant header. `r_len` is incremented by the amount of data read.
+static Error _decode_variant_data(Variant &r_variant, uint32_t p_header, const uint8_t *p_buffer, int p_len, int *r_len, bool p_allow_objects, int p_depth) {
+	const uint8_t *buf = p_buffer;
+	int len = p_len;
+
 	// NOTE: We cannot use `sizeof(real_t)` for decoding, in case a different size is encoded.
 	// Decoding math types always checks for the encoded size, while encoding always uses compilation setting.
 	// This does lead to some code duplication for decoding, but compatibility is the priority.
-	switch (header & HEADER_TYPE_MASK) {
+	switch (p_header & HEADER_TYPE_MASK) {
 		case Variant::NIL: {
 			r_variant = Variant();
 		} break;
@@ -216,7 +492,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			}
 		} break;
 		case Variant::INT: {
-			if (header & HEADER_DATA_FLAG_64) {
+			if (p_header & HEADER_DATA_FLAG_64) {
 				ERR_FAIL_COND_V(len < 8, ERR_INVALID_DATA);
 				int64_t val = int64_t(decode_uint64(buf));
 				r_variant = val;
@@ -235,7 +511,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 
 		} break;
 		case Variant::FLOAT: {
-			if (header & HEADER_DATA_FLAG_64) {
+			if (p_header & HEADER_DATA_FLAG_64) {
 				ERR_FAIL_COND_V((size_t)len < sizeof(double), ERR_INVALID_DATA);
 				double val = decode_double(buf);
 				r_variant = val;
@@ -265,7 +541,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 		// Math types.
 		case Variant::VECTOR2: {
 			Vector2 val;
-			if (header & HEADER_DATA_FLAG_64) {
+			if (p_header & HEADER_DATA_FLAG_64) {
 				ERR_FAIL_COND_V((size_t)len < sizeof(double) * 2, ERR_INVALID_DATA);
 				val.x = decode_double(&buf[0]);
 				val.y = decode_double(&buf[sizeof(double)]);
@@ -299,7 +575,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 		} break;
 		case Variant::RECT2: {
 			Rect2 val;
-			if (header & HEADER_DATA_FLAG_64) {
+			if (p_header & HEADER_DATA_FLAG_64) {
 				ERR_FAIL_COND_V((size_t)len < sizeof(double) * 4, ERR_INVALID_DATA);
 				val.position.x = decode_double(&buf[0]);
 				val.position.y = decode_double(&buf[sizeof(double)]);
@@ -339,7 +615,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 		} break;
 		case Variant::VECTOR3: {
 			Vector3 val;
-			if (header & HEADER_DATA_FLAG_64) {
+			if (p_header & HEADER_DATA_FLAG_64) {
 				ERR_FAIL_COND_V((size_t)len < sizeof(double) * 3, ERR_INVALID_DATA);
 				val.x = decode_double(&buf[0]);
 				val.y = decode_double(&buf[sizeof(double)]);
@@ -376,7 +652,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 		} break;
 		case Variant::VECTOR4: {
 			Vector4 val;
-			if (header & HEADER_DATA_FLAG_64) {
+			if (p_header & HEADER_DATA_FLAG_64) {
 				ERR_FAIL_COND_V((size_t)len < sizeof(double) * 4, ERR_INVALID_DATA);
 				val.x = decode_double(&buf[0]);
 				val.y = decode_double(&buf[sizeof(double)]);
@@ -416,7 +692,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 		} break;
 		case Variant::TRANSFORM2D: {
 			Transform2D val;
-			if (header & HEADER_DATA_FLAG_64) {
+			if (p_header & HEADER_DATA_FLAG_64) {
 				ERR_FAIL_COND_V((size_t)len < sizeof(double) * 6, ERR_INVALID_DATA);
 				for (int i = 0; i < 3; i++) {
 					for (int j = 0; j < 2; j++) {
@@ -444,7 +720,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 		} break;
 		case Variant::PLANE: {
 			Plane val;
-			if (header & HEADER_DATA_FLAG_64) {
+			if (p_header & HEADER_DATA_FLAG_64) {
 				ERR_FAIL_COND_V((size_t)len < sizeof(double) * 4, ERR_INVALID_DATA);
 				val.normal.x = decode_double(&buf[0]);
 				val.normal.y = decode_double(&buf[sizeof(double)]);
@@ -470,7 +746,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 		} break;
 		case Variant::QUATERNION: {
 			Quaternion val;
-			if (header & HEADER_DATA_FLAG_64) {
+			if (p_header & HEADER_DATA_FLAG_64) {
 				ERR_FAIL_COND_V((size_t)len < sizeof(double) * 4, ERR_INVALID_DATA);
 				val.x = decode_double(&buf[0]);
 				val.y = decode_double(&buf[sizeof(double)]);
@@ -496,7 +772,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 		} break;
 		case Variant::AABB: {
 			AABB val;
-			if (header & HEADER_DATA_FLAG_64) {
+			if (p_header & HEADER_DATA_FLAG_64) {
 				ERR_FAIL_COND_V((size_t)len < sizeof(double) * 6, ERR_INVALID_DATA);
 				val.position.x = decode_double(&buf[0]);
 				val.position.y = decode_double(&buf[sizeof(double)]);
@@ -526,7 +802,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 		} break;
 		case Variant::BASIS: {
 			Basis val;
-			if (header & HEADER_DATA_FLAG_64) {
+			if (p_header & HEADER_DATA_FLAG_64) {
 				ERR_FAIL_COND_V((size_t)len < sizeof(double) * 9, ERR_INVALID_DATA);
 				for (int i = 0; i < 3; i++) {
 					for (int j = 0; j < 3; j++) {
@@ -554,7 +830,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 		} break;
 		case Variant::TRANSFORM3D: {
 			Transform3D val;
-			if (header & HEADER_DATA_FLAG_64) {
+			if (p_header & HEADER_DATA_FLAG_64) {
 				ERR_FAIL_COND_V((size_t)len < sizeof(double) * 12, ERR_INVALID_DATA);
 				for (int i = 0; i < 3; i++) {
 					for (int j = 0; j < 3; j++) {
@@ -588,7 +864,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 		} break;
 		case Variant::PROJECTION: {
 			Projection val;
-			if (header & HEADER_DATA_FLAG_64) {
+			if (p_header & HEADER_DATA_FLAG_64) {
 				ERR_FAIL_COND_V((size_t)len < sizeof(double) * 16, ERR_INVALID_DATA);
 				for (int i = 0; i < 4; i++) {
 					for (int j = 0; j < 4; j++) {
@@ -697,7 +973,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			r_variant = RID::from_uint64(id);
 		} break;
 		case Variant::OBJECT: {
-			if (header & HEADER_DATA_FLAG_OBJECT_AS_ID) {
+			if (p_header & HEADER_DATA_FLAG_OBJECT_AS_ID) {
 				// This _is_ allowed.
 				ERR_FAIL_COND_V(len < 8, ERR_INVALID_DATA);
 				ObjectID val = ObjectID(decode_uint64(buf));
@@ -805,112 +1081,20 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			r_variant = Signal(id, StringName(name));
 		} break;
 		case Variant::DICTIONARY: {
-			ContainerType key_type;
-
-			{
-				ContainerTypeKind key_type_kind = GET_CONTAINER_TYPE_KIND(header, TYPED_DICTIONARY_KEY);
-				Error err = _decode_container_type(buf, len, r_len, p_allow_objects, key_type_kind, key_type);
-				if (err) {
-					return err;
-				}
-			}
-
-			ContainerType value_type;
-
-			{
-				ContainerTypeKind value_type_kind = GET_CONTAINER_TYPE_KIND(header, TYPED_DICTIONARY_VALUE);
-				Error err = _decode_container_type(buf, len, r_len, p_allow_objects, value_type_kind, value_type);
-				if (err) {
-					return err;
-				}
-			}
-
-			ERR_FAIL_COND_V(len < 4, ERR_INVALID_DATA);
-
-			int32_t count = decode_uint32(buf);
-			//bool shared = count & 0x80000000;
-			count &= 0x7FFFFFFF;
-
-			buf += 4;
-			len -= 4;
-
-			if (r_len) {
-				(*r_len) += 4; // Size of count number.
-			}
-
 			Dictionary dict;
-			if (key_type.builtin_type != Variant::NIL || value_type.builtin_type != Variant::NIL) {
-				dict.set_typed(key_type, value_type);
-			}
-
-			for (int i = 0; i < count; i++) {
-				Variant key, value;
-
-				int used;
-				Error err = decode_variant(key, buf, len, &used, p_allow_objects, p_depth + 1);
-				ERR_FAIL_COND_V_MSG(err != OK, err, "Error when trying to decode Variant.");
-
-				buf += used;
-				len -= used;
-				if (r_len) {
-					(*r_len) += used;
-				}
-
-				err = decode_variant(value, buf, len, &used, p_allow_objects, p_depth + 1);
-				ERR_FAIL_COND_V_MSG(err != OK, err, "Error when trying to decode Variant.");
-
-				buf += used;
-				len -= used;
-				if (r_len) {
-					(*r_len) += used;
-				}
-
-				dict[key] = value;
+			Error err = _decode_dictionary(dict, false, p_header, buf, len, r_len, p_allow_objects, p_depth);
+			if (err) {
+				return err;
 			}
 
 			r_variant = dict;
 
 		} break;
 		case Variant::ARRAY: {
-			ContainerType type;
-
-			{
-				ContainerTypeKind type_kind = GET_CONTAINER_TYPE_KIND(header, TYPED_ARRAY);
-				Error err = _decode_container_type(buf, len, r_len, p_allow_objects, type_kind, type);
-				if (err) {
-					return err;
-				}
-			}
-
-			ERR_FAIL_COND_V(len < 4, ERR_INVALID_DATA);
-
-			int32_t count = decode_uint32(buf);
-			//bool shared = count & 0x80000000;
-			count &= 0x7FFFFFFF;
-
-			buf += 4;
-			len -= 4;
-
-			if (r_len) {
-				(*r_len) += 4; // Size of count number.
-			}
-
 			Array array;
-			if (type.builtin_type != Variant::NIL) {
-				array.set_typed(type);
-			}
-
-			for (int i = 0; i < count; i++) {
-				int used = 0;
-				Variant elem;
-				Error err = decode_variant(elem, buf, len, &used, p_allow_objects, p_depth + 1);
-				ERR_FAIL_COND_V_MSG(err != OK, err, "Error when trying to decode Variant.");
-				buf += used;
-				len -= used;
-				array.push_back(elem);
-				if (r_len) {
-					(*r_len) += used;
-				}
+			Error err = _decode_array(array, false, p_header, buf, len, r_len, p_allow_objects, p_depth);
+			if (err) {
+				return err;
 			}
 
 			r_variant = array;
@@ -1075,7 +1259,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 
 			Vector<Vector2> varray;
 
-			if (header & HEADER_DATA_FLAG_64) {
+			if (p_header & HEADER_DATA_FLAG_64) {
 				ERR_FAIL_MUL_OF(count, sizeof(double) * 2, ERR_INVALID_DATA);
 				ERR_FAIL_COND_V(count < 0 || count * sizeof(double) * 2 > (size_t)len, ERR_INVALID_DATA);
 
@@ -1135,7 +1319,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 
 			Vector<Vector3> varray;
 
-			if (header & HEADER_DATA_FLAG_64) {
+			if (p_header & HEADER_DATA_FLAG_64) {
 				ERR_FAIL_MUL_OF(count, sizeof(double) * 3, ERR_INVALID_DATA);
 				ERR_FAIL_COND_V(count < 0 || count * sizeof(double) * 3 > (size_t)len, ERR_INVALID_DATA);
 
@@ -1237,7 +1421,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 
 			Vector<Vector4> varray;
 
-			if (header & HEADER_DATA_FLAG_64) {
+			if (p_header & HEADER_DATA_FLAG_64) {
 				ERR_FAIL_MUL_OF(count, sizeof(double) * 4, ERR_INVALID_DATA);
 				ERR_FAIL_COND_V(count < 0 || count * sizeof(double) * 4 > (size_t)len, ERR_INVALID_DATA);
 
@@ -1359,12 +1543,7 @@ static Error _encode_container_type(const ContainerType &p_type, uint8_t *&buf,
 	return OK;
 }
 
-Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects, int p_depth) {
-	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Potential infinite recursion detected. Bailing.");
-	uint8_t *buf = r_buffer;
-
-	r_len = 0;
-
+static uint32_t _encode_variant_header(const Variant &p_variant, bool p_full_objects) {
 	uint32_t header = p_variant.get_type();
 
 	switch (p_variant.get_type()) {
@@ -1382,17 +1561,6 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			}
 		} break;
 		case Variant::OBJECT: {
-			// Test for potential wrong values sent by the debugger when it breaks.
-			Object *obj = p_variant.get_validated_object();
-			if (!obj) {
-				// Object is invalid, send a nullptr instead.
-				if (buf) {
-					encode_uint32(Variant::NIL, buf);
-				}
-				r_len += 4;
-				return OK;
-			}
-
 			if (!p_full_objects) {
 				header |= HEADER_DATA_FLAG_OBJECT_AS_ID;
 			}
@@ -1429,12 +1597,249 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 		} break;
 	}
 
+	return header;
+}
+
+static Error _encode_variant_data(const Variant &p_variant, uint32_t p_header, uint8_t *r_buffer, int &r_len, bool p_full_objects, int p_depth);
+
+Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects, int p_depth) {
+	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Potential infinite recursion detected. Bailing.");
+	uint8_t *buf = r_buffer;
+
+	r_len = 0;
+
+	// Test for potential wrong values sent by the debugger when it breaks.
+	if (p_variant.get_type() == Variant::OBJECT && !p_variant.get_validated_object()) {
+		// Object is invalid, send a nullptr instead.
+		if (buf) {
+			encode_uint32(Variant::NIL, buf);
+		}
+		r_len += 4;
+		return OK;
+	}
+
+	uint32_t header = _encode_variant_header(p_variant, p_full_objects);
+
 	if (buf) {
 		encode_uint32(header, buf);
 		buf += 4;
 	}
 	r_len += 4;
 
+	return _encode_variant_data(p_variant, header, buf, r_len, p_full_objects, p_depth);
+}
+
+// Appends `p_size` uninitialized bytes to `r_buffer` and returns a pointer to them.
+static uint8_t *_buffer_append(LocalVector<uint8_t> &r_buffer, uint32_t p_size) {
+	uint32_t ofs = r_buffer.size();
+	r_buffer.resize_uninitialized(ofs + p_size);
+	return r_buffer.ptr() + ofs;
+}
+
+static void _encode_string_to_buffer(const String &p_string, LocalVector<uint8_t> &r_buffer) {
+	CharString utf8 = p_string.utf8();
+	uint32_t len = utf8.length();
+	uint32_t pad = (4 - len % 4) % 4;
+
+	uint8_t *buf = _buffer_append(r_buffer, 4 + len + pad);
+	encode_uint32(len, buf);
+	memcpy(buf + 4, utf8.get_data(), len);
+	memset(buf + 4 + len, 0, pad);
+}
+
+// Appends the data following the header of a non-container variant.
+static Error _encode_variant_data_to_buffer(const Variant &p_variant, uint32_t p_header, LocalVector<uint8_t> &r_buffer, bool p_full_objects, uint32_t p_max_size, int p_depth) {
+	// Strings are converted to UTF-8 once, instead of once for the size and once for the data.
+	if (p_variant.get_type() == Variant::STRING || p_variant.get_type() == Variant::STRING_NAME) {
+		_encode_string_to_buffer(p_variant.operator String(), r_buffer);
+		return r_buffer.size() > p_max_size ? ERR_OUT_OF_MEMORY : OK;
+	}
+	if (p_variant.get_type() == Variant::PACKED_STRING_ARRAY) {
+		const Vector<String> data = p_variant;
+		encode_uint32(uint32_t(data.size()), _buffer_append(r_buffer, 4));
+		for (const String &str : data) {
+			// Unlike single strings, the length includes the null terminator.
+			const CharString utf8 = str.utf8();
+			const uint32_t len = utf8.length() + 1;
+			const uint32_t pad = (4 - len % 4) % 4;
+			if (r_buffer.size() + 4 + len + pad > p_max_size) {
+				return ERR_OUT_OF_MEMORY;
+			}
+
+			uint8_t *buf = _buffer_append(r_buffer, 4 + len + pad);
+			encode_uint32(len, buf);
+			memcpy(buf + 4, utf8.get_data(), len);
+			memset(buf + 4 + len, 0, pad);
+		}
+		return OK;
+	}
+
+	int len = 0;
+	Error err = _encode_variant_data(p_variant, p_header, nullptr, len, p_full_objects, p_depth);
+	ERR_FAIL_COND_V(err, err);
+	if (r_buffer.size() + len > p_max_size) {
+		return ERR_OUT_OF_MEMORY;
+	}
+
+	uint8_t *buf = _buffer_append(r_buffer, len);
+	len = 0;
+	return _encode_variant_data(p_variant, p_header, buf, len, p_full_objects, p_depth);
+}
+
+static Error _encode_container_type_to_buffer(const ContainerType &p_type, LocalVector<uint8_t> &r_buffer, bool p_full_objects) {
+	int len = 0;
+	uint8_t *buf = nullptr;
+	Error err = _encode_container_type(p_type, buf, len, p_full_objects);
+	if (err || len == 0) {
+		return err;
+	}
+
+	buf = _buffer_append(r_buffer, len);
+	len = 0;
+	return _encode_container_type(p_type, buf, len, p_full_objects);
+}
+
+// Merges the header of `p_value` into the header shared by the elements of a container typed as `p_type`.
+// The shared header becomes 0 once an element can't use it.
+static void _merge_shared_element_header(const Variant &p_value, Variant::Type p_type, bool p_full_objects, uint32_t &r_shared_header) {
+	if (r_shared_header == 0) {
+		return;
+	}
+
+	uint32_t header = _encode_variant_header(p_value, p_full_objects);
+	if ((header & HEADER_TYPE_MASK) != uint32_t(p_type)) {
+		r_shared_header = 0;
+		return;
+	}
+	r_shared_header |= header;
+}
+
+static Error _encode_variant_to_buffer(const Variant &p_variant, LocalVector<uint8_t> &r_buffer, bool p_full_objects, bool p_omit_element_headers, uint32_t p_max_size, int p_depth) {
+	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Potential infinite recursion detected. Bailing.");
+
+	// Test for potential wrong values sent by the debugger when it breaks.
+	if (p_variant.get_type() == Variant::OBJECT && !p_variant.get_validated_object()) {
+		// Object is invalid, send a nullptr instead.
+		encode_uint32(Variant::NIL, _buffer_append(r_buffer, 4));
+		return OK;
+	}
+
+	uint32_t header = _encode_variant_header(p_variant, p_full_objects);
+
+	switch (p_variant.get_type()) {
+		case Variant::DICTIONARY: {
+			const Dictionary dict = p_variant;
+			const ContainerType key_type = dict.get_key_type();
+			const ContainerType value_type = dict.get_value_type();
+
+			uint32_t key_header = 0;
+			uint32_t value_header = 0;
+			if (p_omit_element_headers && !dict.is_empty()) {
+				key_header = _is_shareable_header_type(key_type.builtin_type) ? uint32_t(key_type.builtin_type) : 0;
+				value_header = _is_shareable_header_type(value_type.builtin_type) ? uint32_t(value_type.builtin_type) : 0;
+				if (key_header || value_header) {
+					for (const KeyValue<Variant, Variant> &kv : dict) {
+						_merge_shared_element_header(kv.key, key_type.builtin_type, p_full_objects, key_header);
+						_merge_shared_element_header(kv.value, value_type.builtin_type, p_full_objects, value_header);
+					}
+				}
+				if (key_header || value_header) {
+					header |= HEADER_DATA_FLAG_OMIT_ELEMENT_HEADERS;
+				}
+			}
+
+			encode_uint32(header, _buffer_append(r_buffer, 4));
+
+			Error err = _encode_container_type_to_buffer(key_type, r_buffer, p_full_objects);
+			ERR_FAIL_COND_V(err, err);
+			err = _encode_container_type_to_buffer(value_type, r_buffer, p_full_objects);
+			ERR_FAIL_COND_V(err, err);
+
+			encode_uint32(uint32_t(dict.size()), _buffer_append(r_buffer, 4));
+			if (header & HEADER_DATA_FLAG_OMIT_ELEMENT_HEADERS) {
+				uint8_t *buf = _buffer_append(r_buffer, 8);
+				encode_uint32(key_header, buf);
+				encode_uint32(value_header, buf + 4);
+			}
+
+			for (const KeyValue<Variant, Variant> &kv : dict) {
+				if (key_header) {
+					err = _encode_variant_data_to_buffer(kv.key, key_header, r_buffer, p_full_objects, p_max_size, p_depth + 1);
+				} else {
+					err = _encode_variant_to_buffer(kv.key, r_buffer, p_full_objects, p_omit_element_headers, p_max_size, p_depth + 1);
+				}
+				if (err) {
+					return err; // Already reported, or the size limit was hit.
+				}
+
+				if (value_header) {
+					err = _encode_variant_data_to_buffer(kv.value, value_header, r_buffer, p_full_objects, p_max_size, p_depth + 1);
+				} else {
+					err = _encode_variant_to_buffer(kv.value, r_buffer, p_full_objects, p_omit_element_headers, p_max_size, p_depth + 1);
+				}
+				if (err) {
+					return err; // Already reported, or the size limit was hit.
+				}
+			}
+		} break;
+		case Variant::ARRAY: {
+			const Array array = p_variant;
+			const ContainerType type = array.get_element_type();
+
+			uint32_t elem_header = 0;
+			if (p_omit_element_headers && !array.is_empty() && _is_shareable_header_type(type.builtin_type)) {
+				elem_header = type.builtin_type;
+				for (const Variant &elem : array) {
+					_merge_shared_element_header(elem, type.builtin_type, p_full_objects, elem_header);
+				}
+				if (elem_header) {
+					header |= HEADER_DATA_FLAG_OMIT_ELEMENT_HEADERS;
+				}
+			}
+
+			encode_uint32(header, _buffer_append(r_buffer, 4));
+
+			Error err = _encode_container_type_to_buffer(type, r_buffer, p_full_objects);
+			ERR_FAIL_COND_V(err, err);
+
+			encode_uint32(uint32_t(array.size()), _buffer_append(r_buffer, 4));
+			if (elem_header) {
+				encode_uint32(elem_header, _buffer_append(r_buffer, 4));
+			}
+
+			for (const Variant &elem : array) {
+				if (elem_header) {
+					err = _encode_variant_data_to_buffer(elem, elem_header, r_buffer, p_full_objects, p_max_size, p_depth + 1);
+				} else {
+					err = _encode_variant_to_buffer(elem, r_buffer, p_full_objects, p_omit_element_headers, p_max_size, p_depth + 1);
+				}
+				if (err) {
+					return err; // Already reported, or the size limit was hit.
+				}
+			}
+		} break;
+		default: {
+			encode_uint32(header, _buffer_append(r_buffer, 4));
+			return _encode_variant_data_to_buffer(p_variant, header, r_buffer, p_full_objects, p_max_size, p_depth);
+		} break;
+	}
+
+	return OK;
+}
+
+Error encode_variant_to_buffer(const Variant &p_variant, LocalVector<uint8_t> &r_buffer, bool p_full_objects, bool p_omit_element_headers, uint32_t p_max_size) {
+	const uint32_t start = r_buffer.size();
+	Error err = _encode_variant_to_buffer(p_variant, r_buffer, p_full_objects, p_omit_element_headers, start + MIN(p_max_size, UINT32_MAX - start), 0);
+	if (err) {
+		r_buffer.resize(start);
+	}
+	return err;
+}
+
+// Encodes the data following a variant header. `r_len` is incremented by the amount of data written.
+static Error _encode_variant_data(const Variant &p_variant, uint32_t p_header, uint8_t *r_buffer, int &r_len, bool p_full_objects, int p_depth) {
+	uint8_t *buf = r_buffer;
+
 	switch (p_variant.get_type()) {
 		case Variant::NIL: {
 			// Nothing to do.
@@ -1448,7 +1853,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 
 		} break;
 		case Variant::INT: {
-			if (header & HEADER_DATA_FLAG_64) {
+			if (p_header & HEADER_DATA_FLAG_64) {
 				// 64 bits.
 				if (buf) {
 					encode_uint64(p_variant.operator uint64_t(), buf);
@@ -1464,7 +1869,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			}
 		} break;
 		case Variant::FLOAT: {
-			if (header & HEADER_DATA_FLAG_64) {
+			if (p_header & HEADER_DATA_FLAG_64) {
 				if (buf) {
 					encode_double(p_variant.operator double(), buf);
 				}
@@ -32,6 +32,7 @@
 
 #include "core/math/math_defs.h"
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
 #include "core/typedefs.h"
 #include "core/variant/variant.h"
 
@@ -222,4 +223,13 @@ public:
 Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len = nullptr, bool p_allow_objects = false, int p_depth = 0);
 Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects = false, int p_depth = 0);
 
+// Appends the encoded variant to `r_buffer` in a single pass. Unless `p_omit_element_headers` is `true`,
+// the output is the same as `encode_variant()`. When it is, containers typed with a basic type write
+// their element header once instead of per element; `decode_variant()` reads both forms.
+// Encoding stops with `ERR_OUT_OF_MEMORY` as soon as more than `p_max_size` bytes would be appended.
+Error encode_variant_to_buffer(const Variant &p_variant, LocalVector<uint8_t> &r_buffer, bool p_full_objects = false, bool p_omit_element_headers = false, uint32_t p_max_size = UINT32_MAX);
+// Like `decode_variant()`, but when `r_variant` already holds an array or dictionary with the encoded typing,
+// its contents are updated in place (recursively) instead of allocating a new container.
+Error decode_variant_in_place(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len = nullptr, bool p_allow_objects = false, int p_depth = 0);
+
 Vector<float> vector3_to_float32_array(const Vector3 *vecs, size_t count);
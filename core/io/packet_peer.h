@@ -33,6 +33,7 @@
 #include "core/extension/ext_wrappers.gen.h"
 #include "core/io/stream_peer.h"
 #include "core/object/gdvirtual.gen.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/ring_buffer.h"
 #include "core/variant/native_ptr.h"
 
@@ -50,7 +51,7 @@ class PacketPeer : public RefCounted {
 	mutable Error last_get_error = OK;
 
 	int encode_buffer_max_size = 8 * 1024 * 1024;
-	Vector<uint8_t> encode_buffer;
+	LocalVector<uint8_t> encode_buffer;
 
 public:
 	virtual int get_available_packet_count() const = 0;
@@ -374,6 +374,7 @@ Variant Resource::_duplicate_recursive(const Variant &p_variant, const Duplicate
 }
 
 Ref<Resource> Resource::_duplicate(const DuplicateParams &p_params) const {
+	const_cast<Resource *>(this)->materialize();
 	ERR_FAIL_COND_V_MSG(p_params.local_scene && p_params.subres_mode != RESOURCE_DEEP_DUPLICATE_MAX, Ref<Resource>(), "Duplication for local-to-scene can't specify a deep duplicate mode.");
 
 	DuplicateRemapCacheT *remap_cache_backup = thread_duplicate_remap_cache;
@@ -627,6 +628,119 @@ RID Resource::get_rid() const {
 	return ret;
 }
 
+static uint64_t _estimate_variant_memory_usage(const Variant &p_value) {
+	switch (p_value.get_type()) {
+		case Variant::STRING:
+			return ((const String &)p_value).length() * sizeof(char32_t);
+		case Variant::PACKED_BYTE_ARRAY:
+			return ((const PackedByteArray &)p_value).size();
+		case Variant::PACKED_INT32_ARRAY:
+			return ((const PackedInt32Array &)p_value).size() * sizeof(int32_t);
+		case Variant::PACKED_INT64_ARRAY:
+			return ((const PackedInt64Array &)p_value).size() * sizeof(int64_t);
+		case Variant::PACKED_FLOAT32_ARRAY:
+			return ((const PackedFloat32Array &)p_value).size() * sizeof(float);
+		case Variant::PACKED_FLOAT64_ARRAY:
+			return ((const PackedFloat64Array &)p_value).size() * sizeof(double);
+		case Variant::PACKED_STRING_ARRAY:
+			return ((const PackedStringArray &)p_value).size() * sizeof(String);
+		case Variant::PACKED_VECTOR2_ARRAY:
+			return ((const PackedVector2Array &)p_value).size() * sizeof(Vector2);
+		case Variant::PACKED_VECTOR3_ARRAY:
+			return ((const PackedVector3Array &)p_value).size() * sizeof(Vector3);
+		case Variant::PACKED_COLOR_ARRAY:
+			return ((const PackedColorArray &)p_value).size() * sizeof(Color);
+		case Variant::PACKED_VECTOR4_ARRAY:
+			return ((const PackedVector4Array &)p_value).size() * sizeof(Vector4);
+		case Variant::ARRAY: {
+			const Array array = p_value;
+			uint64_t size = array.size() * sizeof(Variant);
+			for (const Variant &E : array) {
+				if (E.get_type() != Variant::OBJECT) {
+					size += _estimate_variant_memory_usage(E);
+				}
+			}
+			return size;
+		}
+		case Variant::DICTIONARY: {
+			const Dictionary dict = p_value;
+			uint64_t size = dict.size() * sizeof(KeyValue<Variant, Variant>);
+			for (const KeyValue<Variant, Variant> &kv : dict) {
+				if (kv.key.get_type() != Variant::OBJECT) {
+					size += _estimate_variant_memory_usage(kv.key);
+				}
+				if (kv.value.get_type() != Variant::OBJECT) {
+					size += _estimate_variant_memory_usage(kv.value);
+				}
+			}
+			return size;
+		}
+		default:
+			return 0;
+	}
+}
+
+Error ResourceLazyData::materialize(Resource *p_resource) {
+	if (is_materialized()) {
+		return OK;
+	}
+
+	// Threads racing to materialize the same resource all read it, the first one done applies it.
+	// Waiting for another thread's read instead could deadlock, as it may be loading a dependency
+	// that needs this very resource.
+	Ref<RefCounted> properties;
+	Error err = _read(properties);
+
+	MutexLock lock(apply_mutex);
+	if (state.get() != STATE_LAZY) {
+		return OK; // Applied by another thread meanwhile, or being applied by this one (from a setter).
+	}
+	state.set(STATE_APPLYING);
+	if (err == OK) {
+		err = _apply(p_resource, properties);
+	}
+	state.set(STATE_MATERIALIZED); // Even on failure, so a broken file isn't read again on every use.
+	return err;
+}
+
+void Resource::set_lazy_data(const Ref<ResourceLazyData> &p_lazy_data) {
+	lazy_data = p_lazy_data;
+}
+
+bool Resource::is_materialized() const {
+	return lazy_data.is_null() || lazy_data->is_materialized();
+}
+
+Error Resource::materialize() {
+	if (lazy_data.is_null()) {
+		return OK;
+	}
+	return lazy_data->materialize(this);
+}
+
+void Resource::add_loaded_property(const Variant &p_value) {
+	loaded_property_size += _estimate_variant_memory_usage(p_value);
+	loaded_property_size_valid = true;
+}
+
+uint64_t Resource::get_memory_usage_estimate() const {
+	// Only counts the stored data held in properties, which dominates for most resources.
+	if (loaded_property_size_valid) {
+		// Measured while loading, which avoids copying every property out again.
+		return sizeof(Resource) + loaded_property_size;
+	}
+
+	uint64_t size = sizeof(Resource);
+	List<PropertyInfo> plist;
+	get_property_list(&plist);
+	for (const PropertyInfo &E : plist) {
+		if (E.usage & PROPERTY_USAGE_STORAGE) {
+			size += _estimate_variant_memory_usage(get(E.name));
+		}
+	}
+	return size;
+}
+
 #ifdef TOOLS_ENABLED
 
 uint32_t Resource::hash_edited_version_for_preview() const {
@@ -749,6 +863,9 @@ void Resource::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("is_built_in"), &Resource::is_built_in);
 
+	ClassDB::bind_method(D_METHOD("is_materialized"), &Resource::is_materialized);
+	ClassDB::bind_method(D_METHOD("materialize"), &Resource::materialize);
+
 	ClassDB::bind_static_method("Resource", D_METHOD("generate_scene_unique_id"), &Resource::generate_scene_unique_id);
 	ClassDB::bind_method(D_METHOD("set_scene_unique_id", "id"), &Resource::set_scene_unique_id);
 	ClassDB::bind_method(D_METHOD("get_scene_unique_id"), &Resource::get_scene_unique_id);
@@ -802,6 +919,12 @@ Resource::~Resource() {
 }
 
 HashMap<String, Resource *> ResourceCache::resources;
+HashSet<String> ResourceCache::streamable_paths;
+List<ResourceCache::StreamingEntry> ResourceCache::streaming_lru;
+HashMap<Resource *, List<ResourceCache::StreamingEntry>::Element *> ResourceCache::streaming_entries;
+uint64_t ResourceCache::streaming_budget = 0;
+uint64_t ResourceCache::streaming_memory_usage = 0;
+uint64_t ResourceCache::streaming_eviction_count = 0;
 #ifdef TOOLS_ENABLED
 HashMap<String, HashMap<String, String>> ResourceCache::resource_path_cache;
 #endif
@@ -812,6 +935,12 @@ RWLock ResourceCache::path_cache_lock;
 #endif
 
 void ResourceCache::clear() {
+	// Release retained resources first, so they don't show up as leaked.
+	streaming_entries.clear();
+	streaming_lru.clear();
+	streaming_memory_usage = 0;
+	streamable_paths.clear();
+
 	if (!resources.is_empty()) {
 		if (OS::get_singleton()->is_stdout_verbose()) {
 			ERR_PRINT(vformat("%d resources still in use at exit.", resources.size()));
@@ -897,3 +1026,117 @@ int ResourceCache::get_cached_resource_count() {
 	MutexLock mutex_lock(lock);
 	return resources.size();
 }
+
+bool ResourceCache::_is_streamable_cached(Resource *p_resource) {
+	const String &path = p_resource->path_cache;
+	if (path.is_empty() || !streamable_paths.has(path)) {
+		return false;
+	}
+
+	// Copies loaded ignoring the cache are not retained.
+	Resource **res = resources.getptr(path);
+	return res && *res == p_resource;
+}
+
+void ResourceCache::_evict_streaming(uint64_t p_budget, LocalVector<Ref<Resource>> &r_evicted) {
+	while (streaming_memory_usage > p_budget && !streaming_lru.is_empty()) {
+		StreamingEntry &entry = streaming_lru.front()->get();
+		streaming_memory_usage -= entry.size;
+		streaming_entries.erase(entry.resource.ptr());
+		r_evicted.push_back(entry.resource);
+		streaming_lru.pop_front();
+		streaming_eviction_count++;
+	}
+}
+
+void ResourceCache::set_streaming_budget(uint64_t p_bytes) {
+	LocalVector<Ref<Resource>> evicted; // Released once unlocked.
+	MutexLock mutex_lock(lock);
+	streaming_budget = p_bytes;
+	_evict_streaming(p_bytes, evicted);
+}
+
+uint64_t ResourceCache::get_streaming_budget() {
+	MutexLock mutex_lock(lock);
+	return streaming_budget;
+}
+
+void ResourceCache::set_streamable(const String &p_path, bool p_streamable) {
+	Ref<Resource> released; // Released once unlocked.
+	MutexLock mutex_lock(lock);
+
+	if (p_streamable) {
+		streamable_paths.insert(p_path);
+		return;
+	}
+
+	streamable_paths.erase(p_path);
+	Resource **res = resources.getptr(p_path);
+	if (!res) {
+		return;
+	}
+	List<StreamingEntry>::Element **E = streaming_entries.getptr(*res);
+	if (E) {
+		streaming_memory_usage -= (*E)->get().size;
+		released = (*E)->get().resource;
+		streaming_lru.erase(*E);
+		streaming_entries.erase(*res);
+	}
+}
+
+bool ResourceCache::is_streamable(const String &p_path) {
+	MutexLock mutex_lock(lock);
+	return streamable_paths.has(p_path);
+}
+
+void ResourceCache::touch(const Ref<Resource> &p_resource) {
+	if (p_resource.is_null()) {
+		return;
+	}
+
+	{
+		MutexLock mutex_lock(lock);
+		if (streaming_budget == 0) {
+			return;
+		}
+		List<StreamingEntry>::Element **E = streaming_entries.getptr(p_resource.ptr());
+		if (E) {
+			streaming_lru.move_to_back(*E);
+			return;
+		}
+		if (!_is_streamable_cached(p_resource.ptr())) {
+			return;
+		}
+	}
+
+	// Estimated without the lock, as it may end up calling into scripts.
+	const uint64_t size = p_resource->get_memory_usage_estimate();
+
+	LocalVector<Ref<Resource>> evicted; // Released once unlocked.
+	MutexLock mutex_lock(lock);
+	if (streaming_budget == 0 || streaming_entries.has(p_resource.ptr()) || !_is_streamable_cached(p_resource.ptr())) {
+		return;
+	}
+
+	StreamingEntry entry;
+	entry.resource = p_resource;
+	entry.size = size;
+	streaming_entries.insert(p_resource.ptr(), streaming_lru.push_back(entry));
+	streaming_memory_usage += size;
+	_evict_streaming(streaming_budget, evicted);
+}
+
+uint64_t ResourceCache::get_streaming_memory_usage() {
+	MutexLock mutex_lock(lock);
+	return streaming_memory_usage;
+}
+
+int ResourceCache::get_streaming_resource_count() {
+	MutexLock mutex_lock(lock);
+	return streaming_entries.size();
+}
+
+uint64_t ResourceCache::get_streaming_eviction_count() {
+	MutexLock mutex_lock(lock);
+	return streaming_eviction_count;
+}
@@ -33,6 +33,10 @@
 #include "core/io/resource_uid.h" // IWYU pragma: export. Make available to all resources.
 #include "core/object/gdvirtual.gen.h"
 #include "core/object/ref_counted.h"
+#include "core/os/mutex.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/safe_refcount.h"
+#include "core/templates/list.h"
 #include "core/templates/self_list.h"
 
 class Node;
@@ -49,6 +53,33 @@ public: \
 \
 private:
 
+class Resource;
+
+// Lets a loader defer reading the properties of a resource until it's used, see `Resource::materialize()`.
+class ResourceLazyData : public RefCounted {
+	GDSOFTCLASS(ResourceLazyData, RefCounted);
+
+	enum State {
+		STATE_LAZY,
+		STATE_APPLYING,
+		STATE_MATERIALIZED,
+	};
+
+	SafeNumeric<uint32_t> state;
+	Mutex apply_mutex; // Only held while setting the properties, never while reading them.
+
+protected:
+	// Reads the properties without touching the resource. Dependencies may be loaded meanwhile, so this
+	// runs without any lock held, and possibly on several threads at once.
+	virtual Error _read(Ref<RefCounted> &r_properties) = 0;
+	// Sets the properties returned by `_read()`. Called once, by the first thread done reading.
+	virtual Error _apply(Resource *p_resource, const Ref<RefCounted> &p_properties) = 0;
+
+public:
+	bool is_materialized() const { return state.get() == STATE_MATERIALIZED; }
+	Error materialize(Resource *p_resource);
+};
+
 class Resource : public RefCounted {
 	GDCLASS(Resource, RefCounted);
 
@@ -91,6 +122,11 @@ private:
 
 	SelfList<Resource> remapped_list;
 
+	Ref<ResourceLazyData> lazy_data; // Set before the resource is shared, never changed after.
+
+	uint64_t loaded_property_size = 0;
+	bool loaded_property_size_valid = false;
+
 	using DuplicateRemapCacheT = HashMap<Ref<Resource>, Ref<Resource>>;
 	static thread_local inline DuplicateRemapCacheT *thread_duplicate_remap_cache = nullptr;
 	static thread_local inline bool thread_duplicate_remap_cache_needs_deallocation = true;
@@ -181,7 +217,13 @@ public:
 
 	void set_as_translation_remapped(bool p_remapped);
 
+	void set_lazy_data(const Ref<ResourceLazyData> &p_lazy_data); // For loaders, before the resource is shared.
+	bool is_materialized() const;
+	Error materialize();
+
 	virtual RID get_rid() const; // Some resources may offer conversion to RID.
+	void add_loaded_property(const Variant &p_value); // For loaders, accounts for the value in the memory usage estimate.
+	virtual uint64_t get_memory_usage_estimate() const; // Used to account for streamed resources.
 
 	// Helps keep IDs the same when loading/saving scenes. An empty ID clears the entry, and an empty ID is returned when not found.
 	static void set_resource_id_for_path(const String &p_referrer_path, const String &p_resource_path, const String &p_id);
@@ -207,9 +249,34 @@ class ResourceCache {
 	static void clear();
 	friend void register_core_types();
 
+	// Streamable resources are kept alive after their last use, until the budget is exceeded.
+	struct StreamingEntry {
+		Ref<Resource> resource;
+		uint64_t size = 0;
+	};
+	static HashSet<String> streamable_paths;
+	static List<StreamingEntry> streaming_lru; // Least recently used first.
+	static HashMap<Resource *, List<StreamingEntry>::Element *> streaming_entries;
+	static uint64_t streaming_budget;
+	static uint64_t streaming_memory_usage;
+	static uint64_t streaming_eviction_count;
+
+	static bool _is_streamable_cached(Resource *p_resource);
+	static void _evict_streaming(uint64_t p_budget, LocalVector<Ref<Resource>> &r_evicted);
+
 public:
 	static bool has(const String &p_path);
 	static Ref<Resource> get_ref(const String &p_path);
 	static void get_cached_resources(List<Ref<Resource>> *p_resources);
 	static int get_cached_resource_count();
+
+	static void set_streaming_budget(uint64_t p_bytes); // Zero disables streaming.
+	static uint64_t get_streaming_budget();
+	static void set_streamable(const String &p_path, bool p_streamable);
+	static bool is_streamable(const String &p_path);
+	static void touch(const Ref<Resource> &p_resource); // Marks a resource as used, retaining it if streamable.
+
+	static uint64_t get_streaming_memory_usage();
+	static int get_streaming_resource_count();
+	static uint64_t get_streaming_eviction_count();
 };
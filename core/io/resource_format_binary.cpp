@@ -33,6 +33,7 @@
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access_compressed.h"
+#include "core/io/file_access_memory.h"
 #include "core/io/missing_resource.h"
 #include "core/object/class_db.h"
 #include "core/object/script_language.h"
@@ -43,6 +44,35 @@
 //#define print_bl(m_what) print_line(m_what)
 #define print_bl(m_what) (void)(m_what)
 
+class ResourceLazyDataBinary : public ResourceLazyData {
+	GDSOFTCLASS(ResourceLazyDataBinary, ResourceLazyData);
+
+	class Properties : public RefCounted {
+		GDSOFTCLASS(Properties, RefCounted);
+
+	public:
+		LocalVector<ResourceLoaderBinary::DecodedProperty> properties;
+	};
+
+protected:
+	virtual Error _read(Ref<RefCounted> &r_properties) override {
+		Ref<Properties> read;
+		read.instantiate();
+		r_properties = read;
+		return ResourceLoaderBinary::_read_lazy_resource(context, index, read->properties);
+	}
+
+	virtual Error _apply(Resource *p_resource, const Ref<RefCounted> &p_properties) override {
+		Ref<Properties> read = p_properties;
+		ERR_FAIL_COND_V(read.is_null(), ERR_BUG);
+		return ResourceLoaderBinary::_apply_lazy_resource(p_resource, read->properties);
+	}
+
+public:
+	Ref<ResourceLoaderBinary::LazyContext> context;
+	int index = 0;
+};
+
 enum {
 	//numbering must be different from variant, in case new variant types are added (variant must be always contiguous for jumptable optimization)
 	VARIANT_NIL = 1,
@@ -376,6 +406,19 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		case VARIANT_OBJECT: {
 			uint32_t objtype = f->get_32();
 
+			if (defer_object_references && objtype != OBJECT_EMPTY) {
+				// Only skip the reference, the value is parsed again once resources can be resolved.
+				object_reference_deferred = true;
+				if (objtype == OBJECT_EXTERNAL_RESOURCE) {
+					_skip_unicode_string();
+					_skip_unicode_string();
+				} else {
+					ERR_FAIL_COND_V(objtype != OBJECT_INTERNAL_RESOURCE && objtype != OBJECT_EXTERNAL_RESOURCE_INDEX, ERR_FILE_CORRUPT);
+					f->get_32();
+				}
+				break;
+			}
+
 			switch (objtype) {
 				case OBJECT_EMPTY: {
 					//do none
@@ -393,11 +436,13 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 					}
 
 					//always use internal cache for loading internal resources
-					if (!internal_index_cache.has(path)) {
+					if (internal_index_cache.has(path)) {
+						r_v = internal_index_cache[path];
+					} else if (lazy_context.is_valid()) {
+						r_v = _create_lazy_resource(index);
+					} else {
 						WARN_PRINT(vformat("Couldn't load resource (no cache): %s.", path));
 						r_v = Variant();
-					} else {
-						r_v = internal_index_cache[path];
 					}
 				} break;
 				case OBJECT_EXTERNAL_RESOURCE: {
@@ -432,6 +477,10 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 						r_v = Variant();
 					} else {
 						Ref<ResourceLoader::LoadToken> &load_token = external_resources.write[erindex].load_token;
+						if (load_token.is_null() && lazy_context.is_valid()) {
+							// Dependencies of lazily loaded files are only loaded once used.
+							load_token = ResourceLoader::_load_start(external_resources[erindex].path, external_resources[erindex].type, ResourceLoader::LOAD_THREAD_FROM_CURRENT, cache_mode_for_external);
+						}
 						if (load_token.is_valid()) { // If not valid, it's OK since then we know this load accepts broken dependencies.
 							Error err;
 							Ref<Resource> res = ResourceLoader::_load_complete(*load_token.ptr(), &err);
@@ -618,11 +667,7 @@ Ref<Resource> ResourceLoaderBinary::get_resource() {
 	return resource;
 }
 
-Error ResourceLoaderBinary::load() {
-	if (error != OK) {
-		return error;
-	}
-
+void ResourceLoaderBinary::_resolve_external_paths() {
 	for (int i = 0; i < external_resources.size(); i++) {
 		String path = external_resources[i].path;
 
@@ -636,17 +681,365 @@ Error ResourceLoaderBinary::load() {
 		}
 
 		external_resources.write[i].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
-		external_resources.write[i].load_token = ResourceLoader::_load_start(path, external_resources[i].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, cache_mode_for_external);
-		if (external_resources[i].load_token.is_null()) {
-			if (!ResourceLoader::get_abort_on_missing_resources()) {
-				ResourceLoader::notify_dependency_error(local_path, path, external_resources[i].type);
+	}
+}
+
+void ResourceLoaderBinary::_resolve_internal_paths() {
+	for (int i = 0; i < internal_resources.size() - 1; i++) {
+		const String &path = internal_resources[i].path;
+		if (path.begins_with("local://")) {
+			internal_resources.write[i].path = res_path + "::" + path.replace_first("local://", "");
+		}
+	}
+}
+
+Ref<Resource> ResourceLoaderBinary::_create_lazy_resource(int p_index) {
+	const String path = internal_resources[p_index].path;
+	// Loaders materializing other sub-resources of the file may create the same one at the same time.
+	MutexLock lock(lazy_context->mutex);
+	Ref<Resource> res = ResourceCache::get_ref(path);
+
+	if (res.is_null()) {
+		const uint64_t position = f->get_position();
+		f->seek(internal_resources[p_index].offset);
+		const String t = get_unicode_string();
+		f->seek(position);
+
+		Object *obj = ClassDB::instantiate(t);
+		res = Object::cast_to<Resource>(obj);
+		if (res.is_null()) {
+			if (obj) {
+				memdelete(obj);
+			}
+			WARN_PRINT(vformat("'%s': Can't create sub-resource of type '%s'.", local_path, t));
+			return res;
+		}
+
+		Ref<ResourceLazyDataBinary> lazy_data;
+		lazy_data.instantiate();
+		lazy_data->context = lazy_context;
+		lazy_data->index = p_index;
+		res->set_lazy_data(lazy_data);
+		res->set_path(path);
+		res->set_scene_unique_id(path.get_slice("::", 1));
+		if (lazy_context->loading) {
+			lazy_context->created.push_back(res);
+		}
+	}
+
+	internal_index_cache[path] = res;
+	return res;
+}
+
+Error ResourceLoaderBinary::_read_lazy_resource(const Ref<LazyContext> &p_context, int p_index, LocalVector<DecodedProperty> &r_properties) {
+	Error err;
+	Ref<FileAccess> file = FileAccess::open(p_context->file_path, FileAccess::READ, &err);
+	ERR_FAIL_COND_V_MSG(file.is_null(), err, vformat("Cannot open file '%s'.", p_context->file_path));
+
+	// The tables are read again, so nothing from the initial load needs to be kept around.
+	ResourceLoaderBinary loader;
+	loader.local_path = p_context->local_path;
+	loader.res_path = p_context->res_path;
+	loader.remaps = p_context->remaps;
+	loader.cache_mode_for_external = p_context->cache_mode_for_external;
+	loader.lazy_context = p_context;
+	loader.open(file);
+	ERR_FAIL_COND_V(loader.error != OK, loader.error);
+	ERR_FAIL_INDEX_V(p_index, loader.internal_resources.size() - 1, ERR_FILE_CORRUPT);
+
+	loader._resolve_external_paths();
+	loader._resolve_internal_paths();
+
+	loader.f->seek(loader.internal_resources[p_index].offset);
+	loader._skip_unicode_string(); // Type, the resource already exists.
+	const uint32_t pc = loader.f->get_32();
+	ERR_FAIL_COND_V(loader.f->eof_reached(), ERR_FILE_CORRUPT);
+
+	r_properties.resize(pc);
+	for (DecodedProperty &property : r_properties) {
+		property.name = loader._get_string();
+		ERR_FAIL_COND_V(property.name == StringName(), ERR_FILE_CORRUPT);
+		Error err = loader.parse_variant(property.value);
+		if (err != OK) {
+			return err;
+		}
+	}
+	return OK;
+}
+
+Error ResourceLoaderBinary::_apply_lazy_resource(Resource *p_resource, const LocalVector<DecodedProperty> &p_properties) {
+	// Only sets the values that were already read, nothing is parsed from a file.
+	ResourceLoaderBinary applier;
+	DecodeTask decoded;
+	decoded.properties = p_properties;
+	return applier._parse_resource_properties(Ref<Resource>(p_resource), Ref<MissingResource>(), &decoded);
+}
+
+void ResourceLoaderBinary::_materialize_lazy_resource_task(void *p_userdata) {
+	Resource *resource = (Resource *)p_userdata;
+	resource->materialize();
+}
+
+void ResourceLoaderBinary::_materialize_created_lazy_resources() {
+	// Shells can't intercept access to their properties, so the ones reachable from the main resource
+	// are materialized before it's returned. Each is read from its own view of the file, in parallel,
+	// and creates shells for the sub-resources it references, which are materialized next.
+	while (true) {
+		LocalVector<Ref<Resource>> shells;
+		{
+			MutexLock lock(lazy_context->mutex);
+			shells = std::move(lazy_context->created);
+			lazy_context->created.clear();
+			if (shells.is_empty()) {
+				lazy_context->loading = false;
+				break;
+			}
+		}
+
+		LocalVector<WorkerThreadPool::TaskID> tasks;
+		tasks.resize(shells.size());
+		for (uint32_t i = 0; i < shells.size(); i++) {
+			tasks[i] = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoaderBinary::_materialize_lazy_resource_task, shells[i].ptr(), false, "Materialize binary sub-resource");
+		}
+		for (WorkerThreadPool::TaskID task : tasks) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(task);
+		}
+	}
+}
+
+Error ResourceLoaderBinary::load() {
+	if (error != OK) {
+		return error;
+	}
+
+	_resolve_external_paths();
+
+	if (lazy_context.is_valid() && using_named_scene_ids && cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE) {
+		lazy_context->local_path = local_path;
+		lazy_context->res_path = res_path;
+		lazy_context->remaps = remaps;
+		lazy_context->cache_mode_for_external = cache_mode_for_external;
+		_resolve_internal_paths();
+	} else {
+		lazy_context.unref();
+	}
+
+	if (lazy_context.is_null()) {
+		if (!use_sub_threads) {
+			// The dependencies are loaded one after another below, get their files read in the meantime.
+			for (const ExtResource &er : external_resources) {
+				ResourceLoader::_prefetch_dependency(er.path);
+			}
+		}
+		for (int i = 0; i < external_resources.size(); i++) {
+			const String &path = external_resources[i].path;
+			external_resources.write[i].load_token = ResourceLoader::_load_start(path, external_resources[i].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, cache_mode_for_external);
+			if (external_resources[i].load_token.is_null()) {
+				if (!ResourceLoader::get_abort_on_missing_resources()) {
+					ResourceLoader::notify_dependency_error(local_path, path, external_resources[i].type);
+				} else {
+					error = ERR_FILE_MISSING_DEPENDENCIES;
+					ERR_FAIL_V_MSG(error, vformat("Can't load dependency: '%s'.", path));
+				}
+			}
+		}
+
+		_start_decode_tasks();
+	}
+
+	Error err = _load_internal_resources();
+	_finish_decode_tasks();
+	if (lazy_context.is_valid()) {
+		if (err == OK) {
+			_materialize_created_lazy_resources();
+		} else {
+			MutexLock lock(lazy_context->mutex);
+			lazy_context->created.clear(); // They reference the context.
+			lazy_context->loading = false;
+		}
+	}
+	return err;
+}
+
+void ResourceLoaderBinary::_decode_internal_resource(void *p_userdata) {
+	DecodeTask *task = (DecodeTask *)p_userdata;
+	const ResourceLoaderBinary *loader = task->loader;
+
+	Ref<FileAccessMemory> fa;
+	fa.instantiate();
+	fa->open_custom(loader->mapped_data.ptr(), loader->mapped_data.size());
+	fa->set_big_endian(loader->f->is_big_endian());
+	fa->real_is_double = loader->f->real_is_double;
+
+	// A loader of its own, only used for parsing.
+	ResourceLoaderBinary decoder;
+	decoder.f = fa;
+	decoder.ver_format = loader->ver_format;
+	decoder.string_map = loader->string_map;
+	decoder.local_path = loader->local_path;
+	decoder.res_path = loader->res_path;
+	decoder.defer_object_references = true;
+
+	fa->seek(task->offset);
+	task->type = decoder.get_unicode_string();
+	uint32_t pc = fa->get_32();
+	if (fa->eof_reached()) {
+		task->error = ERR_FILE_CORRUPT;
+		return;
+	}
+
+	task->properties.resize(pc);
+	for (DecodedProperty &property : task->properties) {
+		property.name = decoder._get_string();
+		if (property.name == StringName()) {
+			task->error = ERR_FILE_CORRUPT;
+			break;
+		}
+
+		const uint64_t value_offset = fa->get_position();
+		decoder.object_reference_deferred = false;
+		task->error = decoder.parse_variant(property.value);
+		if (task->error != OK) {
+			break;
+		}
+		if (decoder.object_reference_deferred) {
+			property.value = Variant();
+			property.deferred_offset = value_offset;
+		}
+	}
+
+	task->loader->decoded_count.increment();
+}
+
+void ResourceLoaderBinary::_start_decode_tasks() {
+	mapped_data = f->get_mapped_data();
+	if (mapped_data.is_empty()) {
+		return;
+	}
+
+	decode_tasks.resize(internal_resources.size());
+	for (int i = 0; i < internal_resources.size(); i++) {
+		const uint64_t offset = internal_resources[i].offset;
+		const uint64_t end = i + 1 < internal_resources.size() ? internal_resources[i + 1].offset : mapped_data.size();
+		if (end <= offset || end - offset < PARALLEL_DECODE_MIN_SIZE || end > mapped_data.size()) {
+			continue;
+		}
+
+		DecodeTask &task = decode_tasks[i];
+		task.loader = this;
+		task.offset = offset;
+		task.task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoaderBinary::_decode_internal_resource, &task, false, "Decode binary resource");
+		decode_task_count++;
+	}
+}
+
+void ResourceLoaderBinary::_finish_decode_tasks() {
+	for (DecodeTask &task : decode_tasks) {
+		if (task.task_id != WorkerThreadPool::INVALID_TASK_ID) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(task.task_id);
+		}
+	}
+	decode_tasks.reset();
+	decode_task_count = 0;
+}
+
+Error ResourceLoaderBinary::_parse_resource_properties(const Ref<Resource> &p_res, const Ref<MissingResource> &p_missing_resource, const DecodeTask *p_decoded) {
+	int pc = p_decoded ? (int)p_decoded->properties.size() : f->get_32();
+
+	//set properties
+
+	Dictionary missing_resource_properties;
+
+	for (int j = 0; j < pc; j++) {
+		StringName name;
+		Variant value;
+
+		if (p_decoded) {
+			const DecodedProperty &property = p_decoded->properties[j];
+			name = property.name;
+			if (property.deferred_offset) {
+				f->seek(property.deferred_offset);
+				error = parse_variant(value);
+				if (error) {
+					return error;
+				}
 			} else {
-				error = ERR_FILE_MISSING_DEPENDENCIES;
-				ERR_FAIL_V_MSG(error, vformat("Can't load dependency: '%s'.", path));
+				value = property.value;
+			}
+		} else {
+			name = _get_string();
+
+			if (name == StringName()) {
+				error = ERR_FILE_CORRUPT;
+				ERR_FAIL_V(ERR_FILE_CORRUPT);
+			}
+
+			error = parse_variant(value);
+			if (error) {
+				return error;
+			}
+		}
+
+		bool set_valid = true;
+		if (value.get_type() == Variant::OBJECT && p_missing_resource.is_null() && ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+			// If the property being set is a missing resource (and the parent is not),
+			// then setting it will most likely not work.
+			// Instead, save it as metadata.
+
+			Ref<MissingResource> mr = value;
+			if (mr.is_valid()) {
+				missing_resource_properties[name] = mr;
+				set_valid = false;
+			}
+		}
+
+		if (value.get_type() == Variant::ARRAY) {
+			Array set_array = value;
+			bool is_get_valid = false;
+			Variant get_value = p_res->get(name, &is_get_valid);
+			if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
+				Array get_array = get_value;
+				if (!set_array.is_same_typed(get_array)) {
+					value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
+				}
 			}
 		}
+
+		if (value.get_type() == Variant::DICTIONARY) {
+			Dictionary set_dict = value;
+			bool is_get_valid = false;
+			Variant get_value = p_res->get(name, &is_get_valid);
+			if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
+				Dictionary get_dict = get_value;
+				if (!set_dict.is_same_typed(get_dict)) {
+					value = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(),
+							get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
+				}
+			}
+		}
+
+		if (set_valid) {
+			p_res->set(name, value);
+			p_res->add_loaded_property(value);
+		}
 	}
 
+	if (p_missing_resource.is_valid()) {
+		p_missing_resource->set_recording_properties(false);
+	}
+
+	if (!missing_resource_properties.is_empty()) {
+		p_res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+	}
+
+#ifdef TOOLS_ENABLED
+	p_res->set_edited(false);
+#endif
+
+	return OK;
+}
+
+Error ResourceLoaderBinary::_load_internal_resources() {
 	for (int i = 0; i < internal_resources.size(); i++) {
 		bool main = i == (internal_resources.size() - 1);
 
@@ -674,17 +1067,34 @@ Error ResourceLoaderBinary::load() {
 					continue;
 				}
 			}
+
+			if (lazy_context.is_valid()) {
+				continue; // Created when referenced.
+			}
 		} else {
 			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
 				path = res_path;
 			}
 		}
 
-		uint64_t offset = internal_resources[i].offset;
-
-		f->seek(offset);
+		DecodeTask *decoded = nullptr;
+		if (i < (int)decode_tasks.size() && decode_tasks[i].task_id != WorkerThreadPool::INVALID_TASK_ID) {
+			decoded = &decode_tasks[i];
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(decoded->task_id);
+			decoded->task_id = WorkerThreadPool::INVALID_TASK_ID;
+			if (decoded->error != OK) {
+				error = decoded->error;
+				ERR_FAIL_V_MSG(error, vformat("'%s': Failed to decode resource of type '%s'.", local_path, decoded->type));
+			}
+		}
 
-		String t = get_unicode_string();
+		String t;
+		if (decoded) {
+			t = decoded->type;
+		} else {
+			f->seek(internal_resources[i].offset);
+			t = get_unicode_string();
+		}
 
 		Ref<Resource> res;
 		Resource *r = nullptr;
@@ -749,89 +1159,24 @@ Error ResourceLoaderBinary::load() {
 			internal_index_cache[path] = res;
 		}
 
-		int pc = f->get_32();
-
-		//set properties
-
-		Dictionary missing_resource_properties;
-
-		for (int j = 0; j < pc; j++) {
-			StringName name = _get_string();
-
-			if (name == StringName()) {
-				error = ERR_FILE_CORRUPT;
-				ERR_FAIL_V(ERR_FILE_CORRUPT);
-			}
-
-			Variant value;
-
-			error = parse_variant(value);
-			if (error) {
-				return error;
-			}
-
-			bool set_valid = true;
-			if (value.get_type() == Variant::OBJECT && missing_resource.is_null() && ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-				// If the property being set is a missing resource (and the parent is not),
-				// then setting it will most likely not work.
-				// Instead, save it as metadata.
-
-				Ref<MissingResource> mr = value;
-				if (mr.is_valid()) {
-					missing_resource_properties[name] = mr;
-					set_valid = false;
-				}
-			}
-
-			if (value.get_type() == Variant::ARRAY) {
-				Array set_array = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
-					Array get_array = get_value;
-					if (!set_array.is_same_typed(get_array)) {
-						value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
-					}
-				}
-			}
-
-			if (value.get_type() == Variant::DICTIONARY) {
-				Dictionary set_dict = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
-					Dictionary get_dict = get_value;
-					if (!set_dict.is_same_typed(get_dict)) {
-						value = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(),
-								get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
-					}
-				}
-			}
-
-			if (set_valid) {
-				res->set(name, value);
-			}
-		}
-
-		if (missing_resource.is_valid()) {
-			missing_resource->set_recording_properties(false);
+		error = _parse_resource_properties(res, missing_resource, decoded);
+		if (error) {
+			return error;
 		}
 
-		if (!missing_resource_properties.is_empty()) {
-			res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+		if (decoded) {
+			decoded->properties.reset(); // Release the decoded data early.
 		}
 
-#ifdef TOOLS_ENABLED
-		res->set_edited(false);
-#endif
-
 		if (progress) {
-			*progress = (i + 1) / float(internal_resources.size());
+			// Decoding ahead counts towards progress as well.
+			*progress = (decoded_count.get() + i + 1) / float(internal_resources.size() + decode_task_count);
 		}
 
 		resource_cache.push_back(res);
 
 		if (main) {
+			_finish_decode_tasks(); // Some may be left for resources found in the cache.
 			f.unref();
 			resource = res;
 			resource->set_as_translation_remapped(translation_remapped);
@@ -873,6 +1218,11 @@ String ResourceLoaderBinary::get_unicode_string() {
 	return String::utf8(&str_buf[0], len);
 }
 
+void ResourceLoaderBinary::_skip_unicode_string() {
+	const uint32_t len = f->get_32();
+	f->seek(f->get_position() + len);
+}
+
 void ResourceLoaderBinary::get_classes_used(Ref<FileAccess> p_f, HashSet<StringName> *p_classes) {
 	open(p_f, false, true);
 	if (error) {
@@ -1177,6 +1527,10 @@ Ref<Resource> ResourceFormatLoaderBinary::load(const String &p_path, const Strin
 	String path = !p_original_path.is_empty() ? p_original_path : p_path;
 	loader.local_path = ProjectSettings::get_singleton()->localize_path(path);
 	loader.res_path = loader.local_path;
+	if (ResourceLoader::is_lazy_subresource_loading(loader.local_path)) {
+		loader.lazy_context.instantiate();
+		loader.lazy_context->file_path = p_path;
+	}
 	loader.open(f);
 
 	err = loader.load();
@@ -2004,6 +2358,7 @@ void ResourceFormatSaverBinaryInstance::_find_resources(const Variant &p_variant
 			}
 
 			resource_set.insert(res);
+			res->materialize(); // Lazily loaded resources must be saved with their data.
 
 			List<PropertyInfo> property_list;
 
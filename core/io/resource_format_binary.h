@@ -33,7 +33,11 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rb_map.h"
+#include "core/templates/safe_refcount.h"
+
+class MissingResource;
 
 class ResourceLoaderBinary {
 	bool translation_remapped = false;
@@ -79,11 +83,35 @@ class ResourceLoaderBinary {
 	HashMap<String, Ref<Resource>> internal_index_cache;
 
 	String get_unicode_string();
+	void _skip_unicode_string();
 	void _advance_padding(uint32_t p_len);
 
 	HashMap<String, String> remaps;
 	Error error = OK;
 
+	// Sub-resources of files loaded lazily are only created when referenced, and only read when materialized.
+	class LazyContext : public RefCounted {
+		GDSOFTCLASS(LazyContext, RefCounted);
+
+	public:
+		String file_path;
+		String local_path;
+		String res_path;
+		HashMap<String, String> remaps;
+		ResourceFormatLoader::CacheMode cache_mode_for_external = ResourceFormatLoader::CACHE_MODE_REUSE;
+
+		Mutex mutex;
+		bool loading = true;
+		LocalVector<Ref<Resource>> created; // Shells to materialize before the initial load returns.
+	};
+
+	Ref<LazyContext> lazy_context;
+
+	void _resolve_external_paths();
+	void _resolve_internal_paths();
+	Ref<Resource> _create_lazy_resource(int p_index);
+	friend class ResourceLazyDataBinary;
+
 	ResourceFormatLoader::CacheMode cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE;
 	ResourceFormatLoader::CacheMode cache_mode_for_external = ResourceFormatLoader::CACHE_MODE_REUSE;
 
@@ -93,6 +121,42 @@ class ResourceLoaderBinary {
 
 	HashMap<String, Ref<Resource>> dependency_cache;
 
+	// Large internal resources are decoded ahead on worker threads, from the mapped file.
+	static constexpr uint64_t PARALLEL_DECODE_MIN_SIZE = 64 * 1024;
+
+	struct DecodedProperty {
+		StringName name;
+		Variant value;
+		uint64_t deferred_offset = 0; // Values referencing other resources are parsed again once those are loaded.
+	};
+
+	struct DecodeTask {
+		ResourceLoaderBinary *loader = nullptr;
+		uint64_t offset = 0;
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
+		String type;
+		LocalVector<DecodedProperty> properties;
+		Error error = OK;
+	};
+
+	bool defer_object_references = false;
+	bool object_reference_deferred = false;
+	Span<uint8_t> mapped_data;
+	LocalVector<DecodeTask> decode_tasks;
+	SafeNumeric<uint32_t> decoded_count;
+	uint32_t decode_task_count = 0;
+
+	static void _decode_internal_resource(void *p_userdata);
+	void _start_decode_tasks();
+	void _finish_decode_tasks();
+	Error _parse_resource_properties(const Ref<Resource> &p_res, const Ref<MissingResource> &p_missing_resource, const DecodeTask *p_decoded);
+
+	static Error _read_lazy_resource(const Ref<LazyContext> &p_context, int p_index, LocalVector<DecodedProperty> &r_properties);
+	static Error _apply_lazy_resource(Resource *p_resource, const LocalVector<DecodedProperty> &p_properties);
+	static void _materialize_lazy_resource_task(void *p_userdata);
+	void _materialize_created_lazy_resources();
+	Error _load_internal_resources();
+
 public:
 	Ref<Resource> get_resource();
 	Error load();
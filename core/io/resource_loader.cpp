@@ -35,6 +35,7 @@
 #include "core/core_bind.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/io/file_access_async.h"
 #include "core/io/resource_importer.h"
 #include "core/object/callable_mp.h"
 #include "core/object/class_db.h"
@@ -686,6 +687,39 @@ void ResourceLoader::_run_load_task(void *p_userdata) {
 	print_verbose(vformat("Completed load for: '%s' remapped '%s' at thread %d", load_task.local_path, remapped_path, thread_index));
 }
 
+void ResourceLoader::_prefetch_dependency(const String &p_path) {
+	// Only threaded loads, so that plain blocking loads (and tools that never load in threads) don't start the background readers.
+	if (!curr_load_task || curr_load_task->task_id == WorkerThreadPool::INVALID_TASK_ID) {
+		return;
+	}
+	FileAccessAsync *file_access_async = FileAccessAsync::get_singleton();
+	if (!file_access_async || p_path.is_empty() || ResourceCache::has(p_path)) {
+		return;
+	}
+
+	String path = _path_remap(p_path);
+	if (ResourceFormatImporter::get_singleton()->recognize_path(path)) {
+		path = ResourceFormatImporter::get_singleton()->get_internal_resource_path(path);
+	}
+	if (!path.is_empty()) {
+		file_access_async->prefetch(path);
+	}
+}
+
+void ResourceLoader::set_lazy_subresource_loading(const String &p_path, bool p_enabled) {
+	MutexLock lock(lazy_subresource_mutex);
+	if (p_enabled) {
+		lazy_subresource_paths.insert(p_path);
+	} else {
+		lazy_subresource_paths.erase(p_path);
+	}
+}
+
+bool ResourceLoader::is_lazy_subresource_loading(const String &p_path) {
+	MutexLock lock(lazy_subresource_mutex);
+	return lazy_subresource_paths.has(p_path);
+}
+
 String ResourceLoader::_validate_local_path(const String &p_path) {
 	ResourceUID::ID uid = ResourceUID::get_singleton()->text_to_id(p_path);
 	if (uid != ResourceUID::INVALID_ID) {
@@ -744,6 +778,11 @@ Ref<Resource> ResourceLoader::load(const String &p_path, const String &p_type_hi
 	}
 
 	Ref<Resource> res = _load_complete(*load_token.ptr(), r_error);
+	if (res.is_valid() && !res->is_materialized()) {
+		// Requested by the path of a sub-resource that was created lazily.
+		res->materialize();
+	}
+	ResourceCache::touch(res);
 	return res;
 }
 
@@ -997,6 +1036,10 @@ Ref<Resource> ResourceLoader::load_threaded_get(const String &p_path, Error *r_e
 
 	print_lt("GET: user load tokens: " + itos(user_load_tokens.size()));
 
+	if (res.is_valid() && !res->is_materialized()) {
+		res->materialize();
+	}
+	ResourceCache::touch(res);
 	return res;
 }
 
@@ -1780,6 +1823,8 @@ DependencyErrorNotify ResourceLoader::dep_err_notify = nullptr;
 
 bool ResourceLoader::create_missing_resources_if_class_unavailable = false;
 bool ResourceLoader::abort_on_missing_resource = true;
+HashSet<String> ResourceLoader::lazy_subresource_paths;
+Mutex ResourceLoader::lazy_subresource_mutex;
 bool ResourceLoader::timestamp_on_load = false;
 
 thread_local bool ResourceLoader::import_thread = false;
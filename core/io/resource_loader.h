@@ -146,6 +146,8 @@ public:
 
 	static Ref<LoadToken> _load_start(const String &p_path, const String &p_type_hint, LoadThreadMode p_thread_mode, CacheMode p_cache_mode, bool p_for_user = false);
 	static Ref<Resource> _load_complete(LoadToken &p_load_token, Error *r_error);
+	// Reads a dependency in the background, for loaders that know their dependencies before loading them one by one.
+	static void _prefetch_dependency(const String &p_path);
 
 private:
 	static LoadToken *_load_threaded_request_reuse_user_token(const String &p_path);
@@ -162,6 +164,8 @@ private:
 	static void *dep_err_notify_ud;
 	static DependencyErrorNotify dep_err_notify;
 	static bool abort_on_missing_resource;
+	static HashSet<String> lazy_subresource_paths;
+	static Mutex lazy_subresource_mutex;
 	static bool create_missing_resources_if_class_unavailable;
 	static HashMap<String, Vector<String>> translation_remaps;
 
@@ -295,6 +299,9 @@ public:
 	static void set_abort_on_missing_resources(bool p_abort) { abort_on_missing_resource = p_abort; }
 	static bool get_abort_on_missing_resources() { return abort_on_missing_resource; }
 
+	static void set_lazy_subresource_loading(const String &p_path, bool p_enabled);
+	static bool is_lazy_subresource_loading(const String &p_path);
+
 	static String path_remap(const String &p_path);
 	static String import_remap(const String &p_path);
 
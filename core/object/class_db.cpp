@@ -711,6 +711,17 @@ Object *ClassDB::instantiate_without_postinitialization_with_refcount(const Stri
 	return _instantiate_internal(p_class, true, false, true, true);
 }
 
+// Returns the constructor of a native class, so callers creating many objects of the same class can skip the
+// lookup. Returns null for classes that must go through instantiate() (extensions, placeholders, editor classes).
+ClassDB::CreationFunc ClassDB::get_native_creation_func(const StringName &p_class) {
+	Locker::Lock lock(Locker::STATE_READ);
+	ClassInfo *ti = classes.getptr(p_class);
+	if (!_can_instantiate(ti) || ti->gdextension || ti->is_runtime || ti->api != API_CORE) {
+		return nullptr;
+	}
+	return ti->creation_func;
+}
+
 #ifdef TOOLS_ENABLED
 ObjectGDExtension *ClassDB::get_placeholder_extension(const StringName &p_class) {
 	ObjectGDExtension *placeholder_extension = placeholder_extensions.getptr(p_class);
@@ -1733,6 +1744,22 @@ StringName ClassDB::get_property_setter(const StringName &p_class, const StringN
 	return StringName();
 }
 
+bool ClassDB::get_property_setget(const StringName &p_class, const StringName &p_property, PropertySetGet *r_setget) {
+	Locker::Lock lock(Locker::STATE_READ);
+	ClassInfo *check = classes.getptr(p_class);
+	while (check) {
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			*r_setget = *psg;
+			return true;
+		}
+
+		check = check->inherits_ptr;
+	}
+
+	return false;
+}
+
 StringName ClassDB::get_property_getter(const StringName &p_class, const StringName &p_property) {
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
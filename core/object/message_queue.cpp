@@ -31,6 +31,7 @@
 #include "message_queue.h"
 
 #include "core/config/project_settings.h"
+#include "core/os/os.h"
 
 #include <cstdio>
 
@@ -81,13 +82,46 @@ Error CallQueue::push_set(Object *p_object, const StringName &p_prop, const Vari
 	return push_set(p_object->get_instance_id(), p_prop, p_value);
 }
 
+void CallQueue::_free_message(Message *p_message) {
+	switch (p_message->type & FLAG_MASK) {
+		case TYPE_NOTIFICATION: {
+		} break;
+		case TYPE_NATIVE: {
+			NativeCallHeader *header = (NativeCallHeader *)(p_message + 1);
+			header->call(nullptr, header + 1);
+		} break;
+		default: {
+			Variant *args = (Variant *)(p_message + 1);
+			for (int k = 0; k < p_message->args; k++) {
+				args[k].~Variant();
+			}
+		} break;
+	}
+
+	p_message->~Message();
+}
+
 Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error) {
+	return _push_callablep(p_callable, p_args, p_argcount, p_show_error, false);
+}
+
+Error CallQueue::push_unique_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error) {
+	return _push_callablep(p_callable, p_args, p_argcount, p_show_error, true);
+}
+
+Error CallQueue::_push_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error, bool p_unique) {
 	uint32_t room_needed = sizeof(Message) + sizeof(Variant) * p_argcount;
 
 	ERR_FAIL_COND_V_MSG(room_needed > uint32_t(PAGE_SIZE_BYTES), ERR_INVALID_PARAMETER, "Message is too large to fit on a page (" + itos(PAGE_SIZE_BYTES) + " bytes), consider passing less arguments.");
 
 	LOCK_MUTEX;
 
+	if (p_unique && unique_pending.has(p_callable)) {
+		frame_coalesced_count++;
+		UNLOCK_MUTEX;
+		return OK;
+	}
+
 	_ensure_first_page();
 
 	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
@@ -111,6 +145,10 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 	if (p_show_error) {
 		msg->type |= FLAG_SHOW_ERROR;
 	}
+	if (p_unique) {
+		msg->type |= FLAG_UNIQUE;
+		unique_pending.insert(p_callable);
+	}
 	// Support callables of static methods.
 	if (p_callable.get_object_id().is_null() && p_callable.is_valid()) {
 		msg->type |= FLAG_NULL_IS_OK;
@@ -204,6 +242,45 @@ Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	return OK;
 }
 
+Error CallQueue::_push_native_call(ObjectID p_id, NativeCallFunc p_call, NativeMoveFunc p_move, void *p_payload, uint32_t p_payload_size) {
+	// Keep the messages following this one aligned.
+	uint32_t payload_size = (sizeof(NativeCallHeader) + p_payload_size + alignof(Variant) - 1) & ~uint32_t(alignof(Variant) - 1);
+	uint32_t room_needed = sizeof(Message) + payload_size;
+
+	ERR_FAIL_COND_V_MSG(room_needed > uint32_t(PAGE_SIZE_BYTES), ERR_INVALID_PARAMETER, "Message is too large to fit on a page (" + itos(PAGE_SIZE_BYTES) + " bytes), consider passing less arguments.");
+
+	LOCK_MUTEX;
+
+	_ensure_first_page();
+
+	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
+		if (pages_used == max_pages) {
+			fprintf(stderr, "Failed native call target ID: %s. Message queue out of memory. %s\n", itos(p_id).utf8().get_data(), error_text.utf8().get_data());
+			statistics();
+			UNLOCK_MUTEX;
+			return ERR_OUT_OF_MEMORY;
+		}
+		_add_page();
+	}
+
+	Page *page = pages[pages_used - 1];
+	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
+
+	Message *msg = memnew_placement(buffer_end, Message);
+	msg->type = TYPE_NATIVE;
+	msg->args = payload_size;
+
+	NativeCallHeader *header = (NativeCallHeader *)(msg + 1);
+	header->call = p_call;
+	header->object = p_id;
+	p_move(header + 1, p_payload);
+
+	page_bytes[pages_used - 1] += room_needed;
+	UNLOCK_MUTEX;
+
+	return OK;
+}
+
 void CallQueue::_call_function(const Callable &p_callable, const Variant *p_args, int p_argcount, bool p_show_error) {
 	const Variant **argptrs = nullptr;
 	if (p_argcount) {
@@ -237,6 +314,8 @@ Error CallQueue::flush() {
 
 	flushing = true;
 
+	uint64_t flush_begin = OS::get_singleton()->get_ticks_usec();
+
 	uint32_t i = 0;
 	uint32_t offset = 0;
 
@@ -247,15 +326,21 @@ Error CallQueue::flush() {
 
 		Message *message = (Message *)&page->data[offset];
 
-		uint32_t advance = sizeof(Message);
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			advance += sizeof(Variant) * message->args;
-		}
-
 		//pre-advance so this function is reentrant
-		offset += advance;
+		offset += _get_message_size(message);
 
-		Object *target = message->callable.get_object();
+		if (message->type & FLAG_UNIQUE) {
+			// Allow the call to be queued again from now on, even by itself.
+			unique_pending.erase(message->callable);
+		}
+		frame_message_count++;
+
+		Object *target;
+		if ((message->type & FLAG_MASK) == TYPE_NATIVE) {
+			target = ObjectDB::get_instance(((NativeCallHeader *)(message + 1))->object);
+		} else {
+			target = message->callable.get_object();
+		}
 
 		UNLOCK_MUTEX;
 
@@ -277,17 +362,19 @@ Error CallQueue::flush() {
 					target->set(message->callable.get_method(), *arg);
 				}
 			} break;
+			case TYPE_NATIVE: {
+				NativeCallHeader *header = (NativeCallHeader *)(message + 1);
+				// Calls and frees the payload in one go.
+				header->call(target, header + 1);
+			} break;
 		}
 
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			Variant *args = (Variant *)(message + 1);
-			for (int k = 0; k < message->args; k++) {
-				args[k].~Variant();
-			}
+		if ((message->type & FLAG_MASK) == TYPE_NATIVE) {
+			message->~Message();
+		} else {
+			_free_message(message);
 		}
 
-		message->~Message();
-
 		LOCK_MUTEX;
 		if (offset == page_bytes[i]) {
 			i++;
@@ -298,6 +385,8 @@ Error CallQueue::flush() {
 	page_bytes[0] = 0;
 	pages_used = 1;
 
+	frame_flush_usec += OS::get_singleton()->get_ticks_usec() - flush_begin;
+
 	flushing = false;
 	UNLOCK_MUTEX;
 	return OK;
@@ -320,26 +409,15 @@ void CallQueue::clear() {
 
 			Message *message = (Message *)&page->data[offset];
 
-			uint32_t advance = sizeof(Message);
-			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-				advance += sizeof(Variant) * message->args;
-			}
-
-			offset += advance;
-
-			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-				Variant *args = (Variant *)(message + 1);
-				for (int k = 0; k < message->args; k++) {
-					args[k].~Variant();
-				}
-			}
+			offset += _get_message_size(message);
 
-			message->~Message();
+			_free_message(message);
 		}
 	}
 
 	pages_used = 1;
 	page_bytes[0] = 0;
+	unique_pending.clear();
 
 	UNLOCK_MUTEX;
 }
@@ -349,6 +427,7 @@ void CallQueue::statistics() {
 	HashMap<StringName, int> set_count;
 	HashMap<int, int> notify_count;
 	HashMap<Callable, int> call_count;
+	int native_count = 0;
 	int null_count = 0;
 
 	for (uint32_t i = 0; i < pages_used; i++) {
@@ -360,12 +439,14 @@ void CallQueue::statistics() {
 
 			Message *message = (Message *)&page->data[offset];
 
-			uint32_t advance = sizeof(Message);
-			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-				advance += sizeof(Variant) * message->args;
-			}
+			uint32_t advance = _get_message_size(message);
 
-			Object *target = message->callable.get_object();
+			Object *target;
+			if ((message->type & FLAG_MASK) == TYPE_NATIVE) {
+				target = ObjectDB::get_instance(((NativeCallHeader *)(message + 1))->object);
+			} else {
+				target = message->callable.get_object();
+			}
 
 			bool null_target = true;
 			switch (message->type & FLAG_MASK) {
@@ -400,6 +481,12 @@ void CallQueue::statistics() {
 						null_target = false;
 					}
 				} break;
+				case TYPE_NATIVE: {
+					if (target) {
+						native_count++;
+						null_target = false;
+					}
+				} break;
 			}
 			if (null_target) {
 				// Object was deleted.
@@ -410,14 +497,7 @@ void CallQueue::statistics() {
 
 			offset += advance;
 
-			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-				Variant *args = (Variant *)(message + 1);
-				for (int k = 0; k < message->args; k++) {
-					args[k].~Variant();
-				}
-			}
-
-			message->~Message();
+			_free_message(message);
 		}
 	}
 
@@ -436,6 +516,8 @@ void CallQueue::statistics() {
 		fprintf(stdout, "NOTIFY %d: %d.\n", E.key, E.value);
 	}
 
+	fprintf(stdout, "NATIVE CALL count: %d.\n", native_count);
+
 	UNLOCK_MUTEX;
 }
 
@@ -458,6 +540,29 @@ int CallQueue::get_max_buffer_usage() const {
 	return pages.size() * PAGE_SIZE_BYTES;
 }
 
+void CallQueue::end_frame() {
+	LOCK_MUTEX;
+	last_frame_message_count = frame_message_count;
+	last_frame_coalesced_count = frame_coalesced_count;
+	last_frame_flush_usec = frame_flush_usec;
+	frame_message_count = 0;
+	frame_coalesced_count = 0;
+	frame_flush_usec = 0;
+	UNLOCK_MUTEX;
+}
+
+uint32_t CallQueue::get_frame_message_count() const {
+	return last_frame_message_count;
+}
+
+uint32_t CallQueue::get_frame_coalesced_count() const {
+	return last_frame_coalesced_count;
+}
+
+uint64_t CallQueue::get_frame_flush_time_usec() const {
+	return last_frame_flush_usec;
+}
+
 CallQueue::CallQueue(Allocator *p_custom_allocator, uint32_t p_max_pages, const String &p_error_text) {
 	if (p_custom_allocator) {
 		allocator = p_custom_allocator;
@@ -32,8 +32,11 @@
 
 #include "core/object/object_id.h"
 #include "core/os/mutex.h"
+#include "core/templates/hash_set.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/paged_allocator.h"
+#include "core/templates/simple_type.h"
+#include "core/templates/tuple.h"
 #include "core/variant/variant.h"
 
 class Object;
@@ -59,10 +62,12 @@ private:
 		TYPE_CALL,
 		TYPE_NOTIFICATION,
 		TYPE_SET,
+		TYPE_NATIVE,
 		TYPE_END, // End marker.
+		FLAG_UNIQUE = 1 << 12,
 		FLAG_NULL_IS_OK = 1 << 13,
 		FLAG_SHOW_ERROR = 1 << 14,
-		FLAG_MASK = FLAG_NULL_IS_OK - 1,
+		FLAG_MASK = FLAG_UNIQUE - 1,
 	};
 
 	Mutex mutex;
@@ -76,6 +81,16 @@ private:
 	uint32_t pages_used = 0;
 	bool flushing = false;
 
+	// Callables pushed with push_unique_callable() that have not been flushed yet.
+	HashSet<Callable> unique_pending;
+
+	uint32_t frame_message_count = 0;
+	uint32_t frame_coalesced_count = 0;
+	uint64_t frame_flush_usec = 0;
+	uint32_t last_frame_message_count = 0;
+	uint32_t last_frame_coalesced_count = 0;
+	uint64_t last_frame_flush_usec = 0;
+
 #ifdef DEV_ENABLED
 	bool is_current_thread_override = false;
 #endif
@@ -85,10 +100,61 @@ private:
 		int16_t type;
 		union {
 			int16_t notification;
-			int16_t args;
+			int16_t args; // Payload size in bytes for TYPE_NATIVE.
 		};
 	};
 
+	// Calls the method on the target if it's not null, then destroys the payload.
+	typedef void (*NativeCallFunc)(Object *p_target, void *p_payload);
+	typedef void (*NativeMoveFunc)(void *p_dst, void *p_src);
+
+	struct NativeCallHeader {
+		NativeCallFunc call;
+		ObjectID object;
+	};
+
+	template <typename T, typename M, typename... Args>
+	struct NativeCall {
+		M method;
+		Tuple<GetSimpleTypeT<Args>...> args;
+
+		template <typename... FwdArgs>
+		_FORCE_INLINE_ NativeCall(M p_method, FwdArgs &&...p_args) :
+				method(p_method), args(std::forward<FwdArgs>(p_args)...) {}
+
+		static void call(Object *p_target, void *p_payload) {
+			NativeCall *nc = (NativeCall *)p_payload;
+			if (p_target) {
+				nc->call_impl(static_cast<T *>(p_target), BuildIndexSequence<sizeof...(Args)>{});
+			}
+			nc->~NativeCall();
+		}
+
+		static void move(void *p_dst, void *p_src) {
+			memnew_placement(p_dst, NativeCall(std::move(*(NativeCall *)p_src)));
+		}
+
+	private:
+		template <size_t... I>
+		_FORCE_INLINE_ void call_impl(T *p_instance, IndexSequence<I...>) {
+			// Move out of the Tuple, this will be destroyed as soon as the call is complete.
+			(p_instance->*method)(std::move(tuple_get<I>(args))...);
+		}
+	};
+
+	_FORCE_INLINE_ static uint32_t _get_message_size(const Message *p_message) {
+		switch (p_message->type & FLAG_MASK) {
+			case TYPE_NOTIFICATION:
+				return sizeof(Message);
+			case TYPE_NATIVE:
+				return sizeof(Message) + p_message->args;
+			default:
+				return sizeof(Message) + sizeof(Variant) * p_message->args;
+		}
+	}
+
+	static void _free_message(Message *p_message);
+
 	_FORCE_INLINE_ void _ensure_first_page() {
 		if (unlikely(pages.is_empty())) {
 			pages.push_back(allocator->alloc());
@@ -101,6 +167,9 @@ private:
 
 	void _call_function(const Callable &p_callable, const Variant *p_args, int p_argcount, bool p_show_error);
 
+	Error _push_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error, bool p_unique);
+	Error _push_native_call(ObjectID p_id, NativeCallFunc p_call, NativeMoveFunc p_move, void *p_payload, uint32_t p_payload_size);
+
 	String error_text;
 
 public:
@@ -129,6 +198,30 @@ public:
 		return push_callablep(p_callable, sizeof...(p_args) == 0 ? nullptr : (const Variant **)argptrs, sizeof...(p_args));
 	}
 
+	// Does nothing if an equal callable is already waiting to be flushed, the arguments of the first push are kept.
+	Error push_unique_callablep(const Callable &p_callable, const Variant **p_args, int p_argcount, bool p_show_error = false);
+
+	template <typename... VarArgs>
+	Error push_unique_callable(const Callable &p_callable, VarArgs... p_args) {
+		Variant args[sizeof...(p_args) + 1] = { p_args..., Variant() }; // +1 makes sure zero sized arrays are also supported.
+		const Variant *argptrs[sizeof...(p_args) + 1];
+		for (uint32_t i = 0; i < sizeof...(p_args); i++) {
+			argptrs[i] = &args[i];
+		}
+		return push_unique_callablep(p_callable, sizeof...(p_args) == 0 ? nullptr : (const Variant **)argptrs, sizeof...(p_args));
+	}
+
+	// Calls a method directly on flush, without going through Callable and Variant.
+	// The arguments are stored by value, the call is skipped if the object has been freed by then.
+	template <typename T, typename M, typename... Args>
+	Error push_native_call(T *p_instance, M p_method, Args &&...p_args) {
+		typedef NativeCall<T, M, Args...> Call;
+		static_assert(alignof(Call) <= alignof(Variant), "Arguments are too strictly aligned for a native deferred call.");
+
+		Call call(p_method, std::forward<Args>(p_args)...);
+		return _push_native_call(p_instance->get_instance_id(), &Call::call, &Call::move, &call, sizeof(Call));
+	}
+
 	Error push_callp(Object *p_object, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error = false);
 
 	Error push_notification(Object *p_object, int p_notification);
@@ -143,6 +236,12 @@ public:
 	bool is_flushing() const;
 	int get_max_buffer_usage() const;
 
+	// Moves the counters of the current frame to the ones returned by the getters below.
+	void end_frame();
+	uint32_t get_frame_message_count() const;
+	uint32_t get_frame_coalesced_count() const;
+	uint64_t get_frame_flush_time_usec() const;
+
 	CallQueue(Allocator *p_custom_allocator = nullptr, uint32_t p_max_pages = 8192, const String &p_error_text = String());
 	virtual ~CallQueue();
 };
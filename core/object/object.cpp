@@ -1623,6 +1623,22 @@ bool Object::has_connections(const StringName &p_signal) const {
 	return !s->slot_map.is_empty();
 }
 
+bool Object::has_any_connections() const {
+	ObjectSignalLock signal_lock(this);
+
+	if (!connections.is_empty()) {
+		return true;
+	}
+
+	for (const KeyValue<StringName, SignalData> &E : signal_map) {
+		if (!E.value.slot_map.is_empty()) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 void Object::disconnect(const StringName &p_signal, const Callable &p_callable) {
 	_disconnect(p_signal, p_callable);
 }
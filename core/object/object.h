@@ -786,6 +786,7 @@ public:
 	DEBUG_VIRTUAL void disconnect(const StringName &p_signal, const Callable &p_callable);
 	DEBUG_VIRTUAL bool is_connected(const StringName &p_signal, const Callable &p_callable) const;
 	DEBUG_VIRTUAL bool has_connections(const StringName &p_signal) const;
+	bool has_any_connections() const; // To the signals of this object, or from this object to others.
 
 	void call_deferredp(const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error = false);
 	template <typename... VarArgs>
@@ -831,6 +832,7 @@ public:
 	// Used on creation by binding only.
 	void set_instance_binding(void *p_token, void *p_binding, const GDExtensionInstanceBindingCallbacks *p_callbacks);
 	bool has_instance_binding(void *p_token);
+	bool has_any_instance_binding() const { return _instance_binding_count > 0; }
 	void free_instance_binding(void *p_token);
 
 #ifdef TOOLS_ENABLED
@@ -48,6 +48,7 @@
 #include "core/io/config_file.h"
 #include "core/io/dir_access.h"
 #include "core/io/dtls_server.h"
+#include "core/io/file_access_async.h"
 #include "core/io/http_client.h"
 #include "core/io/image_loader.h"
 #include "core/io/image_resource_format.h"
@@ -119,6 +120,7 @@ static CoreBind::Geometry2D *_geometry_2d = nullptr;
 static CoreBind::Geometry3D *_geometry_3d = nullptr;
 
 static WorkerThreadPool *worker_thread_pool = nullptr;
+static FileAccessAsync *file_access_async = nullptr;
 
 extern Mutex _global_mutex;
 
@@ -351,6 +353,7 @@ void register_core_types() {
 	GDREGISTER_NATIVE_STRUCT(ScriptLanguageExtensionProfilingInfo, "StringName signature;uint64_t call_count;uint64_t total_time;uint64_t self_time");
 
 	worker_thread_pool = memnew(WorkerThreadPool);
+	file_access_async = FileAccessAsync::create();
 
 	OS::get_singleton()->benchmark_end_measure("Core", "Register Types");
 }
@@ -422,6 +425,7 @@ void unregister_core_types() {
 
 	// Destroy singletons in reverse order to ensure dependencies are not broken.
 
+	memdelete(file_access_async);
 	memdelete(worker_thread_pool);
 
 	memdelete(_engine_debugger);
@@ -2581,8 +2581,8 @@ done:
 #define READING_EXP 3
 #define READING_DONE 4
 
-double String::to_float(const char *p_str) {
-	return built_in_strtod<char>(p_str);
+double String::to_float(const char *p_str, const char **r_end) {
+	return built_in_strtod<char>(p_str, (char **)r_end);
 }
 
 double String::to_float(const char32_t *p_str, const char32_t **r_end) {
@@ -4496,15 +4496,70 @@ String String::c_escape_multiline() const {
 }
 
 String String::json_escape() const {
-	String escaped = *this;
-	escaped = escaped.replace("\\", "\\\\");
-	escaped = escaped.replace("\b", "\\b");
-	escaped = escaped.replace("\f", "\\f");
-	escaped = escaped.replace("\n", "\\n");
-	escaped = escaped.replace("\r", "\\r");
-	escaped = escaped.replace("\t", "\\t");
-	escaped = escaped.replace("\v", "\\v");
-	escaped = escaped.replace("\"", "\\\"");
+	const char32_t *src = get_data();
+	const int len = length();
+
+	int escape_count = 0;
+	for (int i = 0; i < len; i++) {
+		switch (src[i]) {
+			case '\\':
+			case '\b':
+			case '\f':
+			case '\n':
+			case '\r':
+			case '\t':
+			case '\v':
+			case '"':
+				escape_count++;
+				break;
+			default:
+				break;
+		}
+	}
+	if (escape_count == 0) {
+		return *this;
+	}
+
+	String escaped;
+	escaped.resize_uninitialized(len + escape_count + 1);
+	char32_t *dst = escaped.ptrw();
+	for (int i = 0; i < len; i++) {
+		const char32_t c = src[i];
+		char32_t escape = 0;
+		switch (c) {
+			case '\\':
+			case '"':
+				escape = c;
+				break;
+			case '\b':
+				escape = 'b';
+				break;
+			case '\f':
+				escape = 'f';
+				break;
+			case '\n':
+				escape = 'n';
+				break;
+			case '\r':
+				escape = 'r';
+				break;
+			case '\t':
+				escape = 't';
+				break;
+			case '\v':
+				escape = 'v';
+				break;
+			default:
+				break;
+		}
+		if (escape) {
+			*dst++ = '\\';
+			*dst++ = escape;
+		} else {
+			*dst++ = c;
+		}
+	}
+	*dst = 0;
 
 	return escaped;
 }
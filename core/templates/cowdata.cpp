@@ -0,0 +1,67 @@
+/**************************************************************************/
+/*  cowdata.cpp                                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "cowdata.h"
+
+namespace {
+
+struct SmallBlockStack {
+	void *blocks[CowDataSmallBlockCache::CAPACITY];
+	uint32_t count = 0;
+	// Strings can still be freed by other thread-local destructors after this one ran.
+	bool alive = true;
+
+	~SmallBlockStack() {
+		for (uint32_t i = 0; i < count; i++) {
+			Memory::free_static(blocks[i], false);
+		}
+		count = 0;
+		alive = false;
+	}
+};
+
+thread_local SmallBlockStack small_blocks;
+
+} // namespace
+
+void *CowDataSmallBlockCache::alloc(size_t p_bytes) {
+	if (small_blocks.count > 0) {
+		return small_blocks.blocks[--small_blocks.count];
+	}
+	return Memory::alloc_static(p_bytes, false);
+}
+
+void CowDataSmallBlockCache::free(void *p_mem) {
+	if (small_blocks.alive && small_blocks.count < CAPACITY) {
+		small_blocks.blocks[small_blocks.count++] = p_mem;
+		return;
+	}
+	Memory::free_static(p_mem, false);
+}
@@ -56,6 +56,18 @@ GODOT_GCC_PRAGMA(GCC diagnostic warning "-Wstringop-overflow=0") // Can't "ignor
 GODOT_GCC_PRAGMA(GCC diagnostic warning "-Wdangling-pointer=0") // Can't "ignore" this for some reason.
 #endif
 
+// Per-thread stack of freed buffers of a single fixed size. `CowData<char32_t>` gives every short
+// `String` the same capacity, so creating and freeing short strings doesn't go through the general
+// purpose allocator. Blocks are regular `Memory::alloc_static()` allocations without padding, so
+// they can still be reallocated or freed normally.
+class CowDataSmallBlockCache {
+public:
+	static constexpr uint32_t CAPACITY = 64;
+
+	static void *alloc(size_t p_bytes);
+	static void free(void *p_mem);
+};
+
 template <typename T>
 class CowData {
 public:
@@ -76,6 +88,11 @@ private:
 	static constexpr size_t SIZE_OFFSET = Memory::get_aligned_address(CAPACITY_OFFSET + sizeof(USize), alignof(USize));
 	static constexpr size_t DATA_OFFSET = Memory::get_aligned_address(SIZE_OFFSET + sizeof(USize), Memory::MAX_ALIGN);
 
+	// Short strings (most names, keys and labels) share one capacity so their buffers can be
+	// recycled through `CowDataSmallBlockCache`.
+	static constexpr USize SMALL_CAPACITY = std::is_same_v<T, char32_t> ? 16 : 0;
+	static constexpr size_t SMALL_BLOCK_SIZE = SMALL_CAPACITY * sizeof(T) + DATA_OFFSET;
+
 	mutable T *_ptr = nullptr;
 
 	// internal helpers
@@ -248,6 +265,7 @@ void CowData<T>::_unref() {
 	//          which is illegal after some of the elements in it have already been destructed, and
 	//          may lead to a segmentation fault.
 	USize current_size = size();
+	USize current_capacity = capacity();
 	T *prev_ptr = _ptr;
 	_ptr = nullptr;
 
@@ -260,7 +278,11 @@ void CowData<T>::_unref() {
 	destruct_arr_placement(prev_ptr, current_size);
 
 	// Free Memory.
-	Memory::free_static((uint8_t *)prev_ptr - DATA_OFFSET, false);
+	if (SMALL_CAPACITY > 0 && current_capacity == SMALL_CAPACITY) {
+		CowDataSmallBlockCache::free((uint8_t *)prev_ptr - DATA_OFFSET);
+	} else {
+		Memory::free_static((uint8_t *)prev_ptr - DATA_OFFSET, false);
+	}
 
 #ifdef ASAN_ENABLED
 	__asan_unpoison_memory_region(this, sizeof(CowData));
@@ -473,7 +495,16 @@ template <typename T>
 Error CowData<T>::_alloc_exact(USize p_capacity) {
 	DEV_ASSERT(!_ptr);
 
-	uint8_t *mem_new = (uint8_t *)Memory::alloc_static(p_capacity * sizeof(T) + DATA_OFFSET, false);
+	uint8_t *mem_new = nullptr;
+	if constexpr (SMALL_CAPACITY > 0) {
+		if (p_capacity <= SMALL_CAPACITY) {
+			p_capacity = SMALL_CAPACITY;
+			mem_new = (uint8_t *)CowDataSmallBlockCache::alloc(SMALL_BLOCK_SIZE);
+		}
+	}
+	if (!mem_new) {
+		mem_new = (uint8_t *)Memory::alloc_static(p_capacity * sizeof(T) + DATA_OFFSET, false);
+	}
 	ERR_FAIL_NULL_V(mem_new, ERR_OUT_OF_MEMORY);
 
 	_ptr = _get_data_ptr(mem_new);
@@ -491,6 +522,15 @@ template <typename T>
 Error CowData<T>::_realloc_exact(USize p_capacity) {
 	DEV_ASSERT(_ptr);
 
+	if constexpr (SMALL_CAPACITY > 0) {
+		if (p_capacity <= SMALL_CAPACITY) {
+			p_capacity = SMALL_CAPACITY;
+			if (capacity() == SMALL_CAPACITY) {
+				return OK;
+			}
+		}
+	}
+
 	uint8_t *mem_new = (uint8_t *)Memory::realloc_static(((uint8_t *)_ptr) - DATA_OFFSET, p_capacity * sizeof(T) + DATA_OFFSET, false);
 	ERR_FAIL_NULL_V(mem_new, ERR_OUT_OF_MEMORY);
 
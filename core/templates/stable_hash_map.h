@@ -0,0 +1,585 @@
+/**************************************************************************/
+/*  stable_hash_map.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/math_funcs_binary.h"
+#include "core/os/memory.h"
+#include "core/templates/hashfuncs.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/pair.h"
+#include "core/templates/sort_array.h"
+
+/**
+ * A hash map that keeps the insertion order, and whose elements never move in memory.
+ *
+ * Elements are allocated in pages that double in size, so there are only a few allocations
+ * per map instead of one per element like HashMap. Pointers and references to keys and
+ * values stay valid until that element is erased, even when other elements are added,
+ * erased or sorted.
+ *
+ * Erasing leaves a hole in the insertion order, which is skipped while iterating and
+ * closed once holes make up half of the order, so erasing is amortized O(1).
+ * `get_by_index` is O(1), unless there are holes left by erased elements.
+ *
+ * Use AHashMap if elements are rarely erased and pointers to them are not kept around.
+ */
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>>
+class _WARN_UNUSED_ StableHashMap {
+public:
+	// Must be a power of two.
+	static constexpr uint32_t INITIAL_CAPACITY = 8;
+	static constexpr uint32_t MIN_PAGE_SIZE = 4;
+	static constexpr uint32_t EMPTY_HASH = 0;
+
+private:
+	typedef KeyValue<TKey, TValue> MapKeyValue;
+
+	struct Element {
+		MapKeyValue data;
+		uint32_t hash;
+		uint32_t order_idx;
+	};
+
+	struct Metadata {
+		uint32_t hash;
+		Element *element;
+	};
+
+	Metadata *_metadata = nullptr;
+	// Due to optimization, this is `capacity - 1`. Use + 1 to get normal capacity.
+	uint32_t _capacity_mask = INITIAL_CAPACITY - 1;
+	uint32_t _size = 0;
+
+	// Elements in insertion order, `nullptr` where one was erased.
+	LocalVector<Element *> _order;
+	uint32_t _holes = 0;
+
+	LocalVector<Element *> _pages;
+	uint32_t _page_used = 0;
+	uint32_t _page_capacity = 0;
+	uint32_t _allocated = 0;
+	LocalVector<Element *> _free_elements;
+
+	uint32_t _hash(const TKey &p_key) const {
+		uint32_t hash = Hasher::hash(p_key);
+
+		if (unlikely(hash == EMPTY_HASH)) {
+			hash = EMPTY_HASH + 1;
+		}
+
+		return hash;
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_resize_count(uint32_t p_capacity_mask) {
+		return p_capacity_mask ^ (p_capacity_mask + 1) >> 2; // = get_capacity() * 0.75 - 1; Works only if p_capacity_mask = 2^n - 1.
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_probe_length(uint32_t p_meta_idx, uint32_t p_hash, uint32_t p_capacity) {
+		const uint32_t original_idx = p_hash & p_capacity;
+		return (p_meta_idx - original_idx + p_capacity + 1) & p_capacity;
+	}
+
+	Element *_lookup(const TKey &p_key, uint32_t p_hash, uint32_t &r_meta_idx) const {
+		if (unlikely(_metadata == nullptr)) {
+			return nullptr; // Failed lookups, no elements.
+		}
+
+		uint32_t meta_idx = p_hash & _capacity_mask;
+		uint32_t distance = 0;
+		while (true) {
+			const Metadata &metadata = _metadata[meta_idx];
+			if (metadata.hash == EMPTY_HASH) {
+				return nullptr;
+			}
+
+			if (metadata.hash == p_hash && Comparator::compare(metadata.element->data.key, p_key)) {
+				r_meta_idx = meta_idx;
+				return metadata.element;
+			}
+
+			if (distance > _get_probe_length(meta_idx, metadata.hash, _capacity_mask)) {
+				return nullptr;
+			}
+
+			meta_idx = (meta_idx + 1) & _capacity_mask;
+			distance++;
+		}
+	}
+
+	void _insert_metadata(uint32_t p_hash, Element *p_element) {
+		uint32_t meta_idx = p_hash & _capacity_mask;
+		Metadata metadata = { p_hash, p_element };
+		uint32_t distance = 0;
+
+		while (true) {
+			if (_metadata[meta_idx].hash == EMPTY_HASH) {
+#ifdef DEV_ENABLED
+				if (unlikely(distance > 12)) {
+					WARN_PRINT("Excessive collision count, is the right hash function being used?");
+				}
+#endif
+				_metadata[meta_idx] = metadata;
+				return;
+			}
+
+			// Not an empty slot, let's check the probing length of the existing one.
+			uint32_t existing_probe_len = _get_probe_length(meta_idx, _metadata[meta_idx].hash, _capacity_mask);
+			if (existing_probe_len < distance) {
+				SWAP(metadata, _metadata[meta_idx]);
+				distance = existing_probe_len;
+			}
+
+			meta_idx = (meta_idx + 1) & _capacity_mask;
+			distance++;
+		}
+	}
+
+	void _erase_metadata(uint32_t p_meta_idx) {
+		uint32_t next_meta_idx = (p_meta_idx + 1) & _capacity_mask;
+		while (_metadata[next_meta_idx].hash != EMPTY_HASH && _get_probe_length(next_meta_idx, _metadata[next_meta_idx].hash, _capacity_mask) != 0) {
+			SWAP(_metadata[next_meta_idx], _metadata[p_meta_idx]);
+
+			p_meta_idx = next_meta_idx;
+			next_meta_idx = (next_meta_idx + 1) & _capacity_mask;
+		}
+
+		_metadata[p_meta_idx].hash = EMPTY_HASH;
+	}
+
+	void _resize_and_rehash(uint32_t p_new_capacity) {
+		// Capacity must be 2^n - 1.
+		_capacity_mask = Math::next_power_of_2(MAX(INITIAL_CAPACITY, p_new_capacity)) - 1;
+
+		if (_metadata) {
+			Memory::free_static(_metadata);
+		}
+		_metadata = reinterpret_cast<Metadata *>(Memory::alloc_static_zeroed(sizeof(Metadata) * (_capacity_mask + 1)));
+
+		for (Element *element : _order) {
+			if (element) {
+				_insert_metadata(element->hash, element);
+			}
+		}
+	}
+
+	Element *_alloc_element() {
+		if (!_free_elements.is_empty()) {
+			Element *element = _free_elements[_free_elements.size() - 1];
+			_free_elements.resize(_free_elements.size() - 1);
+			return element;
+		}
+
+		if (_page_used == _page_capacity) {
+			// Pages double the total capacity, elements are never moved to a larger block.
+			_page_capacity = MAX(MIN_PAGE_SIZE, _allocated);
+			_page_used = 0;
+			_allocated += _page_capacity;
+			_pages.push_back(reinterpret_cast<Element *>(Memory::alloc_static(sizeof(Element) * _page_capacity)));
+		}
+
+		return &_pages[_pages.size() - 1][_page_used++];
+	}
+
+	Element *_insert_element(const TKey &p_key, const TValue &p_value, uint32_t p_hash) {
+		if (unlikely(_metadata == nullptr)) {
+			// Allocate on demand to save memory.
+			_metadata = reinterpret_cast<Metadata *>(Memory::alloc_static_zeroed(sizeof(Metadata) * (_capacity_mask + 1)));
+		} else if (unlikely(_size > _get_resize_count(_capacity_mask))) {
+			_resize_and_rehash((_capacity_mask + 1) * 2);
+		}
+
+		Element *element = _alloc_element();
+		memnew_placement(&element->data, MapKeyValue(p_key, p_value));
+		element->hash = p_hash;
+		element->order_idx = _order.size();
+		_order.push_back(element);
+
+		_insert_metadata(p_hash, element);
+		_size++;
+		return element;
+	}
+
+	void _close_holes() {
+		uint32_t dst = 0;
+		for (uint32_t i = 0; i < _order.size(); i++) {
+			Element *element = _order[i];
+			if (element) {
+				element->order_idx = dst;
+				_order[dst++] = element;
+			}
+		}
+		_order.resize(dst);
+		_holes = 0;
+	}
+
+	void _free_all() {
+		for (Element *element : _order) {
+			if (element) {
+				element->data.~MapKeyValue();
+			}
+		}
+		for (Element *page : _pages) {
+			Memory::free_static(page);
+		}
+		_pages.clear();
+		_page_used = 0;
+		_page_capacity = 0;
+		_allocated = 0;
+		_free_elements.clear();
+		_order.clear();
+		_holes = 0;
+		_size = 0;
+	}
+
+	void _init_from(const StableHashMap &p_other) {
+		reserve(p_other._size);
+		for (const Element *element : p_other._order) {
+			if (element) {
+				_insert_element(element->data.key, element->data.value, element->hash);
+			}
+		}
+	}
+
+public:
+	/* Standard Godot Container API */
+
+	_FORCE_INLINE_ uint32_t get_capacity() const { return _capacity_mask + 1; }
+	_FORCE_INLINE_ uint32_t size() const { return _size; }
+
+	_FORCE_INLINE_ bool is_empty() const {
+		return _size == 0;
+	}
+
+	void clear() {
+		if (_size == 0 && _order.is_empty()) {
+			return;
+		}
+
+		_free_all();
+		if (_metadata) {
+			memset(_metadata, EMPTY_HASH, (_capacity_mask + 1) * sizeof(Metadata));
+		}
+	}
+
+	TValue &get(const TKey &p_key) _LIFETIME_BOUND_ {
+		uint32_t meta_idx = 0;
+		Element *element = _lookup(p_key, _hash(p_key), meta_idx);
+		CRASH_COND_MSG(!element, "StableHashMap key not found.");
+		return element->data.value;
+	}
+
+	const TValue &get(const TKey &p_key) const _LIFETIME_BOUND_ {
+		uint32_t meta_idx = 0;
+		const Element *element = _lookup(p_key, _hash(p_key), meta_idx);
+		CRASH_COND_MSG(!element, "StableHashMap key not found.");
+		return element->data.value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const _LIFETIME_BOUND_ {
+		uint32_t meta_idx = 0;
+		const Element *element = _lookup(p_key, _hash(p_key), meta_idx);
+		return element ? &element->data.value : nullptr;
+	}
+
+	TValue *getptr(const TKey &p_key) _LIFETIME_BOUND_ {
+		uint32_t meta_idx = 0;
+		Element *element = _lookup(p_key, _hash(p_key), meta_idx);
+		return element ? &element->data.value : nullptr;
+	}
+
+	bool has(const TKey &p_key) const {
+		uint32_t meta_idx = 0;
+		return _lookup(p_key, _hash(p_key), meta_idx) != nullptr;
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t meta_idx = 0;
+		Element *element = _lookup(p_key, _hash(p_key), meta_idx);
+		if (!element) {
+			return false;
+		}
+
+		_erase_metadata(meta_idx);
+		_order[element->order_idx] = nullptr;
+		_holes++;
+		element->data.~MapKeyValue();
+		_free_elements.push_back(element);
+		_size--;
+
+		// Holes at the end are dropped right away, the others once they make up half of the order.
+		while (!_order.is_empty() && _order[_order.size() - 1] == nullptr) {
+			_order.resize(_order.size() - 1);
+			_holes--;
+		}
+		if (_holes > _size) {
+			_close_holes();
+		}
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	// If adding a known (possibly large) number of elements at once, must be larger than old capacity.
+	void reserve(uint32_t p_new_capacity) {
+		_order.reserve(p_new_capacity);
+		if (p_new_capacity <= _get_resize_count(_capacity_mask) + 1) {
+			return;
+		}
+		if (_metadata == nullptr) {
+			_capacity_mask = Math::next_power_of_2(MAX(INITIAL_CAPACITY, p_new_capacity + p_new_capacity / 3)) - 1;
+			return; // Allocated on the first insertion.
+		}
+		_resize_and_rehash(p_new_capacity + p_new_capacity / 3);
+	}
+
+	// Sorts the insertion order, elements stay where they are in memory.
+	void sort() {
+		sort_custom<KeyValueSort<TKey, TValue>>();
+	}
+
+	template <typename C>
+	void sort_custom() {
+		if (_holes > 0) {
+			_close_holes();
+		}
+		if (_size < 2) {
+			return;
+		}
+
+		struct ElementSort {
+			C compare;
+			_FORCE_INLINE_ bool operator()(const Element *p_a, const Element *p_b) const {
+				return compare(p_a->data, p_b->data);
+			}
+		};
+
+		SortArray<Element *, ElementSort> sorter;
+		sorter.sort(_order.ptr(), _order.size());
+		for (uint32_t i = 0; i < _order.size(); i++) {
+			_order[i]->order_idx = i;
+		}
+	}
+
+	/** Iterator API **/
+
+	// Iterators hold a position in the insertion order, so adding elements while iterating is safe.
+	struct ConstIterator {
+		_FORCE_INLINE_ const MapKeyValue &operator*() const {
+			return map->_order[idx]->data;
+		}
+		_FORCE_INLINE_ const MapKeyValue *operator->() const {
+			return &map->_order[idx]->data;
+		}
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			idx++;
+			_skip_holes();
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return idx == b.idx; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return idx != b.idx; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return map && idx < map->_order.size();
+		}
+
+		_FORCE_INLINE_ ConstIterator(const StableHashMap *p_map, uint32_t p_idx) {
+			map = p_map;
+			idx = p_idx;
+			_skip_holes();
+		}
+		_FORCE_INLINE_ ConstIterator() {}
+
+	private:
+		_FORCE_INLINE_ void _skip_holes() {
+			while (idx < map->_order.size() && map->_order[idx] == nullptr) {
+				idx++;
+			}
+		}
+
+		const StableHashMap *map = nullptr;
+		uint32_t idx = 0;
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ MapKeyValue &operator*() const {
+			return map->_order[idx]->data;
+		}
+		_FORCE_INLINE_ MapKeyValue *operator->() const {
+			return &map->_order[idx]->data;
+		}
+		_FORCE_INLINE_ Iterator &operator++() {
+			idx++;
+			_skip_holes();
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return idx == b.idx; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return idx != b.idx; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return map && idx < map->_order.size();
+		}
+
+		_FORCE_INLINE_ Iterator(StableHashMap *p_map, uint32_t p_idx) {
+			map = p_map;
+			idx = p_idx;
+			_skip_holes();
+		}
+		_FORCE_INLINE_ Iterator() {}
+
+		operator ConstIterator() const {
+			return ConstIterator(map, idx);
+		}
+
+	private:
+		_FORCE_INLINE_ void _skip_holes() {
+			while (idx < map->_order.size() && map->_order[idx] == nullptr) {
+				idx++;
+			}
+		}
+
+		StableHashMap *map = nullptr;
+		uint32_t idx = 0;
+	};
+
+	_FORCE_INLINE_ Iterator begin() _LIFETIME_BOUND_ {
+		return Iterator(this, 0);
+	}
+	_FORCE_INLINE_ Iterator end() _LIFETIME_BOUND_ {
+		return Iterator(this, _order.size());
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const _LIFETIME_BOUND_ {
+		return ConstIterator(this, 0);
+	}
+	_FORCE_INLINE_ ConstIterator end() const _LIFETIME_BOUND_ {
+		return ConstIterator(this, _order.size());
+	}
+
+	Iterator find(const TKey &p_key) _LIFETIME_BOUND_ {
+		uint32_t meta_idx = 0;
+		Element *element = _lookup(p_key, _hash(p_key), meta_idx);
+		if (!element) {
+			return end();
+		}
+		return Iterator(this, element->order_idx);
+	}
+
+	ConstIterator find(const TKey &p_key) const _LIFETIME_BOUND_ {
+		uint32_t meta_idx = 0;
+		const Element *element = _lookup(p_key, _hash(p_key), meta_idx);
+		if (!element) {
+			return end();
+		}
+		return ConstIterator(this, element->order_idx);
+	}
+
+	/* Indexing */
+
+	TValue &operator[](const TKey &p_key) _LIFETIME_BOUND_ {
+		const uint32_t hash = _hash(p_key);
+		uint32_t meta_idx = 0;
+		Element *element = _lookup(p_key, hash, meta_idx);
+		if (element) {
+			return element->data.value;
+		}
+		return _insert_element(p_key, TValue(), hash)->data.value;
+	}
+
+	const TValue &operator[](const TKey &p_key) const _LIFETIME_BOUND_ {
+		return get(p_key);
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value) {
+		const uint32_t hash = _hash(p_key);
+		uint32_t meta_idx = 0;
+		Element *element = _lookup(p_key, hash, meta_idx);
+		if (element) {
+			element->data.value = p_value;
+		} else {
+			element = _insert_element(p_key, p_value, hash);
+		}
+		return Iterator(this, element->order_idx);
+	}
+
+	/* Array methods. */
+
+	// Returns the element at the given position in the insertion order.
+	// O(1), unless elements were erased since the last time holes were closed.
+	const KeyValue<TKey, TValue> &get_by_index(uint32_t p_index) const _LIFETIME_BOUND_ {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, _size);
+		if (_holes == 0) {
+			return _order[p_index]->data;
+		}
+		for (const Element *element : _order) {
+			if (element) {
+				if (p_index == 0) {
+					return element->data;
+				}
+				p_index--;
+			}
+		}
+		CRASH_NOW();
+	}
+
+	/* Constructors */
+
+	StableHashMap(const StableHashMap &p_other) {
+		_capacity_mask = p_other._capacity_mask;
+		_init_from(p_other);
+	}
+
+	void operator=(const StableHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+
+		clear();
+		_init_from(p_other);
+	}
+
+	StableHashMap(uint32_t p_initial_capacity) {
+		reserve(p_initial_capacity);
+	}
+
+	StableHashMap() {}
+
+	~StableHashMap() {
+		_free_all();
+		if (_metadata) {
+			Memory::free_static(_metadata);
+		}
+	}
+};
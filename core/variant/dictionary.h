@@ -33,6 +33,7 @@
 #include "core/templates/hash_map.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/pair.h"
+#include "core/templates/stable_hash_map.h"
 #include "core/variant/variant_deep_duplicate.h"
 
 class Array;
@@ -50,7 +51,9 @@ class Dictionary {
 	void _unref() const;
 
 public:
-	using ConstIterator = HashMap<Variant, Variant, HashMapHasherDefault, StringLikeVariantComparator>::ConstIterator;
+	// Entries never move in memory, so pointers to keys and values stay valid until that entry is erased.
+	// Iterators are invalidated when entries are added.
+	using ConstIterator = StableHashMap<Variant, Variant, HashMapHasherDefault, StringLikeVariantComparator>::ConstIterator;
 
 	ConstIterator begin() const;
 	ConstIterator end() const;
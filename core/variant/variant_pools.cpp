@@ -68,26 +68,80 @@ static PagedAllocator<VariantPools::BucketSmall, true> _bucket_small;
 static PagedAllocator<VariantPools::BucketMedium, true> _bucket_medium;
 static PagedAllocator<VariantPools::BucketLarge, true> _bucket_large;
 
+namespace VariantPools {
+// Per-thread cache of free buckets in front of a shared pool, so that most allocations and
+// frees don't contend on the pool's lock. Buckets move from and to the pool in batches.
+template <typename T>
+class BucketCache {
+	static constexpr uint32_t CAPACITY = 64;
+	static constexpr uint32_t BATCH_SIZE = CAPACITY / 2;
+
+	PagedAllocator<T, true> &pool;
+	T *buckets[CAPACITY];
+	uint32_t count = 0;
+	// Variants can still be freed by other thread-local or static destructors after this one ran.
+	bool alive = true;
+
+public:
+	_FORCE_INLINE_ T *alloc() {
+		if (unlikely(!alive)) {
+			return pool.alloc();
+		}
+		if (unlikely(count == 0)) {
+			pool.alloc_batch(buckets, BATCH_SIZE);
+			count = BATCH_SIZE;
+		}
+		return buckets[--count];
+	}
+
+	_FORCE_INLINE_ void free(T *p_ptr) {
+		if (unlikely(!alive)) {
+			pool.free(p_ptr);
+			return;
+		}
+		if (unlikely(count == CAPACITY)) {
+			count -= BATCH_SIZE;
+			pool.free_batch(&buckets[count], BATCH_SIZE);
+		}
+		buckets[count++] = p_ptr;
+	}
+
+	BucketCache(PagedAllocator<T, true> &p_pool) :
+			pool(p_pool) {}
+
+	~BucketCache() {
+		// Return everything when the thread exits.
+		pool.free_batch(buckets, count);
+		count = 0;
+		alive = false;
+	}
+};
+} //namespace VariantPools
+
+static thread_local VariantPools::BucketCache<VariantPools::BucketSmall> _cache_small(_bucket_small);
+static thread_local VariantPools::BucketCache<VariantPools::BucketMedium> _cache_medium(_bucket_medium);
+static thread_local VariantPools::BucketCache<VariantPools::BucketLarge> _cache_large(_bucket_large);
+
 void *VariantPools::alloc_small() {
-	return _bucket_small.alloc();
+	return _cache_small.alloc();
 }
 
 void *VariantPools::alloc_medium() {
-	return _bucket_medium.alloc();
+	return _cache_medium.alloc();
 }
 
 void *VariantPools::alloc_large() {
-	return _bucket_large.alloc();
+	return _cache_large.alloc();
 }
 
 void VariantPools::free_small(void *p_ptr) {
-	_bucket_small.free(static_cast<BucketSmall *>(p_ptr));
+	_cache_small.free(static_cast<BucketSmall *>(p_ptr));
 }
 
 void VariantPools::free_medium(void *p_ptr) {
-	_bucket_medium.free(static_cast<BucketMedium *>(p_ptr));
+	_cache_medium.free(static_cast<BucketMedium *>(p_ptr));
 }
 
 void VariantPools::free_large(void *p_ptr) {
-	_bucket_large.free(static_cast<BucketLarge *>(p_ptr));
+	_cache_large.free(static_cast<BucketLarge *>(p_ptr));
 }
@@ -34,6 +34,13 @@
 
 Error ImageLoaderPNG::load_image(Ref<Image> p_image, Ref<FileAccess> f, BitField<ImageFormatLoader::LoaderFlags> p_flags, float p_scale) {
 	const uint64_t buffer_size = f->get_length();
+
+	// Decode straight from the file data when it is already in memory.
+	const uint8_t *view = f->get_buffer_view(buffer_size);
+	if (view) {
+		return PNGDriverCommon::png_to_image(view, buffer_size, p_flags & FLAG_FORCE_LINEAR, p_image);
+	}
+
 	Vector<uint8_t> file_buffer;
 	Error err = file_buffer.resize(buffer_size);
 	if (err) {
@@ -35,6 +35,9 @@
 #include "core/string/ustring.h"
 
 #include <fcntl.h>
+#if !defined(WEB_ENABLED)
+#include <sys/mman.h>
+#endif
 #include <sys/stat.h>
 #include <sys/types.h>
 #if !defined(__FreeBSD__) && !defined(__OpenBSD__) && !defined(__NetBSD__) && !defined(WEB_ENABLED)
@@ -200,6 +203,15 @@ void FileAccessUnix::_close() {
 		return;
 	}
 
+#if !defined(WEB_ENABLED)
+	if (mapped_data) {
+		munmap(mapped_data, mapped_length);
+	}
+#endif
+	mapped_data = nullptr;
+	mapped_length = 0;
+	map_attempted = false;
+
 	fclose(f);
 	f = nullptr;
 
@@ -305,6 +317,46 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+Span<uint8_t> FileAccessUnix::get_mapped_data() const {
+	ERR_FAIL_NULL_V_MSG(f, Span<uint8_t>(), "File must be opened before use.");
+
+#if !defined(WEB_ENABLED)
+	if (!map_attempted) {
+		map_attempted = true;
+
+		// Files open for writing are not mapped, as the mapping would not follow their size.
+		struct stat st = {};
+		if (flags == READ && fstat(fileno(f), &st) == 0 && st.st_size > 0 && uint64_t(st.st_size) <= SIZE_MAX) {
+			void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+			if (data != MAP_FAILED) {
+				mapped_data = (uint8_t *)data;
+				mapped_length = st.st_size;
+			}
+		}
+	}
+#endif
+
+	return Span<uint8_t>(mapped_data, mapped_length);
+}
+
+const uint8_t *FileAccessUnix::get_buffer_view(uint64_t p_length) const {
+	Span<uint8_t> data = get_mapped_data();
+	if (data.is_empty()) {
+		return nullptr;
+	}
+
+	int64_t pos = ftello(f);
+	if (pos < 0 || uint64_t(pos) > data.size() || p_length > data.size() - uint64_t(pos)) {
+		return nullptr;
+	}
+	if (fseeko(f, pos + p_length, SEEK_SET)) {
+		check_errors();
+		return nullptr;
+	}
+
+	return data.ptr() + pos;
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
@@ -46,6 +46,11 @@ class FileAccessUnix : public FileAccess {
 	String path;
 	String path_src;
 
+	// Read-only files are memory-mapped on the first request for a view.
+	mutable uint8_t *mapped_data = nullptr;
+	mutable uint64_t mapped_length = 0;
+	mutable bool map_attempted = false;
+
 	void _close();
 
 #if defined(TOOLS_ENABLED)
@@ -70,6 +75,8 @@ public:
 	virtual bool eof_reached() const override; ///< reading passed EOF
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual Span<uint8_t> get_mapped_data() const override;
+	virtual const uint8_t *get_buffer_view(uint64_t p_length) const override;
 
 	virtual Error get_error() const override; ///< get last error
 
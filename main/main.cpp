@@ -64,6 +64,7 @@
 #include "main/main_timer_sync.h"
 #include "main/performance.h"
 #include "main/splash.gen.h"
+#include "scene/animation/animation_mixer.h"
 #include "scene/main/scene_tree.h"
 #include "scene/main/window.h"
 #include "scene/property_list_helper.h"
@@ -284,6 +285,7 @@ static int fixed_fps = -1;
 static MovieWriter *movie_writer = nullptr;
 static bool disable_vsync = false;
 static bool print_fps = false;
+static String performance_recording_path;
 #ifdef TOOLS_ENABLED
 static bool editor_pseudolocalization = false;
 static bool dump_gdextension_interface = false;
@@ -684,6 +686,7 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("--fixed-fps <fps>", "Force a fixed number of frames per second. This setting disables real-time synchronization.\n");
 	print_help_option("--delta-smoothing <enable>", "Enable or disable frame delta smoothing [\"enable\", \"disable\"].\n");
 	print_help_option("--print-fps", "Print the frames per second to the stdout.\n");
+	print_help_option("--record-performance <file>", "Record per-frame timings and sampled custom monitors to the specified path (CSV with a .csv extension, binary otherwise).\n");
 #ifdef TOOLS_ENABLED
 	print_help_option("--editor-pseudolocalization", "Enable pseudolocalization for the editor and the project manager.\n", CLI_OPTION_AVAILABILITY_EDITOR);
 #endif
@@ -731,6 +734,8 @@ void Main::print_help(const char *p_binary) {
 #endif // TOOLS_ENABLED
 #ifdef TESTS_ENABLED
 	print_help_option("--test [--help]", "Run unit tests. Use --test --help for more information.\n");
+	print_help_option("--test --benchmark", "Run the microbenchmarks instead of the unit tests. Doctest filters can be used to select benchmarks.\n");
+	print_help_option("", "Use --benchmark-file <path> to also save the results to a given file in JSON format.\n");
 #endif // TESTS_ENABLED
 	OS::get_singleton()->print("\n");
 }
@@ -1969,6 +1974,14 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 			disable_vsync = true;
 		} else if (arg == "--print-fps") {
 			print_fps = true;
+		} else if (arg == "--record-performance") {
+			if (N) {
+				performance_recording_path = N->get();
+				N = N->next();
+			} else {
+				OS::get_singleton()->print("Missing record-performance argument, aborting.\n");
+				goto error;
+			}
 #ifdef TOOLS_ENABLED
 		} else if (arg == "--editor-pseudolocalization") {
 			editor_pseudolocalization = true;
@@ -3801,6 +3814,10 @@ Error Main::setup2(bool p_show_boot_logo) {
 		}
 	}
 
+	if (!performance_recording_path.is_empty()) {
+		performance->start_recording(performance_recording_path);
+	}
+
 	PackedStringArray extensions;
 	extensions.push_back("gd");
 	if (ClassDB::class_exists("CSharpScript")) {
@@ -5096,6 +5113,14 @@ bool Main::iteration() {
 	process_max = MAX(process_ticks, process_max);
 	uint64_t frame_time = OS::get_singleton()->get_ticks_usec() - ticks;
 
+#if !defined(NAVIGATION_2D_DISABLED) || !defined(NAVIGATION_3D_DISABLED)
+	performance->record_frame(ticks_elapsed, process_ticks, physics_process_ticks, navigation_process_ticks);
+#else
+	performance->record_frame(ticks_elapsed, process_ticks, physics_process_ticks, 0);
+#endif // !defined(NAVIGATION_2D_DISABLED) || !defined(NAVIGATION_3D_DISABLED)
+	message_queue->end_frame();
+	AnimationMixer::end_frame();
+
 	GodotProfileZoneGrouped(_profile_zone, "GDExtensionManager::frame");
 	GDExtensionManager::get_singleton()->frame();
 
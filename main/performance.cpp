@@ -33,8 +33,10 @@
 
 #include "core/config/engine.h"
 #include "core/object/class_db.h"
+#include "core/object/message_queue.h"
 #include "core/os/os.h"
 #include "core/variant/typed_array.h"
+#include "scene/animation/animation_mixer.h"
 #include "scene/main/node.h"
 #include "scene/main/scene_tree.h"
 #include "servers/audio/audio_server.h"
@@ -68,6 +70,20 @@ void Performance::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_custom_monitor_names"), &Performance::get_custom_monitor_names);
 	ClassDB::bind_method(D_METHOD("get_custom_monitor_types"), &Performance::get_custom_monitor_types);
 
+	ClassDB::bind_method(D_METHOD("set_sample_window_size", "frames"), &Performance::set_sample_window_size);
+	ClassDB::bind_method(D_METHOD("get_sample_window_size"), &Performance::get_sample_window_size);
+	ClassDB::bind_method(D_METHOD("clear_samples"), &Performance::clear_samples);
+	ClassDB::bind_method(D_METHOD("get_frame_sample_percentile", "sample", "percentile"), &Performance::get_frame_sample_percentile);
+	ClassDB::bind_method(D_METHOD("get_frame_sample_max", "sample"), &Performance::get_frame_sample_max);
+	ClassDB::bind_method(D_METHOD("get_frame_sample_stats", "sample"), &Performance::get_frame_sample_stats);
+	ClassDB::bind_method(D_METHOD("set_custom_monitor_sampling", "id", "enabled"), &Performance::set_custom_monitor_sampling);
+	ClassDB::bind_method(D_METHOD("is_custom_monitor_sampling", "id"), &Performance::is_custom_monitor_sampling);
+	ClassDB::bind_method(D_METHOD("get_custom_monitor_percentile", "id", "percentile"), &Performance::get_custom_monitor_percentile);
+	ClassDB::bind_method(D_METHOD("get_custom_monitor_stats", "id"), &Performance::get_custom_monitor_stats);
+	ClassDB::bind_method(D_METHOD("start_recording", "path"), &Performance::start_recording);
+	ClassDB::bind_method(D_METHOD("stop_recording"), &Performance::stop_recording);
+	ClassDB::bind_method(D_METHOD("is_recording"), &Performance::is_recording);
+
 	BIND_ENUM_CONSTANT(TIME_FPS);
 	BIND_ENUM_CONSTANT(TIME_PROCESS);
 	BIND_ENUM_CONSTANT(TIME_PHYSICS_PROCESS);
@@ -135,12 +151,26 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_EDGE_FREE_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_OBSTACLE_COUNT);
 #endif // NAVIGATION_3D_DISABLED
+	BIND_ENUM_CONSTANT(RESOURCE_STREAMING_MEMORY_USED);
+	BIND_ENUM_CONSTANT(RESOURCE_STREAMING_RESOURCE_COUNT);
+	BIND_ENUM_CONSTANT(RESOURCE_STREAMING_EVICTIONS);
+	BIND_ENUM_CONSTANT(MESSAGE_QUEUE_MESSAGES);
+	BIND_ENUM_CONSTANT(MESSAGE_QUEUE_COALESCED);
+	BIND_ENUM_CONSTANT(MESSAGE_QUEUE_FLUSH_TIME);
+	BIND_ENUM_CONSTANT(ANIMATION_MIXERS_UPDATED);
+	BIND_ENUM_CONSTANT(ANIMATION_MIXERS_SKIPPED);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 
 	BIND_ENUM_CONSTANT(MONITOR_TYPE_QUANTITY);
 	BIND_ENUM_CONSTANT(MONITOR_TYPE_MEMORY);
 	BIND_ENUM_CONSTANT(MONITOR_TYPE_TIME);
 	BIND_ENUM_CONSTANT(MONITOR_TYPE_PERCENTAGE);
+
+	BIND_ENUM_CONSTANT(FRAME_SAMPLE_FRAME_TIME);
+	BIND_ENUM_CONSTANT(FRAME_SAMPLE_PROCESS);
+	BIND_ENUM_CONSTANT(FRAME_SAMPLE_PHYSICS_PROCESS);
+	BIND_ENUM_CONSTANT(FRAME_SAMPLE_NAVIGATION_PROCESS);
+	BIND_ENUM_CONSTANT(FRAME_SAMPLE_MAX);
 }
 
 int Performance::_get_node_count() const {
@@ -230,6 +260,14 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("navigation_3d/edges_free"),
 		PNAME("navigation_3d/obstacles"),
 #endif // NAVIGATION_3D_DISABLED
+		PNAME("resource_streaming/memory_used"),
+		PNAME("resource_streaming/resources"),
+		PNAME("resource_streaming/evictions"),
+		PNAME("message_queue/messages"),
+		PNAME("message_queue/coalesced"),
+		PNAME("message_queue/flush_time"),
+		PNAME("animation/mixers_updated"),
+		PNAME("animation/mixers_skipped"),
 	};
 	static_assert(std_size(names) == MONITOR_MAX);
 
@@ -454,6 +492,22 @@ double Performance::get_monitor(Monitor p_monitor) const {
 		case NAVIGATION_3D_OBSTACLE_COUNT:
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_OBSTACLE_COUNT);
 #endif // NAVIGATION_3D_DISABLED
+		case RESOURCE_STREAMING_MEMORY_USED:
+			return ResourceCache::get_streaming_memory_usage();
+		case RESOURCE_STREAMING_RESOURCE_COUNT:
+			return ResourceCache::get_streaming_resource_count();
+		case RESOURCE_STREAMING_EVICTIONS:
+			return ResourceCache::get_streaming_eviction_count();
+		case MESSAGE_QUEUE_MESSAGES:
+			return MessageQueue::get_main_singleton()->get_frame_message_count();
+		case MESSAGE_QUEUE_COALESCED:
+			return MessageQueue::get_main_singleton()->get_frame_coalesced_count();
+		case MESSAGE_QUEUE_FLUSH_TIME:
+			return USEC_TO_SEC(MessageQueue::get_main_singleton()->get_frame_flush_time_usec());
+		case ANIMATION_MIXERS_UPDATED:
+			return AnimationMixer::get_frame_updated_count();
+		case ANIMATION_MIXERS_SKIPPED:
+			return AnimationMixer::get_frame_skipped_count();
 
 		default: {
 		}
@@ -527,7 +581,14 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 #endif // _3D_DISABLED
-
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
 	};
 	static_assert((sizeof(types) / sizeof(MonitorType)) == MONITOR_MAX);
 
@@ -554,6 +615,7 @@ void Performance::add_custom_monitor(const StringName &p_id, const Callable &p_c
 
 void Performance::remove_custom_monitor(const StringName &p_id) {
 	ERR_FAIL_COND_MSG(!has_custom_monitor(p_id), "Custom monitor with id '" + String(p_id) + "' doesn't exist.");
+	set_custom_monitor_sampling(p_id, false);
 	_monitor_map.erase(p_id);
 	_monitor_modification_time = OS::get_singleton()->get_ticks_usec();
 }
@@ -603,12 +665,295 @@ uint64_t Performance::get_monitor_modification_time() {
 	return _monitor_modification_time;
 }
 
+/* Frame samples and histograms */
+
+void Performance::SampleWindow::resize(uint32_t p_size) {
+	size.set(MIN(p_size, CAPACITY));
+	written.set(0);
+}
+
+void Performance::SampleWindow::clear() {
+	written.set(0);
+}
+
+void Performance::SampleWindow::push(float p_value) {
+	const uint32_t current_size = size.get();
+	if (current_size == 0) {
+		return;
+	}
+	const uint64_t pos = written.get();
+	samples[pos % current_size].set(p_value);
+	written.set(pos + 1);
+}
+
+uint32_t Performance::SampleWindow::_snapshot(LocalVector<float> &r_samples) const {
+	// Until the ring wraps around, the valid samples are at the front. Ordering doesn't matter for the statistics.
+	// A sample written during the copy may replace an older one, which doesn't matter either.
+	const uint32_t count = MIN(written.get(), (uint64_t)size.get());
+	r_samples.resize(count);
+	for (uint32_t i = 0; i < count; i++) {
+		r_samples[i] = samples[i].get();
+	}
+	return count;
+}
+
+static double _sorted_percentile(const LocalVector<float> &p_sorted, double p_percentile) {
+	if (p_sorted.is_empty()) {
+		return 0.0;
+	}
+	// Nearest-rank method, so the result is always an actual sample.
+	const int64_t rank = (int64_t)Math::ceil(CLAMP(p_percentile, 0.0, 100.0) / 100.0 * p_sorted.size());
+	return p_sorted[CLAMP(rank - 1, 0, (int64_t)p_sorted.size() - 1)];
+}
+
+Dictionary Performance::SampleWindow::get_stats() const {
+	LocalVector<float> sorted;
+	const uint32_t count = _snapshot(sorted);
+
+	double sum = 0.0;
+	for (const float sample : sorted) {
+		sum += sample;
+	}
+	sorted.sort();
+
+	Dictionary stats;
+	stats["count"] = count;
+	stats["min"] = count > 0 ? sorted[0] : 0.0;
+	stats["max"] = count > 0 ? sorted[count - 1] : 0.0;
+	stats["avg"] = count > 0 ? sum / count : 0.0;
+	stats["p50"] = _sorted_percentile(sorted, 50.0);
+	stats["p95"] = _sorted_percentile(sorted, 95.0);
+	stats["p99"] = _sorted_percentile(sorted, 99.0);
+	return stats;
+}
+
+double Performance::SampleWindow::get_percentile(double p_percentile) const {
+	LocalVector<float> sorted;
+	_snapshot(sorted);
+	sorted.sort();
+	return _sorted_percentile(sorted, p_percentile);
+}
+
+double Performance::SampleWindow::get_max() const {
+	LocalVector<float> snapshot;
+	_snapshot(snapshot);
+	float max = 0.0;
+	for (const float sample : snapshot) {
+		max = MAX(max, sample);
+	}
+	return max;
+}
+
+void Performance::set_sample_window_size(int p_frames) {
+	ERR_FAIL_COND_MSG(p_frames < 0, "The sample window size can't be negative.");
+	ERR_FAIL_COND_MSG(p_frames > MAX_SAMPLE_WINDOW_SIZE, vformat("The sample window size can't be larger than %d frames.", MAX_SAMPLE_WINDOW_SIZE));
+	_sample_window_size = p_frames;
+	for (SampleWindow &window : _frame_samples) {
+		window.resize(_sample_window_size);
+	}
+	for (KeyValue<StringName, SampleWindow *> &E : _custom_monitor_samples) {
+		E.value->resize(_sample_window_size);
+	}
+}
+
+int Performance::get_sample_window_size() const {
+	return _sample_window_size;
+}
+
+void Performance::clear_samples() {
+	for (SampleWindow &window : _frame_samples) {
+		window.clear();
+	}
+	for (KeyValue<StringName, SampleWindow *> &E : _custom_monitor_samples) {
+		E.value->clear();
+	}
+}
+
+double Performance::get_frame_sample_percentile(FrameSample p_sample, double p_percentile) const {
+	ERR_FAIL_INDEX_V(p_sample, FRAME_SAMPLE_MAX, 0.0);
+	return _frame_samples[p_sample].get_percentile(p_percentile);
+}
+
+double Performance::get_frame_sample_max(FrameSample p_sample) const {
+	ERR_FAIL_INDEX_V(p_sample, FRAME_SAMPLE_MAX, 0.0);
+	return _frame_samples[p_sample].get_max();
+}
+
+Dictionary Performance::get_frame_sample_stats(FrameSample p_sample) const {
+	ERR_FAIL_INDEX_V(p_sample, FRAME_SAMPLE_MAX, Dictionary());
+	return _frame_samples[p_sample].get_stats();
+}
+
+void Performance::set_custom_monitor_sampling(const StringName &p_id, bool p_enabled) {
+	ERR_FAIL_COND_MSG(!has_custom_monitor(p_id), "Custom monitor with id '" + String(p_id) + "' doesn't exist.");
+	SampleWindow **window = _custom_monitor_samples.getptr(p_id);
+	if (p_enabled && !window) {
+		SampleWindow *new_window = memnew(SampleWindow);
+		new_window->resize(_sample_window_size);
+		_custom_monitor_samples.insert(p_id, new_window);
+	} else if (!p_enabled && window) {
+		memdelete(*window);
+		_custom_monitor_samples.erase(p_id);
+	}
+}
+
+bool Performance::is_custom_monitor_sampling(const StringName &p_id) const {
+	return _custom_monitor_samples.has(p_id);
+}
+
+double Performance::get_custom_monitor_percentile(const StringName &p_id, double p_percentile) const {
+	SampleWindow *const *window = _custom_monitor_samples.getptr(p_id);
+	ERR_FAIL_NULL_V_MSG(window, 0.0, "Custom monitor with id '" + String(p_id) + "' isn't being sampled.");
+	return (*window)->get_percentile(p_percentile);
+}
+
+Dictionary Performance::get_custom_monitor_stats(const StringName &p_id) const {
+	SampleWindow *const *window = _custom_monitor_samples.getptr(p_id);
+	ERR_FAIL_NULL_V_MSG(window, Dictionary(), "Custom monitor with id '" + String(p_id) + "' isn't being sampled.");
+	return (*window)->get_stats();
+}
+
+void Performance::record_frame(uint64_t p_frame_usec, uint64_t p_process_usec, uint64_t p_physics_usec, uint64_t p_navigation_usec) {
+	float values[FRAME_SAMPLE_MAX];
+	values[FRAME_SAMPLE_FRAME_TIME] = USEC_TO_SEC(p_frame_usec);
+	values[FRAME_SAMPLE_PROCESS] = USEC_TO_SEC(p_process_usec);
+	values[FRAME_SAMPLE_PHYSICS_PROCESS] = USEC_TO_SEC(p_physics_usec);
+	values[FRAME_SAMPLE_NAVIGATION_PROCESS] = USEC_TO_SEC(p_navigation_usec);
+
+	for (int i = 0; i < FRAME_SAMPLE_MAX; i++) {
+		_frame_samples[i].push(values[i]);
+	}
+
+	// Monitors removed after the recording started are written as zero to keep rows aligned.
+	for (float &value : _recording_custom_values) {
+		value = 0.0;
+	}
+
+	for (KeyValue<StringName, SampleWindow *> &E : _custom_monitor_samples) {
+		bool error;
+		String error_message;
+		const Variant value = _monitor_map[E.key].call(error, error_message);
+		if (error) {
+			continue;
+		}
+		E.value->push(value);
+		const int64_t column = _recording_custom_columns.find(E.key);
+		if (column >= 0) {
+			_recording_custom_values[column] = value;
+		}
+	}
+
+	if (_recording_file.is_valid()) {
+		_write_recording_row(values, FRAME_SAMPLE_MAX);
+	}
+	_recording_frame++;
+}
+
+/* Recording */
+
+static const char *_frame_sample_names[Performance::FRAME_SAMPLE_MAX] = {
+	"frame_time",
+	"process",
+	"physics_process",
+	"navigation_process",
+};
+
+Error Performance::start_recording(const String &p_path) {
+	ERR_FAIL_COND_V_MSG(_recording_file.is_valid(), ERR_ALREADY_IN_USE, "Performance recording is already in progress.");
+
+	Error err;
+	_recording_file = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, vformat("Cannot open file '%s' for performance recording.", p_path));
+
+	_recording_format = p_path.has_extension("csv") ? RECORDING_FORMAT_CSV : RECORDING_FORMAT_BINARY;
+	_recording_frame = 0;
+	// The set of columns is fixed for the whole recording.
+	_recording_custom_columns.clear();
+	for (const KeyValue<StringName, SampleWindow *> &E : _custom_monitor_samples) {
+		_recording_custom_columns.push_back(E.key);
+	}
+	_recording_custom_values.resize(_recording_custom_columns.size());
+
+	Vector<String> columns;
+	columns.push_back("frame");
+	for (const char *name : _frame_sample_names) {
+		columns.push_back(name);
+	}
+	for (const StringName &id : _recording_custom_columns) {
+		columns.push_back(id);
+	}
+
+	if (_recording_format == RECORDING_FORMAT_CSV) {
+		_recording_file->store_csv_line(columns);
+	} else {
+		// Header: magic, version, column count and names. Each row is then a 64-bit frame number
+		// followed by one 32-bit float per remaining column.
+		_recording_file->store_buffer((const uint8_t *)"GDPF", 4);
+		_recording_file->store_32(1);
+		_recording_file->store_32(columns.size());
+		for (const String &column : columns) {
+			_recording_file->store_pascal_string(column);
+		}
+	}
+
+	return OK;
+}
+
+void Performance::stop_recording() {
+	if (_recording_file.is_null()) {
+		return;
+	}
+	_recording_file->flush();
+	_recording_file.unref();
+	_recording_custom_columns.clear();
+	_recording_custom_values.clear();
+}
+
+bool Performance::is_recording() const {
+	return _recording_file.is_valid();
+}
+
+void Performance::_write_recording_row(const float *p_values, uint32_t p_count) {
+	if (_recording_format == RECORDING_FORMAT_CSV) {
+		String line = itos(_recording_frame);
+		for (uint32_t i = 0; i < p_count; i++) {
+			line += "," + String::num(p_values[i], 6);
+		}
+		for (const float value : _recording_custom_values) {
+			line += "," + String::num(value, 6);
+		}
+		_recording_file->store_line(line);
+	} else {
+		_recording_file->store_64(_recording_frame);
+		for (uint32_t i = 0; i < p_count; i++) {
+			_recording_file->store_float(p_values[i]);
+		}
+		for (const float value : _recording_custom_values) {
+			_recording_file->store_float(value);
+		}
+	}
+}
+
 Performance::Performance() {
 	_process_time = 0;
 	_physics_process_time = 0;
 	_navigation_process_time = 0;
 	_monitor_modification_time = 0;
 	singleton = this;
+
+	// About 10 seconds at 60 FPS.
+	set_sample_window_size(600);
+}
+
+Performance::~Performance() {
+	stop_recording();
+	for (KeyValue<StringName, SampleWindow *> &E : _custom_monitor_samples) {
+		memdelete(E.value);
+	}
+	_custom_monitor_samples.clear();
+	if (singleton == this) {
+		singleton = nullptr;
+	}
 }
 
 Performance::MonitorCall::MonitorCall(Performance::MonitorType p_type, const Callable &p_callable, const Vector<Variant> &p_arguments) {
@@ -30,8 +30,11 @@
 
 #pragma once
 
+#include "core/io/file_access.h"
 #include "core/object/object.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "core/variant/type_info.h"
 
 #define PERF_WARN_OFFLINE_FUNCTION
@@ -58,6 +61,31 @@ class Performance : public Object {
 	double _physics_process_time;
 	double _navigation_process_time;
 
+	// Rolling window of per-frame samples. There is a single writer (the main
+	// thread, once per frame). Slots have a fixed capacity and are atomic, so
+	// readers on other threads can copy them without locking, and resizing only
+	// changes how many slots are in use.
+	class SampleWindow {
+	public:
+		static constexpr uint32_t CAPACITY = 3600;
+
+	private:
+		SafeNumeric<float> samples[CAPACITY];
+		SafeNumeric<uint32_t> size;
+		SafeNumeric<uint64_t> written;
+
+	public:
+		void resize(uint32_t p_size);
+		void clear();
+		void push(float p_value);
+		Dictionary get_stats() const;
+		double get_percentile(double p_percentile) const;
+		double get_max() const;
+
+	private:
+		uint32_t _snapshot(LocalVector<float> &r_samples) const;
+	};
+
 public:
 	enum Monitor {
 		TIME_FPS,
@@ -122,6 +150,14 @@ public:
 		NAVIGATION_3D_EDGE_FREE_COUNT,
 		NAVIGATION_3D_OBSTACLE_COUNT,
 #endif // _3D_DISABLED
+		RESOURCE_STREAMING_MEMORY_USED,
+		RESOURCE_STREAMING_RESOURCE_COUNT,
+		RESOURCE_STREAMING_EVICTIONS,
+		MESSAGE_QUEUE_MESSAGES,
+		MESSAGE_QUEUE_COALESCED,
+		MESSAGE_QUEUE_FLUSH_TIME,
+		ANIMATION_MIXERS_UPDATED,
+		ANIMATION_MIXERS_SKIPPED,
 		MONITOR_MAX
 	};
 
@@ -132,6 +168,14 @@ public:
 		MONITOR_TYPE_PERCENTAGE,
 	};
 
+	enum FrameSample {
+		FRAME_SAMPLE_FRAME_TIME,
+		FRAME_SAMPLE_PROCESS,
+		FRAME_SAMPLE_PHYSICS_PROCESS,
+		FRAME_SAMPLE_NAVIGATION_PROCESS,
+		FRAME_SAMPLE_MAX
+	};
+
 	double get_monitor(Monitor p_monitor) const;
 	String get_monitor_name(Monitor p_monitor) const;
 
@@ -150,9 +194,32 @@ public:
 
 	uint64_t get_monitor_modification_time();
 
+	static constexpr int MAX_SAMPLE_WINDOW_SIZE = SampleWindow::CAPACITY;
+
+	void set_sample_window_size(int p_frames);
+	int get_sample_window_size() const;
+	void clear_samples();
+
+	double get_frame_sample_percentile(FrameSample p_sample, double p_percentile) const;
+	double get_frame_sample_max(FrameSample p_sample) const;
+	Dictionary get_frame_sample_stats(FrameSample p_sample) const;
+
+	void set_custom_monitor_sampling(const StringName &p_id, bool p_enabled);
+	bool is_custom_monitor_sampling(const StringName &p_id) const;
+	double get_custom_monitor_percentile(const StringName &p_id, double p_percentile) const;
+	Dictionary get_custom_monitor_stats(const StringName &p_id) const;
+
+	Error start_recording(const String &p_path);
+	void stop_recording();
+	bool is_recording() const;
+
+	// Called once per frame by the main loop, times are in microseconds.
+	void record_frame(uint64_t p_frame_usec, uint64_t p_process_usec, uint64_t p_physics_usec, uint64_t p_navigation_usec);
+
 	static Performance *get_singleton() { return singleton; }
 
 	Performance();
+	~Performance();
 
 private:
 	class MonitorCall {
@@ -169,7 +236,27 @@ private:
 
 	HashMap<StringName, MonitorCall> _monitor_map;
 	uint64_t _monitor_modification_time;
+
+	// Custom monitors are only sampled every frame when requested, as it involves calling their callable.
+	HashMap<StringName, SampleWindow *> _custom_monitor_samples;
+
+	SampleWindow _frame_samples[FRAME_SAMPLE_MAX];
+	uint32_t _sample_window_size = 0;
+
+	enum RecordingFormat {
+		RECORDING_FORMAT_CSV,
+		RECORDING_FORMAT_BINARY,
+	};
+
+	Ref<FileAccess> _recording_file;
+	RecordingFormat _recording_format = RECORDING_FORMAT_BINARY;
+	LocalVector<StringName> _recording_custom_columns;
+	LocalVector<float> _recording_custom_values;
+	uint64_t _recording_frame = 0;
+
+	void _write_recording_row(const float *p_values, uint32_t p_count);
 };
 
 VARIANT_ENUM_CAST(Performance::Monitor);
 VARIANT_ENUM_CAST(Performance::MonitorType);
+VARIANT_ENUM_CAST(Performance::FrameSample);
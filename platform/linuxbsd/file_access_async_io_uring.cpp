@@ -0,0 +1,346 @@
+/**************************************************************************/
+/*  file_access_async_io_uring.cpp                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "file_access_async_io_uring.h"
+
+#include "core/variant/variant.h"
+
+#ifdef IO_URING_ENABLED
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+
+bool FileAccessAsyncIOUring::_setup_ring() {
+	struct io_uring_params params = {};
+	ring_fd = syscall(__NR_io_uring_setup, QUEUE_DEPTH, &params);
+	if (ring_fd < 0) {
+		ring_fd = -1;
+		return false;
+	}
+
+	sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+	cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+	const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+	if (single_mmap) {
+		sq_ring_size = MAX(sq_ring_size, cq_ring_size);
+		cq_ring_size = sq_ring_size;
+	}
+
+	sq_ring = mmap(nullptr, sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQ_RING);
+	if (sq_ring == MAP_FAILED) {
+		sq_ring = nullptr;
+		_close_ring();
+		return false;
+	}
+
+	if (single_mmap) {
+		cq_ring = sq_ring;
+	} else {
+		cq_ring = mmap(nullptr, cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_CQ_RING);
+		if (cq_ring == MAP_FAILED) {
+			cq_ring = nullptr;
+			_close_ring();
+			return false;
+		}
+	}
+
+	sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+	void *sqes_ptr = mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQES);
+	if (sqes_ptr == MAP_FAILED) {
+		_close_ring();
+		return false;
+	}
+	sqes = (struct io_uring_sqe *)sqes_ptr;
+
+	uint8_t *sq = (uint8_t *)sq_ring;
+	sq_head = (uint32_t *)(sq + params.sq_off.head);
+	sq_tail = (uint32_t *)(sq + params.sq_off.tail);
+	sq_mask = (uint32_t *)(sq + params.sq_off.ring_mask);
+	sq_array = (uint32_t *)(sq + params.sq_off.array);
+	sq_entries = params.sq_entries;
+
+	uint8_t *cq = (uint8_t *)cq_ring;
+	cq_head = (uint32_t *)(cq + params.cq_off.head);
+	cq_tail = (uint32_t *)(cq + params.cq_off.tail);
+	cq_mask = (uint32_t *)(cq + params.cq_off.ring_mask);
+	cqes = (struct io_uring_cqe *)(cq + params.cq_off.cqes);
+	cq_entries = params.cq_entries;
+
+	return true;
+}
+
+void FileAccessAsyncIOUring::_close_ring() {
+	if (sqes) {
+		munmap(sqes, sqes_size);
+		sqes = nullptr;
+	}
+	if (cq_ring && cq_ring != sq_ring) {
+		munmap(cq_ring, cq_ring_size);
+	}
+	cq_ring = nullptr;
+	if (sq_ring) {
+		munmap(sq_ring, sq_ring_size);
+		sq_ring = nullptr;
+	}
+	if (ring_fd >= 0) {
+		close(ring_fd);
+		ring_fd = -1;
+	}
+}
+
+uint32_t FileAccessAsyncIOUring::_get_pending_sqe_count() const {
+	return __atomic_load_n(sq_tail, __ATOMIC_ACQUIRE) - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+}
+
+// Must be called with `submit_mutex` locked. Returns `false` if the rings are full.
+bool FileAccessAsyncIOUring::_push_sqe(uint8_t p_opcode, Request *p_request) {
+	const uint32_t tail = *sq_tail;
+	const uint32_t head = __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+	if (tail - head >= sq_entries || in_flight >= cq_entries) {
+		return false;
+	}
+
+	const uint32_t index = tail & *sq_mask;
+	struct io_uring_sqe *sqe = &sqes[index];
+	memset(sqe, 0, sizeof(*sqe));
+	sqe->opcode = p_opcode;
+	sqe->fd = -1;
+	if (p_request) {
+		sqe->fd = p_request->fd;
+		sqe->off = p_request->file_offset;
+		sqe->addr = (uint64_t)(uintptr_t)&p_request->iov;
+		sqe->len = 1;
+	}
+	sqe->user_data = (uint64_t)(uintptr_t)p_request;
+	sq_array[index] = index;
+	__atomic_store_n(sq_tail, tail + 1, __ATOMIC_RELEASE);
+	in_flight++;
+
+	int ret;
+	do {
+		// Submit every entry the kernel hasn't consumed yet, including any left over from a failed call.
+		ret = syscall(__NR_io_uring_enter, ring_fd, _get_pending_sqe_count(), 0, 0, nullptr, 0);
+	} while (ret < 0 && errno == EINTR);
+	ERR_FAIL_COND_V_MSG(ret < 0, true, vformat("io_uring submission failed with error %d.", errno)); // The entry is submitted with the next call.
+
+	return true;
+}
+
+// Must be called with `submit_mutex` locked.
+void FileAccessAsyncIOUring::_queue_request(Request *p_request) {
+	if (p_request->read->discard) {
+		p_request->iov.iov_base = p_request->prefetch_buffer.ptr();
+		p_request->iov.iov_len = MIN(p_request->remaining, (uint64_t)p_request->prefetch_buffer.size());
+	} else {
+		p_request->iov.iov_base = p_request->dst + p_request->done;
+		p_request->iov.iov_len = MIN(p_request->remaining, MAX_READ_SIZE);
+	}
+
+	if (!_push_sqe(IORING_OP_READV, p_request)) {
+		backlog.push_back(p_request);
+	}
+}
+
+void FileAccessAsyncIOUring::_finish_request(Request *p_request, Error p_error) {
+	Read *read = p_request->read;
+	if (p_request->fd >= 0) {
+		close(p_request->fd);
+	}
+	memdelete(p_request);
+	_finish_read(read, p_error);
+}
+
+void FileAccessAsyncIOUring::_complete_request(Request *p_request, int p_result) {
+	if (p_result == -EINTR || p_result == -EAGAIN) {
+		MutexLock lock(submit_mutex);
+		_queue_request(p_request);
+		return;
+	}
+
+	if (p_result < 0) {
+		_finish_request(p_request, ERR_FILE_CANT_READ);
+		return;
+	}
+
+	if (p_result == 0) {
+		// The file is shorter than when the read was submitted.
+		if (!p_request->read->discard) {
+			p_request->read->data.resize(p_request->done);
+		}
+		_finish_request(p_request, OK);
+		return;
+	}
+
+	p_request->done += p_result;
+	p_request->file_offset += p_result;
+	p_request->remaining -= p_result;
+	if (p_request->remaining == 0) {
+		_finish_request(p_request, OK);
+		return;
+	}
+
+	// Short read, continue where it stopped.
+	MutexLock lock(submit_mutex);
+	_queue_request(p_request);
+}
+
+void FileAccessAsyncIOUring::_completion_thread_func(void *p_self) {
+	FileAccessAsyncIOUring *self = (FileAccessAsyncIOUring *)p_self;
+
+	while (true) {
+		// Also submits entries stranded by a failed submission, which would otherwise never complete.
+		int ret = syscall(__NR_io_uring_enter, self->ring_fd, self->_get_pending_sqe_count(), 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+		if (ret < 0 && errno != EINTR) {
+			ERR_PRINT(vformat("Waiting for io_uring completions failed with error %d.", errno));
+		}
+
+		uint32_t head = *self->cq_head;
+		while (head != __atomic_load_n(self->cq_tail, __ATOMIC_ACQUIRE)) {
+			const struct io_uring_cqe *cqe = &self->cqes[head & *self->cq_mask];
+			Request *request = (Request *)(uintptr_t)cqe->user_data;
+			const int result = cqe->res;
+
+			head++;
+			__atomic_store_n(self->cq_head, head, __ATOMIC_RELEASE);
+			{
+				MutexLock lock(self->submit_mutex);
+				self->in_flight--;
+			}
+
+			if (request) {
+				self->_complete_request(request, result);
+			}
+		}
+
+		MutexLock lock(self->submit_mutex);
+		while (!self->backlog.is_empty() && self->_push_sqe(IORING_OP_READV, self->backlog.front()->get())) {
+			self->backlog.pop_front();
+		}
+		if (self->ring_exiting && self->in_flight == 0 && self->backlog.is_empty()) {
+			return;
+		}
+	}
+}
+
+bool FileAccessAsyncIOUring::_ensure_ring() {
+	MutexLock lock(submit_mutex);
+	if (!ring_setup_done) {
+		// Done on first use, so processes that never read asynchronously don't pay for the ring and its thread.
+		ring_setup_done = true;
+		if (_setup_ring()) {
+			completion_thread.start(&FileAccessAsyncIOUring::_completion_thread_func, this);
+		} else {
+			print_verbose("io_uring is not available, asynchronous file reads will use threads.");
+		}
+	}
+	return ring_fd >= 0;
+}
+
+bool FileAccessAsyncIOUring::_submit_native(Read *p_read) {
+	if (!_ensure_ring()) {
+		return false;
+	}
+
+	OSFileRange range;
+	if (!_get_os_file_range(p_read->path, p_read->offset, p_read->length, range)) {
+		return false;
+	}
+
+	const int fd = open(range.path.utf8().get_data(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0) {
+		return false; // Let the fallback report the error.
+	}
+
+	struct stat st = {};
+	if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || range.offset > uint64_t(st.st_size)) {
+		close(fd);
+		return false;
+	}
+
+	uint64_t length = st.st_size - range.offset;
+	if (range.length >= 0) {
+		length = MIN(length, uint64_t(range.length));
+	}
+
+	Request *request = memnew(Request);
+	request->read = p_read;
+	request->fd = fd;
+	request->file_offset = range.offset;
+	request->remaining = length;
+
+	if (p_read->discard) {
+		request->prefetch_buffer.resize(MIN(length, PREFETCH_BUFFER_SIZE));
+	} else {
+		if (p_read->data.resize(length) != OK) {
+			close(fd);
+			memdelete(request);
+			return false;
+		}
+		request->dst = p_read->data.ptrw();
+	}
+
+	if (length == 0) {
+		_finish_request(request, OK);
+		return true;
+	}
+
+	MutexLock lock(submit_mutex);
+	_queue_request(request);
+	return true;
+}
+
+FileAccessAsync *FileAccessAsyncIOUring::_create_func() {
+	return memnew(FileAccessAsyncIOUring);
+}
+
+void FileAccessAsyncIOUring::make_default() {
+	_create = &_create_func;
+}
+
+FileAccessAsyncIOUring::~FileAccessAsyncIOUring() {
+	{
+		MutexLock lock(submit_mutex);
+		if (ring_fd < 0) {
+			return;
+		}
+		ring_exiting = true;
+		_push_sqe(IORING_OP_NOP, nullptr); // Wake up the completion thread.
+	}
+	completion_thread.wait_to_finish();
+	_close_ring();
+}
+
+#endif // IO_URING_ENABLED
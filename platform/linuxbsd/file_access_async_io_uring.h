@@ -0,0 +1,114 @@
+/**************************************************************************/
+/*  file_access_async_io_uring.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define IO_URING_ENABLED
+#endif
+#endif
+
+#ifdef IO_URING_ENABLED
+
+#include "core/io/file_access_async.h"
+#include "core/templates/local_vector.h"
+
+#include <sys/uio.h>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+// Reads host filesystem files (including files stored as-is in PCKs) through io_uring,
+// so many reads can be in flight without a thread waiting on each of them.
+// Falls back to the I/O threads when io_uring is not available (old kernel, seccomp, etc.).
+class FileAccessAsyncIOUring : public FileAccessAsync {
+	static constexpr uint32_t QUEUE_DEPTH = 256;
+	static constexpr uint64_t MAX_READ_SIZE = 1 << 30; // Per submission.
+	static constexpr uint64_t PREFETCH_BUFFER_SIZE = 1 << 20;
+
+	struct Request {
+		Read *read = nullptr;
+		int fd = -1;
+		uint64_t file_offset = 0;
+		uint64_t remaining = 0;
+		uint64_t done = 0;
+		uint8_t *dst = nullptr; // Into the read's data, unless prefetching.
+		LocalVector<uint8_t> prefetch_buffer;
+		struct iovec iov = {};
+	};
+
+	int ring_fd = -1;
+	void *sq_ring = nullptr;
+	size_t sq_ring_size = 0;
+	void *cq_ring = nullptr;
+	size_t cq_ring_size = 0;
+	io_uring_sqe *sqes = nullptr;
+	size_t sqes_size = 0;
+
+	uint32_t *sq_head = nullptr;
+	uint32_t *sq_tail = nullptr;
+	uint32_t *sq_mask = nullptr;
+	uint32_t *sq_array = nullptr;
+	uint32_t sq_entries = 0;
+	uint32_t *cq_head = nullptr;
+	uint32_t *cq_tail = nullptr;
+	uint32_t *cq_mask = nullptr;
+	io_uring_cqe *cqes = nullptr;
+	uint32_t cq_entries = 0;
+
+	Mutex submit_mutex;
+	uint32_t in_flight = 0;
+	List<Request *> backlog; // Waiting for room in the rings.
+	bool ring_setup_done = false;
+	bool ring_exiting = false;
+	Thread completion_thread;
+
+	bool _setup_ring();
+	bool _ensure_ring();
+	void _close_ring();
+	uint32_t _get_pending_sqe_count() const;
+	bool _push_sqe(uint8_t p_opcode, Request *p_request);
+	void _queue_request(Request *p_request);
+	void _complete_request(Request *p_request, int p_result);
+	void _finish_request(Request *p_request, Error p_error);
+	static void _completion_thread_func(void *p_self);
+	static FileAccessAsync *_create_func();
+
+protected:
+	virtual bool _submit_native(Read *p_read) override;
+
+public:
+	static void make_default();
+
+	~FileAccessAsyncIOUring();
+};
+
+#endif // IO_URING_ENABLED
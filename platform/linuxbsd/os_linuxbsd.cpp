@@ -40,6 +40,8 @@
 #include "servers/display/display_server.h"
 #include "servers/rendering/rendering_server.h"
 
+#include "file_access_async_io_uring.h"
+
 #ifdef SDL_ENABLED
 #include "drivers/sdl/joypad_sdl.h"
 #endif
@@ -169,6 +171,10 @@ void OS_LinuxBSD::alert(const String &p_alert, const String &p_title) {
 void OS_LinuxBSD::initialize() {
 	crash_handler.initialize();
 
+#ifdef IO_URING_ENABLED
+	FileAccessAsyncIOUring::make_default();
+#endif
+
 	OS_Unix::initialize_core();
 
 	system_dir_desktop_cache = get_system_dir(SYSTEM_DIR_DESKTOP);
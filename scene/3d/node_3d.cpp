@@ -114,6 +114,16 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		return;
 	}
 
+	if (this == p_origin && get_tree()->is_batching_transform_propagation() && Thread::is_main_thread()) {
+		// Only this node is marked now, the subtree is updated by SceneTree::flush_transform_propagation(),
+		// so moving the same branch several times in a frame only walks it once.
+		_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM | DIRTY_GLOBAL_INTERPOLATED_TRANSFORM);
+		if (!xform_propagate.in_list()) {
+			get_tree()->xform_propagate_list.add(&xform_propagate);
+		}
+		return;
+	}
+
 	for (uint32_t n = 0; n < data.node3d_children.size(); n++) {
 		Node3D *s = data.node3d_children[n];
 
@@ -139,6 +149,38 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 	_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM | DIRTY_GLOBAL_INTERPOLATED_TRANSFORM);
 }
 
+void Node3D::_propagate_transform_batched(bool p_root, LocalVector<Node3D *> &r_children, LocalVector<Node3D *> &r_notify) {
+	_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM | DIRTY_GLOBAL_INTERPOLATED_TRANSFORM);
+	// Resolve the global transform right away, as the parent has just been resolved as well.
+	_ALLOW_DISCARD_ get_global_transform();
+
+#ifdef TOOLS_ENABLED
+	if ((!data.gizmos.is_empty() || data.notify_transform) && !data.ignore_notification && !xform_change.in_list()) {
+#else
+	if (data.notify_transform && !data.ignore_notification && !xform_change.in_list()) {
+#endif
+		r_notify.push_back(this);
+	}
+
+	for (Node3D *child : data.node3d_children) {
+		// Don't propagate to a toplevel.
+		if (!child->data.top_level) {
+			r_children.push_back(child);
+		}
+	}
+}
+
+bool Node3D::_is_below_pending_transform_propagation() const {
+	const Node3D *node = this;
+	while (node->data.parent && !node->data.top_level) {
+		node = node->data.parent;
+		if (node->xform_propagate.in_list()) {
+			return true;
+		}
+	}
+	return false;
+}
+
 void Node3D::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_ACCESSIBILITY_UPDATE: {
@@ -214,6 +256,9 @@ void Node3D::_notification(int p_what) {
 			if (xform_change.in_list()) {
 				get_tree()->xform_change_list.remove(&xform_change);
 			}
+			if (xform_propagate.in_list()) {
+				get_tree()->xform_propagate_list.remove(&xform_propagate);
+			}
 
 			if (data.parent) {
 				if (data.index_in_parent != UINT32_MAX) {
@@ -640,6 +685,10 @@ Transform3D Node3D::get_global_transform_interpolated() {
 Transform3D Node3D::get_global_transform() const {
 	ERR_FAIL_COND_V(!is_inside_tree(), Transform3D());
 
+	if (unlikely(get_tree()->has_pending_transform_propagation()) && Thread::is_main_thread() && _is_below_pending_transform_propagation()) {
+		get_tree()->flush_transform_propagation();
+	}
+
 	/* Due to how threads work at scene level, while this global transform won't be able to be changed from outside a thread,
 	 * it is possible that multiple threads can access it while it's dirty from previous work. Due to this, we must ensure that
 	 * the dirty/update process is thread safe by utilizing atomic copies.
@@ -1540,7 +1589,7 @@ void Node3D::_bind_methods() {
 }
 
 Node3D::Node3D() :
-		xform_change(this), _client_physics_interpolation_node_3d_list(this) {
+		xform_change(this), xform_propagate(this), _client_physics_interpolation_node_3d_list(this) {
 	_define_ancestry(AncestralClass::NODE_3D);
 
 	// Default member initializer for bitfield is a C++20 extension, so:
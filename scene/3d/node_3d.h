@@ -50,6 +50,7 @@ public:
 class Node3D : public Node {
 	GDCLASS(Node3D, Node);
 
+	friend class SceneTree;
 	friend class SceneTreeFTI;
 	friend class SceneTreeFTITests;
 
@@ -98,6 +99,7 @@ private:
 	};
 
 	mutable SelfList<Node> xform_change;
+	SelfList<Node> xform_propagate;
 	SelfList<Node3D> _client_physics_interpolation_node_3d_list;
 
 	// This Data struct is to avoid namespace pollution in derived classes.
@@ -159,6 +161,10 @@ private:
 		LocalVector<Node3D *> node3d_children;
 		uint32_t index_in_parent = UINT32_MAX;
 
+		// Where the interpolated local xform is in the SceneTreeFTI batch,
+		// only valid during a frame update.
+		uint32_t fti_batch_index = UINT32_MAX;
+
 		ClientPhysicsInterpolationData *client_physics_interpolation_data = nullptr;
 
 #ifdef TOOLS_ENABLED
@@ -182,6 +188,8 @@ private:
 	void _update_gizmos();
 	void _notify_dirty();
 	void _propagate_transform_changed(Node3D *p_origin);
+	void _propagate_transform_batched(bool p_root, LocalVector<Node3D *> &r_children, LocalVector<Node3D *> &r_notify);
+	bool _is_below_pending_transform_propagation() const;
 
 	void _propagate_visibility_changed();
 
@@ -35,8 +35,10 @@
 #include "core/config/project_settings.h"
 #include "core/object/callable_mp.h"
 #include "core/object/class_db.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/string/string_name.h"
 #include "scene/2d/audio_stream_player_2d.h"
+#include "scene/2d/visible_on_screen_notifier_2d.h"
 #include "scene/animation/animation_player.h"
 #include "scene/audio/audio_stream_player.h"
 #include "scene/resources/animation.h"
@@ -45,15 +47,24 @@
 
 #ifndef _3D_DISABLED
 #include "scene/3d/audio_stream_player_3d.h"
+#include "scene/3d/camera_3d.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/3d/node_3d.h"
 #include "scene/3d/skeleton_3d.h"
+#include "scene/3d/visible_on_screen_notifier_3d.h"
+#include "scene/main/viewport.h"
 #endif // _3D_DISABLED
 
 #ifdef TOOLS_ENABLED
 #include "editor/editor_undo_redo_manager.h"
 #endif // TOOLS_ENABLED
 
+LocalVector<ObjectID> AnimationMixer::threaded_blend_queue;
+SafeNumeric<uint32_t> AnimationMixer::lod_frame_updated_count;
+SafeNumeric<uint32_t> AnimationMixer::lod_frame_skipped_count;
+uint32_t AnimationMixer::lod_last_frame_updated_count = 0;
+uint32_t AnimationMixer::lod_last_frame_skipped_count = 0;
+
 bool AnimationMixer::_set(const StringName &p_name, const Variant &p_value) {
 	String name = p_name;
 
@@ -550,6 +561,156 @@ int AnimationMixer::get_audio_max_polyphony() const {
 	return audio_max_polyphony;
 }
 
+void AnimationMixer::set_lod_update_interval(int p_interval) {
+	ERR_FAIL_COND(p_interval < 1);
+	lod_update_interval = p_interval;
+}
+
+int AnimationMixer::get_lod_update_interval() const {
+	return lod_update_interval;
+}
+
+void AnimationMixer::set_lod_interpolate(bool p_interpolate) {
+	lod_interpolate = p_interpolate;
+}
+
+bool AnimationMixer::is_lod_interpolating() const {
+	return lod_interpolate;
+}
+
+void AnimationMixer::set_lod_source(const NodePath &p_source) {
+	lod_source = p_source;
+}
+
+NodePath AnimationMixer::get_lod_source() const {
+	return lod_source;
+}
+
+void AnimationMixer::set_lod_distance(real_t p_distance) {
+	lod_distance = MAX(p_distance, 0.0);
+}
+
+real_t AnimationMixer::get_lod_distance() const {
+	return lod_distance;
+}
+
+void AnimationMixer::set_lod_distant_update_interval(int p_interval) {
+	ERR_FAIL_COND(p_interval < 1);
+	lod_distant_update_interval = p_interval;
+}
+
+int AnimationMixer::get_lod_distant_update_interval() const {
+	return lod_distant_update_interval;
+}
+
+void AnimationMixer::set_lod_offscreen_update_interval(int p_interval) {
+	ERR_FAIL_COND(p_interval < 1);
+	lod_offscreen_update_interval = p_interval;
+}
+
+int AnimationMixer::get_lod_offscreen_update_interval() const {
+	return lod_offscreen_update_interval;
+}
+
+void AnimationMixer::set_lod_culled_tracks(const TypedArray<NodePath> &p_tracks) {
+	lod_culled_tracks = p_tracks;
+	_update_lod_culled_tracks();
+}
+
+TypedArray<NodePath> AnimationMixer::get_lod_culled_tracks() const {
+	return lod_culled_tracks;
+}
+
+void AnimationMixer::_update_lod_culled_tracks() {
+	for (KeyValue<Animation::TrackCacheID, TrackCache *> &K : track_cache) {
+		K.value->lod_culled = !lod_culled_tracks.is_empty() && lod_culled_tracks.has(K.value->path);
+	}
+}
+
+int AnimationMixer::_get_lod_update_interval() const {
+	if (lod_source.is_empty() || Engine::get_singleton()->is_editor_hint()) {
+		return lod_update_interval;
+	}
+	Node *source = get_node_or_null(lod_source);
+	if (!source) {
+		return lod_update_interval;
+	}
+
+	VisibleOnScreenNotifier2D *notifier_2d = Object::cast_to<VisibleOnScreenNotifier2D>(source);
+	if (notifier_2d && !notifier_2d->is_on_screen()) {
+		return MAX(lod_offscreen_update_interval, lod_update_interval);
+	}
+#ifndef _3D_DISABLED
+	VisibleOnScreenNotifier3D *notifier_3d = Object::cast_to<VisibleOnScreenNotifier3D>(source);
+	if (notifier_3d && !notifier_3d->is_on_screen()) {
+		return MAX(lod_offscreen_update_interval, lod_update_interval);
+	}
+	Node3D *source_3d = Object::cast_to<Node3D>(source);
+	if (source_3d && lod_distance > 0.0) {
+		const Camera3D *camera = get_viewport()->get_camera_3d();
+		if (camera && camera->get_global_position().distance_squared_to(source_3d->get_global_position()) > lod_distance * lod_distance) {
+			return MAX(lod_distant_update_interval, lod_update_interval);
+		}
+	}
+#endif // _3D_DISABLED
+	return lod_update_interval;
+}
+
+void AnimationMixer::_process_animation_lod(double p_delta) {
+	int interval = _get_lod_update_interval();
+	lod_culling = interval > lod_update_interval;
+	lod_delta += p_delta;
+	lod_frames_until_update = MIN(lod_frames_until_update, interval - 1); // Coming closer updates sooner.
+
+	if (lod_frames_until_update > 0) {
+		// Time is kept until the next update, transforms keep moving towards the last update meanwhile.
+		lod_frames_until_update--;
+		lod_frame_skipped_count.increment();
+		root_motion_position = Vector3(0, 0, 0);
+		root_motion_rotation = Quaternion(0, 0, 0, 1);
+		root_motion_scale = Vector3(0, 0, 0);
+		if (lod_interpolate && transform_poses.has_previous) {
+			lod_pose_weight = real_t(interval - lod_frames_until_update) / interval;
+			_blend_apply(true);
+			lod_pose_weight = 1.0;
+		}
+		return;
+	}
+
+	double delta = lod_delta;
+	lod_delta = 0.0;
+	lod_frames_until_update = interval - 1;
+	lod_frame_updated_count.increment();
+	if (interval > 1 && lod_interpolate) {
+		transform_poses.store_previous();
+		lod_pose_weight = 1.0 / interval;
+	}
+
+	if (_can_blend_threaded()) {
+		_queue_threaded_blend(delta);
+	} else {
+		_process_animation(delta);
+	}
+	if (threaded_blend_state == THREADED_BLEND_NONE) {
+		lod_pose_weight = 1.0;
+	}
+}
+
+void AnimationMixer::end_frame() {
+	lod_last_frame_updated_count = lod_frame_updated_count.get();
+	lod_last_frame_skipped_count = lod_frame_skipped_count.get();
+	lod_frame_updated_count.set(0);
+	lod_frame_skipped_count.set(0);
+}
+
+uint32_t AnimationMixer::get_frame_updated_count() {
+	return lod_last_frame_updated_count;
+}
+
+uint32_t AnimationMixer::get_frame_skipped_count() {
+	return lod_last_frame_skipped_count;
+}
+
 #ifdef TOOLS_ENABLED
 void AnimationMixer::set_editing(bool p_editing) {
 	if (editing == p_editing) {
@@ -591,10 +752,12 @@ void AnimationMixer::_clear_caches(bool p_clear_track_cache) {
 	if (!p_clear_track_cache) {
 		return;
 	}
+	_cancel_threaded_blend();
 	for (KeyValue<Animation::TrackCacheID, TrackCache *> &K : track_cache) {
 		memdelete(K.value);
 	}
 	track_cache.clear();
+	transform_poses.clear();
 	animation_track_num_to_track_cache.clear();
 	cache_valid = false;
 	emit_signal(SNAME("caches_cleared"));
@@ -1014,6 +1177,15 @@ bool AnimationMixer::_update_caches() {
 
 	track_count = idx;
 
+	transform_poses.clear();
+	for (KeyValue<Animation::TrackCacheID, TrackCache *> &K : track_cache) {
+		if (K.value->type == Animation::TYPE_POSITION_3D) {
+			TrackCacheTransform *t = static_cast<TrackCacheTransform *>(K.value);
+			t->pose_idx = transform_poses.add(t);
+		}
+	}
+	_update_lod_culled_tracks();
+
 	cache_valid = true;
 
 	return true;
@@ -1024,20 +1196,144 @@ bool AnimationMixer::_update_caches() {
 /* -------------------------------------------- */
 
 void AnimationMixer::_process_animation(double p_delta, bool p_update_only) {
+	_finish_threaded_blend();
 	_blend_init();
 	if (cache_valid && _blend_pre_process(p_delta, track_count, track_map)) {
 		_blend_capture(p_delta);
 		_blend_calc_total_weight();
 		_blend_process(p_delta, p_update_only);
-		clear_animation_instances();
-		_blend_apply();
-		_blend_post_process();
-		emit_signal(SNAME("mixer_applied"));
+		_blend_finish();
 	} else {
 		clear_animation_instances();
 	}
 }
 
+void AnimationMixer::_blend_finish() {
+	clear_animation_instances();
+	_blend_apply();
+	lod_pose_weight = 1.0;
+	_blend_post_process();
+	emit_signal(SNAME("mixer_applied"));
+}
+
+bool AnimationMixer::_can_blend_threaded() const {
+	if (!GLOBAL_GET_CACHED(bool, "animation/mixer/threaded_blending") || Engine::get_singleton()->is_editor_hint()) {
+		return false;
+	}
+	// Mixers processed in a thread group can't share the queue.
+	return Thread::is_main_thread();
+}
+
+bool AnimationMixer::_is_blend_thread_safe() const {
+	// Discrete value, method, audio and animation tracks act on other objects while blending, so does a script post process.
+	if (GDVIRTUAL_IS_OVERRIDDEN(_post_process_key_value)) {
+		return false;
+	}
+	bool force_continuous = callback_mode_discrete == ANIMATION_CALLBACK_MODE_DISCRETE_FORCE_CONTINUOUS;
+	for (const AnimationInstance &ai : animation_instances) {
+		const Ref<Animation> &a = ai.animation;
+		const LocalVector<Animation::Track *> &tracks = a->get_tracks();
+		for (uint32_t i = 0; i < tracks.size(); i++) {
+			if (!tracks[i]->enabled) {
+				continue;
+			}
+			switch (tracks[i]->type) {
+				case Animation::TYPE_VALUE: {
+					if (!force_continuous && a->value_track_get_update_mode(i) == Animation::UPDATE_DISCRETE) {
+						return false;
+					}
+				} break;
+				case Animation::TYPE_METHOD:
+				case Animation::TYPE_AUDIO:
+				case Animation::TYPE_ANIMATION: {
+					return false;
+				}
+				default:
+					break;
+			}
+		}
+	}
+	return true;
+}
+
+void AnimationMixer::_queue_threaded_blend(double p_delta) {
+	_finish_threaded_blend();
+	_blend_init();
+	if (!cache_valid || !_blend_pre_process(p_delta, track_count, track_map)) {
+		clear_animation_instances();
+		return;
+	}
+	_blend_capture(p_delta);
+	_blend_calc_total_weight();
+	if (!_is_blend_thread_safe()) {
+		_blend_process(p_delta);
+		_blend_finish();
+		return;
+	}
+
+	// Sampled together with the other mixers queued this frame, see _flush_threaded_blends().
+	is_GDVIRTUAL_CALL_post_process_key_value = false;
+	threaded_blend_delta = p_delta;
+	threaded_blend_state = THREADED_BLEND_QUEUED;
+	if (threaded_blend_queue.is_empty()) {
+		callable_mp_static(&AnimationMixer::_flush_threaded_blends).call_deferred();
+	}
+	threaded_blend_queue.push_back(get_instance_id());
+}
+
+void AnimationMixer::_finish_threaded_blend() {
+	if (threaded_blend_state == THREADED_BLEND_NONE) {
+		return;
+	}
+	if (threaded_blend_state == THREADED_BLEND_QUEUED) {
+		_blend_process(threaded_blend_delta);
+	}
+	threaded_blend_state = THREADED_BLEND_NONE;
+	_blend_finish();
+}
+
+void AnimationMixer::_cancel_threaded_blend() {
+	if (threaded_blend_state == THREADED_BLEND_NONE) {
+		return;
+	}
+	threaded_blend_state = THREADED_BLEND_NONE;
+	lod_pose_weight = 1.0;
+	clear_animation_instances();
+}
+
+void AnimationMixer::_blend_process_threaded(void *p_userdata, uint32_t p_index) {
+	AnimationMixer *mixer = static_cast<AnimationMixer **>(p_userdata)[p_index];
+	mixer->_blend_process(mixer->threaded_blend_delta);
+	mixer->threaded_blend_state = THREADED_BLEND_PROCESSED;
+}
+
+void AnimationMixer::_flush_threaded_blends() {
+	LocalVector<ObjectID> queue;
+	SWAP(queue, threaded_blend_queue);
+
+	LocalVector<AnimationMixer *> mixers;
+	mixers.reserve(queue.size());
+	for (const ObjectID &id : queue) {
+		AnimationMixer *mixer = ObjectDB::get_instance<AnimationMixer>(id);
+		if (mixer && mixer->threaded_blend_state == THREADED_BLEND_QUEUED) {
+			mixers.push_back(mixer);
+		}
+	}
+
+	if (mixers.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&AnimationMixer::_blend_process_threaded, mixers.ptr(), mixers.size(), -1, true, SNAME("AnimationMixerBlend"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	// Applying and signals may free or reprocess any of the mixers, so look them up again.
+	for (const ObjectID &id : queue) {
+		AnimationMixer *mixer = ObjectDB::get_instance<AnimationMixer>(id);
+		if (mixer) {
+			mixer->_finish_threaded_blend();
+		}
+	}
+}
+
 Variant AnimationMixer::_post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant &p_value, ObjectID p_object_id, int p_object_sub_idx) {
 #ifndef _3D_DISABLED
 	switch (p_anim->track_get_type(p_track)) {
@@ -1084,6 +1380,7 @@ void AnimationMixer::_blend_init() {
 	}
 
 	// Init all value/transform/blend/bezier tracks that track_cache has.
+	transform_poses.reset();
 	for (const KeyValue<Animation::TrackCacheID, TrackCache *> &K : track_cache) {
 		TrackCache *track = K.value;
 
@@ -1091,15 +1388,11 @@ void AnimationMixer::_blend_init() {
 
 		switch (track->type) {
 			case Animation::TYPE_POSITION_3D: {
-				TrackCacheTransform *t = static_cast<TrackCacheTransform *>(track);
 				if (track->root_motion) {
 					root_motion_cache.loc = Vector3(0, 0, 0);
 					root_motion_cache.rot = Quaternion(0, 0, 0, 1);
 					root_motion_cache.scale = Vector3(1, 1, 1);
 				}
-				t->loc = t->init_loc;
-				t->rot = t->init_rot;
-				t->scale = t->init_scale;
 			} break;
 			case Animation::TYPE_BLEND_SHAPE: {
 				TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(track);
@@ -1268,6 +1561,9 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 			if (track == nullptr) {
 				continue; // No path, but avoid error spamming.
 			}
+			if (lod_culling && track->lod_culled) {
+				continue;
+			}
 			int blend_idx = track->blend_idx;
 			ERR_CONTINUE(blend_idx < 0 || blend_idx >= track_count);
 			real_t blend;
@@ -1428,7 +1724,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 							continue;
 						}
 						loc = post_process_key_value(a, i, loc, t->object_id, t->bone_idx);
-						t->loc += (loc - t->init_loc) * blend;
+						transform_poses.loc[t->pose_idx] += (loc - transform_poses.init_loc[t->pose_idx]) * blend;
 					}
 #endif // _3D_DISABLED
 				} break;
@@ -1516,7 +1812,8 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 							continue;
 						}
 						rot = post_process_key_value(a, i, rot, t->object_id, t->bone_idx);
-						t->rot = Animation::interpolate_via_rest(t->rot, rot, blend, t->init_rot);
+						Quaternion &pose_rot = transform_poses.rot[t->pose_idx];
+						pose_rot = Animation::interpolate_via_rest(pose_rot, rot, blend, transform_poses.init_rot[t->pose_idx]);
 					}
 #endif // _3D_DISABLED
 				} break;
@@ -1604,7 +1901,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 							continue;
 						}
 						scale = post_process_key_value(a, i, scale, t->object_id, t->bone_idx);
-						t->scale += (scale - t->init_scale) * blend;
+						transform_poses.scale[t->pose_idx] += (scale - transform_poses.init_scale[t->pose_idx]) * blend;
 					}
 #endif // _3D_DISABLED
 				} break;
@@ -1910,10 +2207,16 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 	is_GDVIRTUAL_CALL_post_process_key_value = true;
 }
 
-void AnimationMixer::_blend_apply() {
+void AnimationMixer::_blend_apply(bool p_poses_only) {
 	// Finally, set the tracks.
 	for (const KeyValue<Animation::TrackCacheID, TrackCache *> &K : track_cache) {
 		TrackCache *track = K.value;
+		if (p_poses_only && (track->type != Animation::TYPE_POSITION_3D || track->root_motion)) {
+			continue;
+		}
+		if (lod_culling && track->lod_culled) {
+			continue; // Left as last updated.
+		}
 		bool is_zero_amount = Math::is_zero_approx(track->total_weight);
 		if (!deterministic && is_zero_amount) {
 			continue;
@@ -1922,6 +2225,19 @@ void AnimationMixer::_blend_apply() {
 			case Animation::TYPE_POSITION_3D: {
 #ifndef _3D_DISABLED
 				TrackCacheTransform *t = static_cast<TrackCacheTransform *>(track);
+				if (t->pose_idx >= 0) {
+					// Backups restored by restore() carry their own pose instead.
+					if (lod_pose_weight < 1.0 && transform_poses.has_previous) {
+						t->loc = transform_poses.prev_loc[t->pose_idx].lerp(transform_poses.loc[t->pose_idx], lod_pose_weight);
+						t->rot = transform_poses.prev_rot[t->pose_idx].slerp(transform_poses.rot[t->pose_idx], lod_pose_weight);
+						t->scale = transform_poses.prev_scale[t->pose_idx].lerp(transform_poses.scale[t->pose_idx], lod_pose_weight);
+					} else {
+						t->loc = transform_poses.loc[t->pose_idx];
+						t->rot = transform_poses.rot[t->pose_idx];
+						t->scale = transform_poses.scale[t->pose_idx];
+					}
+					transform_poses.applied = true;
+				}
 
 				if (t->root_motion) {
 					root_motion_position = root_motion_cache.loc;
@@ -2417,17 +2733,18 @@ void AnimationMixer::_notification(int p_what) {
 
 		case NOTIFICATION_INTERNAL_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_IDLE) {
-				_process_animation(get_process_delta_time());
+				_process_animation_lod(get_process_delta_time());
 			}
 		} break;
 
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_PHYSICS) {
-				_process_animation(get_physics_process_delta_time());
+				_process_animation_lod(get_physics_process_delta_time());
 			}
 		} break;
 
 		case NOTIFICATION_EXIT_TREE: {
+			_finish_threaded_blend();
 			_clear_caches();
 		} break;
 	}
@@ -2489,6 +2806,22 @@ void AnimationMixer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_audio_max_polyphony", "max_polyphony"), &AnimationMixer::set_audio_max_polyphony);
 	ClassDB::bind_method(D_METHOD("get_audio_max_polyphony"), &AnimationMixer::get_audio_max_polyphony);
 
+	/* ---- Level of detail ---- */
+	ClassDB::bind_method(D_METHOD("set_lod_update_interval", "interval"), &AnimationMixer::set_lod_update_interval);
+	ClassDB::bind_method(D_METHOD("get_lod_update_interval"), &AnimationMixer::get_lod_update_interval);
+	ClassDB::bind_method(D_METHOD("set_lod_interpolate", "interpolate"), &AnimationMixer::set_lod_interpolate);
+	ClassDB::bind_method(D_METHOD("is_lod_interpolating"), &AnimationMixer::is_lod_interpolating);
+	ClassDB::bind_method(D_METHOD("set_lod_source", "source"), &AnimationMixer::set_lod_source);
+	ClassDB::bind_method(D_METHOD("get_lod_source"), &AnimationMixer::get_lod_source);
+	ClassDB::bind_method(D_METHOD("set_lod_distance", "distance"), &AnimationMixer::set_lod_distance);
+	ClassDB::bind_method(D_METHOD("get_lod_distance"), &AnimationMixer::get_lod_distance);
+	ClassDB::bind_method(D_METHOD("set_lod_distant_update_interval", "interval"), &AnimationMixer::set_lod_distant_update_interval);
+	ClassDB::bind_method(D_METHOD("get_lod_distant_update_interval"), &AnimationMixer::get_lod_distant_update_interval);
+	ClassDB::bind_method(D_METHOD("set_lod_offscreen_update_interval", "interval"), &AnimationMixer::set_lod_offscreen_update_interval);
+	ClassDB::bind_method(D_METHOD("get_lod_offscreen_update_interval"), &AnimationMixer::get_lod_offscreen_update_interval);
+	ClassDB::bind_method(D_METHOD("set_lod_culled_tracks", "tracks"), &AnimationMixer::set_lod_culled_tracks);
+	ClassDB::bind_method(D_METHOD("get_lod_culled_tracks"), &AnimationMixer::get_lod_culled_tracks);
+
 	/* ---- Root motion accumulator for Skeleton3D ---- */
 	ClassDB::bind_method(D_METHOD("set_root_motion_track", "path"), &AnimationMixer::set_root_motion_track);
 	ClassDB::bind_method(D_METHOD("get_root_motion_track"), &AnimationMixer::get_root_motion_track);
@@ -2526,6 +2859,15 @@ void AnimationMixer::_bind_methods() {
 	ADD_GROUP("Audio", "audio_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "audio_max_polyphony", PROPERTY_HINT_RANGE, "1,127,1"), "set_audio_max_polyphony", "get_audio_max_polyphony");
 
+	ADD_GROUP("LOD", "lod_");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "lod_update_interval", PROPERTY_HINT_RANGE, "1,60,1,or_greater"), "set_lod_update_interval", "get_lod_update_interval");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "lod_interpolate"), "set_lod_interpolate", "is_lod_interpolating");
+	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "lod_source"), "set_lod_source", "get_lod_source");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "lod_distance", PROPERTY_HINT_RANGE, "0,1000,0.01,or_greater,suffix:m"), "set_lod_distance", "get_lod_distance");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "lod_distant_update_interval", PROPERTY_HINT_RANGE, "1,60,1,or_greater"), "set_lod_distant_update_interval", "get_lod_distant_update_interval");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "lod_offscreen_update_interval", PROPERTY_HINT_RANGE, "1,60,1,or_greater"), "set_lod_offscreen_update_interval", "get_lod_offscreen_update_interval");
+	ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "lod_culled_tracks", PROPERTY_HINT_ARRAY_TYPE, "NodePath"), "set_lod_culled_tracks", "get_lod_culled_tracks");
+
 	ADD_GROUP("Callback Mode", "callback_mode_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "callback_mode_process", PROPERTY_HINT_ENUM, "Physics,Idle,Manual"), "set_callback_mode_process", "get_callback_mode_process");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "callback_mode_method", PROPERTY_HINT_ENUM, "Deferred,Immediate"), "set_callback_mode_method", "get_callback_mode_method");
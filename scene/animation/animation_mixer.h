@@ -137,6 +137,29 @@ protected:
 
 	void _set_process(bool p_process, bool p_force = false);
 
+	/* ---- Level of detail ---- */
+	int lod_update_interval = 1;
+	bool lod_interpolate = true;
+	NodePath lod_source;
+	real_t lod_distance = 0.0;
+	int lod_distant_update_interval = 4;
+	int lod_offscreen_update_interval = 16;
+	TypedArray<NodePath> lod_culled_tracks;
+
+	int lod_frames_until_update = 0;
+	double lod_delta = 0.0;
+	bool lod_culling = false;
+	real_t lod_pose_weight = 1.0;
+
+	static SafeNumeric<uint32_t> lod_frame_updated_count;
+	static SafeNumeric<uint32_t> lod_frame_skipped_count;
+	static uint32_t lod_last_frame_updated_count;
+	static uint32_t lod_last_frame_skipped_count;
+
+	int _get_lod_update_interval() const;
+	void _process_animation_lod(double p_delta);
+	void _update_lod_culled_tracks();
+
 	/* ---- Caches for blending ---- */
 	bool cache_valid = false;
 	uint64_t setup_pass = 1;
@@ -150,6 +173,7 @@ protected:
 		ObjectID object_id;
 		real_t total_weight = 0.0;
 		uint64_t animation_instance_weight_applied_at = 0;
+		bool lod_culled = false;
 
 		TrackCache() = default;
 		TrackCache(const TrackCache &p_other) :
@@ -168,6 +192,7 @@ protected:
 		ObjectID skeleton_id;
 #endif // _3D_DISABLED
 		int bone_idx = -1;
+		int pose_idx = -1; // In the mixer's TransformPoses, not shared with copies.
 		bool loc_used = false;
 		bool rot_used = false;
 		bool scale_used = false;
@@ -200,6 +225,68 @@ protected:
 		}
 	};
 
+	// Transform tracks blend into contiguous arrays rather than into their own caches,
+	// so resetting the pose each frame is a plain copy and blending many layers stays in cache.
+	struct TransformPoses {
+		LocalVector<Vector3> init_loc;
+		LocalVector<Quaternion> init_rot;
+		LocalVector<Vector3> init_scale;
+		LocalVector<Vector3> loc;
+		LocalVector<Quaternion> rot;
+		LocalVector<Vector3> scale;
+		// Previous update, interpolated from when updating less than every frame.
+		LocalVector<Vector3> prev_loc;
+		LocalVector<Quaternion> prev_rot;
+		LocalVector<Vector3> prev_scale;
+		bool applied = false;
+		bool has_previous = false;
+
+		int add(const TrackCacheTransform *p_track) {
+			init_loc.push_back(p_track->init_loc);
+			init_rot.push_back(p_track->init_rot);
+			init_scale.push_back(p_track->init_scale);
+			loc.push_back(p_track->init_loc);
+			rot.push_back(p_track->init_rot);
+			scale.push_back(p_track->init_scale);
+			prev_loc.push_back(p_track->init_loc);
+			prev_rot.push_back(p_track->init_rot);
+			prev_scale.push_back(p_track->init_scale);
+			return loc.size() - 1;
+		}
+
+		void store_previous() {
+			SWAP(prev_loc, loc);
+			SWAP(prev_rot, rot);
+			SWAP(prev_scale, scale);
+			has_previous = applied;
+		}
+
+		void reset() {
+			if (loc.is_empty()) {
+				return;
+			}
+			memcpy(loc.ptr(), init_loc.ptr(), loc.size() * sizeof(Vector3));
+			for (uint32_t i = 0; i < rot.size(); i++) {
+				rot[i] = init_rot[i];
+			}
+			memcpy(scale.ptr(), init_scale.ptr(), scale.size() * sizeof(Vector3));
+		}
+
+		void clear() {
+			init_loc.clear();
+			init_rot.clear();
+			init_scale.clear();
+			loc.clear();
+			rot.clear();
+			scale.clear();
+			prev_loc.clear();
+			prev_rot.clear();
+			prev_scale.clear();
+			applied = false;
+			has_previous = false;
+		}
+	};
+
 	struct RootMotionCache {
 		Vector3 loc = Vector3(0, 0, 0);
 		Quaternion rot = Quaternion(0, 0, 0, 1);
@@ -305,6 +392,7 @@ protected:
 
 	RootMotionCache root_motion_cache;
 	AHashMap<Animation::TrackCacheID, TrackCache *, HashHasher> track_cache;
+	TransformPoses transform_poses;
 	AHashMap<Ref<Animation>, LocalVector<TrackCache *>> animation_track_num_to_track_cache;
 	HashSet<TrackCache *> playing_caches;
 	Vector<Node *> playing_audio_stream_players;
@@ -328,6 +416,17 @@ protected:
 	int track_count = 0;
 	bool deterministic = false;
 
+	/* ---- Threaded blending ---- */
+	enum ThreadedBlendState {
+		THREADED_BLEND_NONE,
+		THREADED_BLEND_QUEUED,
+		THREADED_BLEND_PROCESSED,
+	};
+
+	static LocalVector<ObjectID> threaded_blend_queue;
+	ThreadedBlendState threaded_blend_state = THREADED_BLEND_NONE;
+	double threaded_blend_delta = 0.0;
+
 	/* ---- Root motion accumulator for Skeleton3D ---- */
 	NodePath root_motion_track;
 	bool root_motion_local = false;
@@ -370,10 +469,20 @@ protected:
 	virtual void _blend_capture(double p_delta);
 	void _blend_calc_total_weight(); // For indeterministic blending.
 	void _blend_process(double p_delta, bool p_update_only = false);
-	void _blend_apply();
+	void _blend_apply(bool p_poses_only = false);
 	virtual void _blend_post_process();
+	void _blend_finish();
 	void _call_object(ObjectID p_object_id, const StringName &p_method, const Vector<Variant> &p_params, bool p_deferred);
 
+	// Only sampling into the track caches runs on the WorkerThreadPool, applying stays on the main thread.
+	bool _can_blend_threaded() const;
+	bool _is_blend_thread_safe() const;
+	void _queue_threaded_blend(double p_delta);
+	void _finish_threaded_blend();
+	void _cancel_threaded_blend();
+	static void _blend_process_threaded(void *p_userdata, uint32_t p_index);
+	static void _flush_threaded_blends();
+
 	/* ---- Capture feature ---- */
 	struct CaptureCache {
 		Ref<Animation> animation;
@@ -439,6 +548,32 @@ public:
 	void set_audio_max_polyphony(int p_audio_max_polyphony);
 	int get_audio_max_polyphony() const;
 
+	/* ---- Level of detail ---- */
+	void set_lod_update_interval(int p_interval);
+	int get_lod_update_interval() const;
+
+	void set_lod_interpolate(bool p_interpolate);
+	bool is_lod_interpolating() const;
+
+	void set_lod_source(const NodePath &p_source);
+	NodePath get_lod_source() const;
+
+	void set_lod_distance(real_t p_distance);
+	real_t get_lod_distance() const;
+
+	void set_lod_distant_update_interval(int p_interval);
+	int get_lod_distant_update_interval() const;
+
+	void set_lod_offscreen_update_interval(int p_interval);
+	int get_lod_offscreen_update_interval() const;
+
+	void set_lod_culled_tracks(const TypedArray<NodePath> &p_tracks);
+	TypedArray<NodePath> get_lod_culled_tracks() const;
+
+	static void end_frame();
+	static uint32_t get_frame_updated_count();
+	static uint32_t get_frame_skipped_count();
+
 	/* ---- Root motion accumulator for Skeleton3D ---- */
 	void set_root_motion_track(const NodePath &p_track);
 	NodePath get_root_motion_track() const;
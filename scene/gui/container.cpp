@@ -32,6 +32,7 @@
 
 #include "core/object/callable_mp.h"
 #include "core/object/class_db.h"
+#include "core/object/message_queue.h"
 #include "servers/display/accessibility_server.h"
 
 void Container::_child_minsize_changed() {
@@ -163,7 +164,7 @@ void Container::queue_sort() {
 	}
 
 	layout_pending_start();
-	callable_mp(this, &Container::_sort_children).call_deferred();
+	MessageQueue::get_singleton()->push_native_call(this, &Container::_sort_children);
 	pending_sort = true;
 }
 
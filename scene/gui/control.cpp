@@ -39,6 +39,7 @@ STATIC_ASSERT_INCOMPLETE_TYPE(class, RenderingServer);
 #include "core/math/transform_2d.h"
 #include "core/object/callable_mp.h"
 #include "core/object/class_db.h"
+#include "core/object/message_queue.h"
 #include "core/os/os.h"
 #include "core/string/string_builder.h"
 #include "scene/gui/container.h"
@@ -1804,15 +1805,15 @@ void Control::update_maximum_size() {
 	// Keep minimum size propagation in sync so parent containers can relayout correctly.
 	if (!data.updating_last_minimum_size) {
 		data.updating_last_minimum_size = true;
-		callable_mp(this, &Control::_update_minimum_size).call_deferred();
+		MessageQueue::get_singleton()->push_native_call(this, &Control::_update_minimum_size);
 	}
 	// Same with desired size.
 	if (!data.updating_last_desired_size) {
 		data.updating_last_desired_size = true;
-		callable_mp(this, &Control::_update_desired_size).call_deferred();
+		MessageQueue::get_singleton()->push_native_call(this, &Control::_update_desired_size);
 	}
 
-	callable_mp(this, &Control::_update_maximum_size).call_deferred();
+	MessageQueue::get_singleton()->push_native_call(this, &Control::_update_maximum_size);
 }
 
 void Control::set_block_maximum_size_adjust(bool p_block) {
@@ -1963,7 +1964,7 @@ void Control::update_minimum_size() {
 	}
 	data.updating_last_minimum_size = true;
 
-	callable_mp(this, &Control::_update_minimum_size).call_deferred();
+	MessageQueue::get_singleton()->push_native_call(this, &Control::_update_minimum_size);
 }
 
 void Control::set_block_minimum_size_adjust(bool p_block) {
@@ -2056,7 +2057,7 @@ void Control::update_desired_size() {
 	}
 	data.updating_last_desired_size = true;
 
-	callable_mp(this, &Control::_update_desired_size).call_deferred();
+	MessageQueue::get_singleton()->push_native_call(this, &Control::_update_desired_size);
 }
 
 Size2 Control::get_bound_desired_size() const {
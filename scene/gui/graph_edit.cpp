@@ -37,6 +37,7 @@
 #include "core/math/math_funcs.h"
 #include "core/object/callable_mp.h"
 #include "core/object/class_db.h"
+#include "core/object/message_queue.h"
 #include "core/os/keyboard.h"
 #include "scene/2d/line_2d.h"
 #include "scene/gui/box_container.h"
@@ -296,7 +297,7 @@ Error GraphEdit::connect_node(const StringName &p_from, int p_from_port, const S
 	minimap->queue_redraw();
 	queue_redraw();
 	connections_layer->queue_redraw();
-	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+	_queue_update_top_connection_layer();
 
 	return OK;
 }
@@ -331,7 +332,7 @@ void GraphEdit::disconnect_node(const StringName &p_from, int p_from_port, const
 		minimap->queue_redraw();
 		queue_redraw();
 		connections_layer->queue_redraw();
-		callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+		_queue_update_top_connection_layer();
 	}
 }
 
@@ -415,7 +416,7 @@ void GraphEdit::set_scroll_offset(const Vector2 &p_offset) {
 	minimap->queue_redraw();
 	queue_redraw();
 	_update_scrollbars();
-	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+	_queue_update_top_connection_layer();
 	setting_scroll_offset = false;
 }
 
@@ -432,7 +433,7 @@ void GraphEdit::_scrollbar_moved(double) {
 	}
 	minimap->queue_redraw();
 	queue_redraw();
-	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+	_queue_update_top_connection_layer();
 }
 
 void GraphEdit::_update_scroll_offset() {
@@ -626,7 +627,7 @@ void GraphEdit::_graph_frame_autoshrink_changed(const Vector2 &p_new_minsize, Gr
 	minimap->queue_redraw();
 	queue_redraw();
 	connections_layer->queue_redraw();
-	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+	_queue_update_top_connection_layer();
 }
 
 void GraphEdit::_graph_element_moved(Node *p_node) {
@@ -637,7 +638,7 @@ void GraphEdit::_graph_element_moved(Node *p_node) {
 	minimap->queue_redraw();
 	queue_redraw();
 	connections_layer->queue_redraw();
-	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+	_queue_update_top_connection_layer();
 }
 
 void GraphEdit::_graph_node_slot_updated(int p_index, Node *p_node) {
@@ -653,7 +654,7 @@ void GraphEdit::_graph_node_slot_updated(int p_index, Node *p_node) {
 	minimap->queue_redraw();
 	queue_redraw();
 	connections_layer->queue_redraw();
-	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+	_queue_update_top_connection_layer();
 }
 
 void GraphEdit::_graph_node_rect_changed(GraphNode *p_node) {
@@ -668,7 +669,7 @@ void GraphEdit::_graph_node_rect_changed(GraphNode *p_node) {
 		conn->_cache.dirty = true;
 	}
 	connections_layer->queue_redraw();
-	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+	_queue_update_top_connection_layer();
 
 	// Update all parent frames recursively bottom-up.
 	if (linked_parent_map.has(p_node->get_name())) {
@@ -870,7 +871,7 @@ void GraphEdit::_notification(int p_what) {
 		case NOTIFICATION_RESIZED: {
 			_update_scrollbars();
 			minimap->queue_redraw();
-			callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+			_queue_update_top_connection_layer();
 		} break;
 
 		case NOTIFICATION_ENTER_TREE: {
@@ -1333,7 +1334,7 @@ void GraphEdit::_top_connection_layer_input(const Ref<InputEvent> &p_ev) {
 	if (mm.is_valid() && connecting && !keyboard_connecting) {
 		connecting_to_point = mm->get_position();
 		minimap->queue_redraw();
-		callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+		_queue_update_top_connection_layer();
 
 		connecting_valid = just_disconnected || click_pos.distance_to(connecting_to_point / zoom) > MIN_DRAG_DISTANCE_FOR_VALID_CONNECTION;
 
@@ -1807,6 +1808,11 @@ void GraphEdit::_update_top_connection_layer() {
 	dragged_connection_line->set_gradient(line_gradient);
 }
 
+void GraphEdit::_queue_update_top_connection_layer() {
+	// Many edits in the same frame ask for this, one update after all of them is enough.
+	MessageQueue::get_singleton()->push_unique_callable(callable_mp(this, &GraphEdit::_update_top_connection_layer));
+}
+
 void GraphEdit::_minimap_draw() {
 	if (!is_minimap_enabled()) {
 		return;
@@ -2169,7 +2175,7 @@ void GraphEdit::gui_input(const Ref<InputEvent> &p_ev) {
 			minimap->queue_redraw();
 			queue_redraw();
 			connections_layer->queue_redraw();
-			callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+			_queue_update_top_connection_layer();
 		}
 
 		// Node selection logic.
@@ -2339,7 +2345,7 @@ void GraphEdit::_pan_callback(Vector2 p_scroll_vec, Ref<InputEvent> p_event) {
 	}
 	minimap->queue_redraw();
 	queue_redraw();
-	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+	_queue_update_top_connection_layer();
 	connections_layer->queue_redraw();
 }
 
@@ -2361,7 +2367,7 @@ void GraphEdit::set_connection_activity(const StringName &p_from, int p_from_por
 				minimap->queue_redraw();
 				conn->_cache.dirty = true;
 				connections_layer->queue_redraw();
-				callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+				_queue_update_top_connection_layer();
 			}
 			conn->activity = p_activity;
 			return;
@@ -2410,7 +2416,7 @@ void GraphEdit::force_connection_drag_end() {
 	minimap->queue_redraw();
 	queue_redraw();
 	connections_layer->queue_redraw();
-	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+	_queue_update_top_connection_layer();
 	emit_signal(SNAME("connection_drag_ended"));
 }
 
@@ -2445,7 +2451,7 @@ void GraphEdit::set_zoom_custom(float p_zoom, const Vector2 &p_center) {
 
 	zoom = p_zoom;
 
-	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+	_queue_update_top_connection_layer();
 
 	zoom_minus_button->set_disabled(zoom == zoom_min);
 	zoom_plus_button->set_disabled(zoom == zoom_max);
@@ -2882,7 +2888,7 @@ void GraphEdit::override_connections_shader(const Ref<Shader> &p_shader) {
 	_invalidate_connection_line_cache();
 	connections_layer->queue_redraw();
 	minimap->queue_redraw();
-	callable_mp(this, &GraphEdit::_update_top_connection_layer).call_deferred();
+	_queue_update_top_connection_layer();
 }
 
 void GraphEdit::_minimap_toggled() {
@@ -342,6 +342,7 @@ private:
 	void _draw_minimap_connection_line(const Vector2 &p_from_graph_position, const Vector2 &p_to_graph_position, const Color &p_from_color, const Color &p_to_color);
 	void _invalidate_connection_line_cache();
 	void _update_top_connection_layer();
+	void _queue_update_top_connection_layer();
 	void _update_connections();
 
 	void _top_layer_draw();
@@ -200,6 +200,10 @@ Transform2D CanvasItem::get_screen_transform() const {
 Transform2D CanvasItem::get_global_transform() const {
 	ERR_READ_THREAD_GUARD_V(Transform2D());
 
+	if (unlikely(is_inside_tree() && get_tree()->has_pending_transform_propagation()) && Thread::is_main_thread() && _is_below_pending_transform_propagation()) {
+		get_tree()->flush_transform_propagation();
+	}
+
 	if (_is_global_invalid()) {
 		// This code can enter multiple times from threads if dirty, this is expected.
 		const CanvasItem *pi = get_parent_item();
@@ -219,6 +223,10 @@ Transform2D CanvasItem::get_global_transform() const {
 
 // Same as get_global_transform() but no reset for `global_invalid`.
 Transform2D CanvasItem::get_global_transform_const() const {
+	if (unlikely(is_inside_tree() && get_tree()->has_pending_transform_propagation()) && Thread::is_main_thread() && _is_below_pending_transform_propagation()) {
+		get_tree()->flush_transform_propagation();
+	}
+
 	if (_is_global_invalid()) {
 		const CanvasItem *pi = get_parent_item();
 		if (pi) {
@@ -452,6 +460,9 @@ void CanvasItem::_notification(int p_what) {
 			if (xform_change.in_list()) {
 				get_tree()->xform_change_list.remove(&xform_change);
 			}
+			if (xform_propagate.in_list()) {
+				get_tree()->xform_propagate_list.remove(&xform_propagate);
+			}
 			_exit_canvas();
 
 			CanvasItem *parent = Object::cast_to<CanvasItem>(get_parent());
@@ -1170,6 +1181,14 @@ void CanvasItem::_notify_transform(CanvasItem *p_node) {
 
 	p_node->_set_global_invalid(true);
 
+	if (p_node == this && is_inside_tree() && get_tree()->is_batching_transform_propagation() && Thread::is_main_thread()) {
+		// The rest of the branch is invalidated by SceneTree::flush_transform_propagation().
+		if (!xform_propagate.in_list()) {
+			get_tree()->xform_propagate_list.add(&xform_propagate);
+		}
+		return;
+	}
+
 	if (p_node->notify_transform && !p_node->xform_change.in_list()) {
 		if (!p_node->block_transform_notify) {
 			if (p_node->is_inside_tree()) {
@@ -1191,6 +1210,40 @@ void CanvasItem::_notify_transform(CanvasItem *p_node) {
 	}
 }
 
+void CanvasItem::_propagate_transform_batched(bool p_root, LocalVector<CanvasItem *> &r_children, LocalVector<CanvasItem *> &r_notify) {
+	// Other pending roots are propagated on their own, and any other invalid item had its branch invalidated
+	// before, up to the pending roots below it. Roots are invalidated again, as their own global transform
+	// may have been read since they were queued, and a parent may have moved after that.
+	if (!p_root && (xform_propagate.in_list() || _is_global_invalid())) {
+		return;
+	}
+	_set_global_invalid(true);
+
+	if (notify_transform && !block_transform_notify && !xform_change.in_list()) {
+		r_notify.push_back(this);
+	}
+
+	for (CanvasItem *child : data.canvas_item_children) {
+		if (!child->top_level) {
+			r_children.push_back(child);
+		}
+	}
+}
+
+bool CanvasItem::_is_below_pending_transform_propagation() const {
+	const CanvasItem *item = this;
+	while (!item->top_level) {
+		item = item->get_parent_item();
+		if (!item) {
+			break;
+		}
+		if (item->xform_propagate.in_list()) {
+			return true;
+		}
+	}
+	return false;
+}
+
 void CanvasItem::_physics_interpolated_changed() {
 	RenderingServer::get_singleton()->canvas_item_set_interpolated(canvas_item, is_physics_interpolated());
 }
@@ -1886,7 +1939,8 @@ CanvasItem::TextureRepeat CanvasItem::get_texture_repeat_in_tree() const {
 }
 
 CanvasItem::CanvasItem() :
-		xform_change(this) {
+		xform_change(this),
+		xform_propagate(this) {
 	_define_ancestry(AncestralClass::CANVAS_ITEM);
 
 	canvas_item = RenderingServer::get_singleton()->canvas_item_create();
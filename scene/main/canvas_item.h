@@ -48,6 +48,7 @@ class CanvasItem : public Node {
 	GDCLASS(CanvasItem, Node);
 
 	friend class CanvasLayer;
+	friend class SceneTree;
 
 public:
 	static constexpr AncestralClass static_ancestral_class = AncestralClass::CANVAS_ITEM;
@@ -87,6 +88,7 @@ public:
 
 private:
 	mutable SelfList<Node> xform_change;
+	SelfList<Node> xform_propagate;
 
 	RID canvas_item;
 	StringName canvas_group;
@@ -170,6 +172,8 @@ private:
 	void _window_visibility_changed();
 
 	void _notify_transform(CanvasItem *p_node);
+	void _propagate_transform_batched(bool p_root, LocalVector<CanvasItem *> &r_children, LocalVector<CanvasItem *> &r_notify);
+	bool _is_below_pending_transform_propagation() const;
 
 	static CanvasItem *current_item_drawn;
 	friend class Viewport;
@@ -64,6 +64,7 @@ SafeNumeric<uint64_t> Node::total_node_count{ 0 };
 #endif
 
 thread_local Node *Node::current_process_thread_group = nullptr;
+HashSet<StringName> Node::thread_safe_free_classes;
 
 void Node::_notification(int p_notification) {
 	switch (p_notification) {
@@ -308,7 +309,12 @@ void Node::_notification(int p_notification) {
 			// kill children as cleanly as possible
 			while (data.children.size()) {
 				Node *child = data.children.last()->value; // begin from the end because its faster and more consistent with creation
-				memdelete(child);
+				if (child->data.free_on_thread) {
+					// The SceneTree frees this branch on a thread once it's detached.
+					remove_child(child);
+				} else {
+					memdelete(child);
+				}
 			}
 		} break;
 
@@ -1458,6 +1464,8 @@ void Node::set_name(const StringName &p_name) {
 	if (data.parent) {
 		data.parent->_validate_child_name(this, true);
 		bool success = data.parent->data.children.replace_key(old_name, data.name);
+		data.parent->_clear_serial_child_name_hints();
+		data.parent->_node_paths_changed();
 		ERR_FAIL_COND_MSG(!success, "Renaming child in hashtable failed, this is a bug.");
 	}
 
@@ -1497,6 +1505,19 @@ void Node::init_node_hrcr() {
 	node_hrcr_count.init(1);
 }
 
+void Node::add_thread_safe_free_class(const StringName &p_class) {
+	thread_safe_free_classes.insert(p_class);
+}
+
+void Node::clear_thread_safe_free_classes() {
+	thread_safe_free_classes.clear();
+}
+
+bool Node::_is_thread_safe_to_free() const {
+	// Scripts, extension bindings and connections may reach other objects while being released.
+	return thread_safe_free_classes.has(get_class_name()) && !get_script_instance() && !has_any_instance_binding() && !has_any_connections();
+}
+
 #ifdef TOOLS_ENABLED
 String Node::validate_child_name(Node *p_child) {
 	StringName name = p_child->data.name;
@@ -1614,26 +1635,39 @@ void Node::_generate_serial_child_name(const Node *p_child, StringName &name) co
 		return;
 	}
 
-	// Extract trailing number
-	String name_string = name;
+	String nnsep = _get_name_num_separator();
+	String name_string;
 	String nums;
-	for (int i = name_string.length() - 1; i >= 0; i--) {
-		char32_t n = name_string[i];
-		if (is_digit(n)) {
-			nums = String::chr(name_string[i]) + nums;
-		} else {
-			break;
-		}
-	}
 
-	String nnsep = _get_name_num_separator();
-	int name_last_index = name_string.length() - nnsep.length() - nums.length();
+	// Adding children only ever takes names, so the attempts before the last free name found for this name are all still taken.
+	// Removing or renaming a child frees names and clears the hints. A node that is already a child may own one of the skipped
+	// names itself, so it always searches from the start.
+	const bool use_hint = p_child->data.parent != this;
+	const SerialChildNameHint *hint = use_hint && data.serial_child_name_hints ? data.serial_child_name_hints->getptr(name) : nullptr;
 
-	// Assign the base name + separator to name if we have numbers preceded by a separator
-	if (nums.length() > 0 && name_string.substr(name_last_index, nnsep.length()) == nnsep) {
-		name_string = name_string.substr(0, name_last_index + nnsep.length());
+	if (hint && hint->separator == nnsep) {
+		name_string = hint->base;
+		nums = hint->nums;
 	} else {
-		nums = "";
+		// Extract trailing number
+		name_string = name;
+		for (int i = name_string.length() - 1; i >= 0; i--) {
+			char32_t n = name_string[i];
+			if (is_digit(n)) {
+				nums = String::chr(name_string[i]) + nums;
+			} else {
+				break;
+			}
+		}
+
+		int name_last_index = name_string.length() - nnsep.length() - nums.length();
+
+		// Assign the base name + separator to name if we have numbers preceded by a separator
+		if (nums.length() > 0 && name_string.substr(name_last_index, nnsep.length()) == nnsep) {
+			name_string = name_string.substr(0, name_last_index + nnsep.length());
+		} else {
+			nums = "";
+		}
 	}
 
 	for (;;) {
@@ -1643,6 +1677,12 @@ void Node::_generate_serial_child_name(const Node *p_child, StringName &name) co
 		bool exists = existing != nullptr && *existing != p_child;
 
 		if (!exists) {
+			if (use_hint) {
+				if (!data.serial_child_name_hints) {
+					data.serial_child_name_hints = memnew((HashMap<StringName, SerialChildNameHint>));
+				}
+				data.serial_child_name_hints->insert(name, { nnsep, name_string, nums });
+			}
 			name = attempt;
 			return;
 		} else {
@@ -1661,11 +1701,12 @@ Node::InternalMode Node::get_internal_mode() const {
 	return data.internal_mode;
 }
 
-void Node::_add_child_nocheck(Node *p_child, const StringName &p_name, InternalMode p_internal_mode) {
+void Node::_add_child_nocheck(Node *p_child, const StringName &p_name, InternalMode p_internal_mode, bool p_notify_child_order) {
 	//add a child node quickly, without name validation
 
 	p_child->data.name = p_name;
 	data.children.insert(p_name, p_child);
+	_node_paths_changed();
 
 	p_child->data.internal_mode = p_internal_mode;
 
@@ -1704,8 +1745,10 @@ void Node::_add_child_nocheck(Node *p_child, const StringName &p_name, InternalM
 
 	/* Notify */
 	add_child_notify(p_child);
-	notification(NOTIFICATION_CHILD_ORDER_CHANGED);
-	emit_signal(SNAME("child_order_changed"));
+	if (p_notify_child_order) {
+		notification(NOTIFICATION_CHILD_ORDER_CHANGED);
+		emit_signal(SNAME("child_order_changed"));
+	}
 }
 
 void Node::add_child(RequiredParam<Node> rp_child, bool p_force_readable_name, InternalMode p_internal) {
@@ -1732,6 +1775,48 @@ void Node::add_child(RequiredParam<Node> rp_child, bool p_force_readable_name, I
 	_add_child_nocheck(p_child, p_child->data.name, p_internal);
 }
 
+void Node::add_children(const TypedArray<Node> &p_children, bool p_force_readable_name, InternalMode p_internal) {
+	ERR_FAIL_COND_MSG(data.tree && !Thread::is_main_thread(), "Adding children to a node inside the SceneTree is only allowed from the main thread. Use call_deferred(\"add_children\",nodes).");
+
+	ERR_THREAD_GUARD
+	ERR_FAIL_COND_MSG(data.blocked > 0, "Parent node is busy setting up children, `add_children()` failed. Consider using `add_children.call_deferred(children)` instead.");
+
+	// Grow the name index and the children cache once, instead of rehashing while adding.
+	data.children.reserve(data.children.size() + p_children.size());
+	if (!data.children_cache_dirty) {
+		data.children_cache.reserve(data.children_cache.size() + p_children.size());
+	}
+
+	bool added = false;
+	for (int i = 0; i < p_children.size(); i++) {
+		Node *child = Object::cast_to<Node>(p_children[i]);
+		ERR_CONTINUE_MSG(!child, vformat("Can't add child at index %d, it's not a valid node.", i));
+		ERR_CONTINUE_MSG(child == this, vformat("Can't add child '%s' to itself.", child->get_name()));
+		ERR_CONTINUE_MSG(child->data.parent, vformat("Can't add child '%s' to '%s', already has a parent '%s'.", child->get_name(), get_name(), child->data.parent->get_name()));
+#ifdef DEBUG_ENABLED
+		ERR_CONTINUE_MSG(child->is_ancestor_of(this), vformat("Can't add child '%s' to '%s' as it would result in a cyclic dependency since '%s' is already a parent of '%s'.", child->get_name(), get_name(), child->get_name(), get_name()));
+#endif
+		ERR_CONTINUE_MSG(data.blocked > 0, "Parent node is busy setting up children, `add_children()` failed. Consider using `add_children.call_deferred(children)` instead.");
+
+		_validate_child_name(child, p_force_readable_name);
+
+#ifdef DEBUG_ENABLED
+		if (child->data.owner && !child->data.owner->is_ancestor_of(child)) {
+			// Owner of child should be ancestor of child.
+			WARN_PRINT(vformat("Adding '%s' as child to '%s' will make owner '%s' inconsistent. Consider unsetting the owner beforehand.", child->get_name(), get_name(), child->data.owner->get_name()));
+		}
+#endif // DEBUG_ENABLED
+
+		_add_child_nocheck(child, child->data.name, p_internal, false);
+		added = true;
+	}
+
+	if (added) {
+		notification(NOTIFICATION_CHILD_ORDER_CHANGED);
+		emit_signal(SNAME("child_order_changed"));
+	}
+}
+
 void Node::add_sibling(RequiredParam<Node> rp_sibling, bool p_force_readable_name) {
 	ERR_FAIL_COND_MSG(data.tree && !Thread::is_main_thread(), "Adding a sibling to a node inside the SceneTree is only allowed from the main thread. Use call_deferred(\"add_sibling\",node).");
 	EXTRACT_PARAM_OR_FAIL(p_sibling, rp_sibling);
@@ -1789,6 +1874,8 @@ void Node::remove_child(RequiredParam<Node> rp_child) {
 	}
 	bool success = data.children.erase(p_child->data.name);
 	ERR_FAIL_COND_MSG(!success, "Children name does not match parent name in hashtable, this is a bug.");
+	_clear_serial_child_name_hints();
+	_node_paths_changed();
 
 	p_child->data.parent = nullptr;
 	p_child->data.index = -1;
@@ -1927,6 +2014,99 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 
 	ERR_FAIL_COND_V_MSG(!data.tree && p_path.is_absolute(), nullptr, "Can't use get_node() with absolute paths from outside the active scene tree.");
 
+	// A single name is already a hash lookup, longer paths are cached until the branch they descend into changes.
+	if (!data.tree || p_path.get_name_count() < 2) {
+		return _resolve_node_path(p_path);
+	}
+
+	if (data.resolved_node_paths) {
+		const ResolvedNodePath *resolved = data.resolved_node_paths->getptr(p_path);
+		if (resolved) {
+			if (resolved->branch_name < 0) {
+				return _resolve_node_path(p_path);
+			}
+			// Only the branch has to be looked up again, changes outside of it don't invalidate the path.
+			const Node *branch = _get_node_path_branch(p_path, resolved->branch_name);
+			if (branch && branch->get_instance_id() == resolved->branch && branch->data.path_version == resolved->branch_version) {
+				return ObjectDB::get_instance<Node>(resolved->node);
+			}
+		}
+	} else {
+		data.resolved_node_paths = memnew((HashMap<NodePath, ResolvedNodePath>));
+	}
+
+	// Scripts building paths on the fly would otherwise grow this forever.
+	if (data.resolved_node_paths->size() >= 32) {
+		data.resolved_node_paths->clear();
+	}
+
+	Node *node = _resolve_node_path(p_path);
+	ResolvedNodePath &resolved = (*data.resolved_node_paths)[p_path];
+	resolved.branch_name = _get_node_path_branch_name(p_path);
+	const Node *branch = resolved.branch_name >= 0 ? _get_node_path_branch(p_path, resolved.branch_name) : nullptr;
+	resolved.branch = branch ? branch->get_instance_id() : ObjectID();
+	resolved.branch_version = branch ? branch->data.path_version : 0;
+	resolved.node = node ? node->get_instance_id() : ObjectID();
+	return node;
+}
+
+// Paths that climb with ".." (or start at the root) and then only descend through plain names
+// resolve to the same node as long as the first node they descend into and its subtree are unchanged.
+// Returns the index of that first name, or -1 for any other path.
+int Node::_get_node_path_branch_name(const NodePath &p_path) {
+	const int name_count = p_path.get_name_count();
+	int branch_name = 0;
+	if (p_path.is_absolute()) {
+		branch_name = 1; // The first name is the root.
+	} else {
+		while (branch_name < name_count && p_path.get_name(branch_name) == SNAME("..")) {
+			branch_name++;
+		}
+	}
+
+	// A path ending at the branch is resolved with a single lookup anyway.
+	if (name_count - branch_name < 2) {
+		return -1;
+	}
+
+	for (int i = branch_name; i < name_count; i++) {
+		const StringName name = p_path.get_name(i);
+		if (name == SNAME(".") || name == SNAME("..") || name.is_node_unique_name()) {
+			return -1;
+		}
+	}
+	return branch_name;
+}
+
+Node *Node::_get_node_path_branch(const NodePath &p_path, int p_branch_name) const {
+	const Node *base = this;
+	if (p_path.is_absolute()) {
+		while (base->data.parent) {
+			base = base->data.parent;
+		}
+		if (p_path.get_name(0) != base->data.name) {
+			return nullptr;
+		}
+	} else {
+		for (int i = 0; i < p_branch_name; i++) {
+			base = base->data.parent;
+			if (!base) {
+				return nullptr;
+			}
+		}
+	}
+
+	const Node *const *branch = base->data.children.getptr(p_path.get_name(p_branch_name));
+	return branch ? const_cast<Node *>(*branch) : nullptr;
+}
+
+void Node::_node_paths_changed() {
+	for (Node *n = this; n; n = n->data.parent) {
+		n->data.path_version++;
+	}
+}
+
+Node *Node::_resolve_node_path(const NodePath &p_path) const {
 	Node *current = nullptr;
 	Node *root = nullptr;
 
@@ -2007,6 +2187,16 @@ bool Node::has_node(const NodePath &p_path) const {
 Node *Node::find_child(const String &p_pattern, bool p_recursive, bool p_owned) const {
 	ERR_THREAD_GUARD_V(nullptr);
 	ERR_FAIL_COND_V(p_pattern.is_empty(), nullptr);
+
+	if (!p_recursive && !p_pattern.contains_char('*') && !p_pattern.contains_char('?')) {
+		// A pattern without wildcards can only match one child, so look it up by name.
+		const Node *const *child = data.children.getptr(p_pattern);
+		if (!child || (p_owned && !(*child)->data.owner)) {
+			return nullptr;
+		}
+		return const_cast<Node *>(*child);
+	}
+
 	_update_children_cache();
 	Node *const *cptr = data.children_cache.ptr();
 	int ccount = data.children_cache.size();
@@ -3793,6 +3983,7 @@ void Node::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_name", "name"), &Node::set_name);
 	ClassDB::bind_method(D_METHOD("get_name"), &Node::get_name);
 	ClassDB::bind_method(D_METHOD("add_child", "node", "force_readable_name", "internal"), &Node::add_child, DEFVAL(false), DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("add_children", "nodes", "force_readable_name", "internal"), &Node::add_children, DEFVAL(false), DEFVAL(0));
 	ClassDB::bind_method(D_METHOD("remove_child", "node"), &Node::remove_child);
 	ClassDB::bind_method(D_METHOD("reparent", "new_parent", "keep_global_transform"), &Node::reparent, DEFVAL(true));
 	ClassDB::bind_method(D_METHOD("get_child_count", "include_internal"), &Node::get_child_count, DEFVAL(false)); // Note that the default value bound for include_internal is false, while the method is declared with true. This is because internal nodes are irrelevant for GDSCript.
@@ -4152,6 +4343,7 @@ Node::Node() {
 
 	data.ready_notified = false; // This is a small hack, so if a node is added during _ready() to the tree, it correctly gets the _ready() notification.
 	data.ready_first = true;
+	data.free_on_thread = false;
 
 	data.auto_translate_mode = AUTO_TRANSLATE_MODE_INHERIT;
 	data.is_auto_translating = true;
@@ -4166,6 +4358,12 @@ Node::~Node() {
 	data.owned.clear();
 	data.children.clear();
 	data.children_cache.clear();
+	if (data.serial_child_name_hints) {
+		memdelete(data.serial_child_name_hints);
+	}
+	if (data.resolved_node_paths) {
+		memdelete(data.resolved_node_paths);
+	}
 
 	ERR_FAIL_COND(data.parent);
 	ERR_FAIL_COND(data.children_cache.size());
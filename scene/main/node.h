@@ -195,6 +195,21 @@ private:
 		bool operator()(const Node *p_a, const Node *p_b) const { return p_b->data.physics_process_priority == p_a->data.physics_process_priority ? p_b->is_greater_than(p_a) : p_b->data.physics_process_priority > p_a->data.physics_process_priority; }
 	};
 
+	// Where the last search for a free serial name in a sequence stopped, so the next search doesn't start over.
+	struct SerialChildNameHint {
+		String separator;
+		String base;
+		String nums;
+	};
+
+	// A NodePath resolved from this node, valid while the branch it descends into is the same and unchanged.
+	struct ResolvedNodePath {
+		int branch_name = -1; // Index of the first name below the climb, or -1 if the path isn't cached.
+		ObjectID branch;
+		uint64_t branch_version = 0;
+		ObjectID node;
+	};
+
 	// This Data struct is to avoid namespace pollution in derived classes.
 	struct Data {
 		String scene_file_path;
@@ -204,6 +219,9 @@ private:
 		Node *parent = nullptr;
 		Node *owner = nullptr;
 		HashMap<StringName, Node *> children;
+		mutable HashMap<StringName, SerialChildNameHint> *serial_child_name_hints = nullptr; // Built lazily, cleared when a child is removed or renamed.
+		mutable HashMap<NodePath, ResolvedNodePath> *resolved_node_paths = nullptr; // Built lazily by get_node_or_null().
+		uint64_t path_version = 0; // Bumped when a child of this node or of any descendant is added, removed or renamed.
 		mutable bool children_cache_dirty = false;
 		mutable LocalVector<Node *> children_cache;
 		HashMap<StringName, Node *> owned_unique_nodes;
@@ -286,6 +304,10 @@ private:
 		bool ready_notified : 1;
 		bool ready_first : 1;
 
+		// Set by the SceneTree on branches it frees on a thread. They are only detached when their parent is freed,
+		// and stay flagged while they wait for the thread.
+		bool free_on_thread : 1;
+
 		mutable bool is_auto_translating : 1;
 		mutable bool is_auto_translate_dirty : 1;
 
@@ -343,6 +365,10 @@ private:
 
 	void _clean_up_owner();
 
+	// Classes with nothing to release on the main thread once their nodes are outside the tree.
+	static HashSet<StringName> thread_safe_free_classes;
+	bool _is_thread_safe_to_free() const;
+
 	_FORCE_INLINE_ void _update_children_cache() const {
 		if (unlikely(data.children_cache_dirty)) {
 			_update_children_cache_impl();
@@ -391,7 +417,16 @@ protected:
 
 	friend class SceneState;
 
-	void _add_child_nocheck(Node *p_child, const StringName &p_name, InternalMode p_internal_mode = INTERNAL_MODE_DISABLED);
+	void _add_child_nocheck(Node *p_child, const StringName &p_name, InternalMode p_internal_mode = INTERNAL_MODE_DISABLED, bool p_notify_child_order = true);
+	_FORCE_INLINE_ void _clear_serial_child_name_hints() {
+		if (data.serial_child_name_hints) {
+			data.serial_child_name_hints->clear();
+		}
+	}
+	Node *_resolve_node_path(const NodePath &p_path) const;
+	static int _get_node_path_branch_name(const NodePath &p_path);
+	Node *_get_node_path_branch(const NodePath &p_path, int p_branch_name) const;
+	void _node_paths_changed();
 	void _set_owner_nocheck(Node *p_owner);
 	void _set_name_nocheck(const StringName &p_name);
 
@@ -523,6 +558,7 @@ public:
 	InternalMode get_internal_mode() const;
 
 	void add_child(RequiredParam<Node> rp_child, bool p_force_readable_name = false, InternalMode p_internal = INTERNAL_MODE_DISABLED);
+	void add_children(const TypedArray<Node> &p_children, bool p_force_readable_name = false, InternalMode p_internal = INTERNAL_MODE_DISABLED);
 	void add_sibling(RequiredParam<Node> rp_sibling, bool p_force_readable_name = false);
 	void remove_child(RequiredParam<Node> rp_child);
 
@@ -789,6 +825,10 @@ public:
 	//hacks for speed
 	static void init_node_hrcr();
 
+	// Lets the SceneTree free nodes of this exact class on a worker thread, see SceneTree::set_threaded_node_free().
+	static void add_thread_safe_free_class(const StringName &p_class);
+	static void clear_thread_safe_free_classes();
+
 	bool is_owned_by_parent() const;
 
 	void clear_internal_tree_resource_paths();
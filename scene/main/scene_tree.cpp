@@ -197,9 +197,100 @@ void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
 	}
 }
 
+template <typename T>
+void SceneTree::_propagate_transforms(const LocalVector<T *> &p_roots) {
+	LocalVector<T *> level;
+	LocalVector<T *> next_level;
+	LocalVector<T *> notify;
+
+	for (T *branch_root : p_roots) {
+		branch_root->_propagate_transform_batched(true, next_level, notify);
+	}
+
+	// Walk breadth-first on this thread until there are enough independent subtrees to keep the worker threads busy.
+	const uint32_t min_subtrees = WorkerThreadPool::get_singleton()->get_thread_count() > 1 ? WorkerThreadPool::get_singleton()->get_thread_count() * 4 : UINT32_MAX;
+	while (!next_level.is_empty() && next_level.size() < min_subtrees) {
+		SWAP(level, next_level);
+		next_level.clear();
+		for (T *node : level) {
+			node->_propagate_transform_batched(false, next_level, notify);
+		}
+	}
+
+	if (!next_level.is_empty()) {
+		TransformPropagationBatch<T> batch;
+		batch.subtrees = next_level;
+		batch.notify.resize(next_level.size());
+
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_propagate_transform_subtree<T>, &batch, batch.subtrees.size(), -1, true, SNAME("PropagateTransforms"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+		for (const LocalVector<T *> &subtree_notify : batch.notify) {
+			for (T *node : subtree_notify) {
+				notify.push_back(node);
+			}
+		}
+	}
+
+	// The notifications are sent from here, as SceneTree::xform_change_list can only be modified on the main thread.
+	for (T *node : notify) {
+		if (!node->xform_change.in_list()) {
+			xform_change_list.add(&node->xform_change);
+		}
+	}
+}
+
+template <typename T>
+void SceneTree::_propagate_transform_subtree(uint32_t p_index, TransformPropagationBatch<T> *p_batch) {
+	LocalVector<T *> stack;
+	stack.push_back(p_batch->subtrees[p_index]);
+	while (!stack.is_empty()) {
+		T *node = stack[stack.size() - 1];
+		stack.resize(stack.size() - 1);
+		node->_propagate_transform_batched(false, stack, p_batch->notify[p_index]);
+	}
+}
+
+void SceneTree::flush_transform_propagation() {
+	if (!xform_propagate_list.first()) {
+		return;
+	}
+
+#ifndef _3D_DISABLED
+	LocalVector<Node3D *> roots_3d;
+#endif // _3D_DISABLED
+	LocalVector<CanvasItem *> roots_2d;
+
+	for (SelfList<Node> *E = xform_propagate_list.first(); E; E = E->next()) {
+#ifndef _3D_DISABLED
+		Node3D *node_3d = Object::cast_to<Node3D>(E->self());
+		if (node_3d) {
+			// Roots below another pending root are reached from it anyway.
+			if (!node_3d->_is_below_pending_transform_propagation()) {
+				roots_3d.push_back(node_3d);
+			}
+			continue;
+		}
+#endif // _3D_DISABLED
+		roots_2d.push_back(static_cast<CanvasItem *>(E->self()));
+	}
+
+	// Canvas items stay listed while propagating, as their walks stop at other pending roots.
+	_propagate_transforms(roots_2d);
+
+	// Clear the list before resolving 3D transforms, so reading them doesn't try to flush again.
+	xform_propagate_list.clear();
+
+#ifndef _3D_DISABLED
+	_propagate_transforms(roots_3d);
+#endif // _3D_DISABLED
+}
+
 void SceneTree::flush_transform_notifications() {
 	_THREAD_SAFE_METHOD_
 
+	flush_transform_propagation();
+
 	SelfList<Node> *n = xform_change_list.first();
 	while (n) {
 		Node *node = n->self();
@@ -405,41 +496,48 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 		nodes_removed_on_group_call_lock++;
 	}
 
-	if (p_call_flags & GROUP_CALL_REVERSE) {
-		for (int i = gr_node_count - 1; i >= 0; i--) {
-			if (nodes_removed_on_group_call_lock && nodes_removed_on_group_call.has(gr_nodes[i])) {
-				continue;
-			}
+	const bool deferred = p_call_flags & GROUP_CALL_DEFERRED;
+	// Nodes in sub-thread process groups are called from their group's thread, after the nodes called on the main thread.
+	const bool threaded = !deferred && (p_call_flags & GROUP_CALL_THREADED) && !node_threading_disabled && Thread::is_main_thread();
 
-			Node *node = gr_nodes[i];
-			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				Callable::CallError ce;
-				node->callp(p_function, p_args, p_argcount, ce);
-				if (unlikely(ce.error != Callable::CallError::CALL_OK && ce.error != Callable::CallError::CALL_ERROR_INVALID_METHOD)) {
-					ERR_PRINT(vformat("Error calling group method on node \"%s\": %s.", node->get_name(), Variant::get_callable_error_text(Callable(node, p_function), p_args, p_argcount, ce)));
-				}
-			} else {
-				MessageQueue::get_singleton()->push_callp(node, p_function, p_args, p_argcount);
-			}
+	GroupCallMethodCache method_cache;
+	GroupCallThreadData thread_data;
+	HashMap<Node *, uint32_t> thread_batch_indices;
+
+	for (int n = 0; n < gr_node_count; n++) {
+		Node *node = gr_nodes[p_call_flags & GROUP_CALL_REVERSE ? gr_node_count - 1 - n : n];
+		if (!nodes_removed_on_group_call.is_empty() && nodes_removed_on_group_call.has(node)) {
+			continue;
 		}
 
-	} else {
-		for (int i = 0; i < gr_node_count; i++) {
-			if (nodes_removed_on_group_call_lock && nodes_removed_on_group_call.has(gr_nodes[i])) {
-				continue;
-			}
+		if (deferred) {
+			MessageQueue::get_singleton()->push_callp(node, p_function, p_args, p_argcount);
+			continue;
+		}
 
-			Node *node = gr_nodes[i];
-			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				Callable::CallError ce;
-				node->callp(p_function, p_args, p_argcount, ce);
-				if (unlikely(ce.error != Callable::CallError::CALL_OK && ce.error != Callable::CallError::CALL_ERROR_INVALID_METHOD)) {
-					ERR_PRINT(vformat("Error calling group method on node \"%s\": %s.", node->get_name(), Variant::get_callable_error_text(Callable(node, p_function), p_args, p_argcount, ce)));
+		if (threaded) {
+			Node *owner = node->data.process_thread_group_owner;
+			if (owner && owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD) {
+				uint32_t *index = thread_batch_indices.getptr(owner);
+				if (!index) {
+					index = &thread_batch_indices.insert(owner, thread_data.batches.size())->value;
+					thread_data.batches.push_back(GroupCallThreadBatch());
+					thread_data.batches[*index].owner = owner;
 				}
-			} else {
-				MessageQueue::get_singleton()->push_callp(node, p_function, p_args, p_argcount);
+				thread_data.batches[*index].nodes.push_back(node);
+				continue;
 			}
 		}
+
+		_call_group_node(node, p_function, p_args, p_argcount, method_cache);
+	}
+
+	if (!thread_data.batches.is_empty()) {
+		thread_data.function = p_function;
+		thread_data.args = p_args;
+		thread_data.argcount = p_argcount;
+		WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_call_group_thread, &thread_data, thread_data.batches.size(), -1, true, SNAME("CallGroup"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
 	}
 
 	{
@@ -451,6 +549,44 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 	}
 }
 
+void SceneTree::_call_group_node(Node *p_node, const StringName &p_function, const Variant **p_args, int p_argcount, GroupCallMethodCache &r_cache) {
+	Callable::CallError ce;
+	if (p_node->get_script_instance() || p_function == CoreStringName(free_)) {
+		p_node->callp(p_function, p_args, p_argcount, ce);
+	} else {
+		// Same as Object::callp() for objects without a script, without looking the method up again for each node.
+		const StringName &class_name = p_node->get_class_name();
+		if (class_name != r_cache.class_name) {
+			r_cache.class_name = class_name;
+			r_cache.method = ClassDB::get_method(class_name, p_function);
+		}
+		if (r_cache.method) {
+			r_cache.method->call(p_node, p_args, p_argcount, ce);
+		} else {
+			ce.error = Callable::CallError::CALL_ERROR_INVALID_METHOD;
+		}
+	}
+
+	if (unlikely(ce.error != Callable::CallError::CALL_OK && ce.error != Callable::CallError::CALL_ERROR_INVALID_METHOD)) {
+		ERR_PRINT(vformat("Error calling group method on node \"%s\": %s.", p_node->get_name(), Variant::get_callable_error_text(Callable(p_node, p_function), p_args, p_argcount, ce)));
+	}
+}
+
+void SceneTree::_call_group_thread(uint32_t p_index, GroupCallThreadData *p_data) {
+	const GroupCallThreadBatch &batch = p_data->batches[p_index];
+	GroupCallMethodCache method_cache;
+
+	Node::current_process_thread_group = batch.owner;
+	for (Node *node : batch.nodes) {
+		// Nodes can only be removed on the main thread, which is waiting for this task.
+		if (!nodes_removed_on_group_call.is_empty() && nodes_removed_on_group_call.has(node)) {
+			continue;
+		}
+		_call_group_node(node, p_data->function, p_data->args, p_data->argcount, method_cache);
+	}
+	Node::current_process_thread_group = nullptr;
+}
+
 void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_group, int p_notification) {
 	Vector<Node *> nodes_copy;
 	{
@@ -868,6 +1004,8 @@ void SceneTree::finalize() {
 		_flush_delete_queue();
 	}
 
+	wait_for_threaded_node_free();
+
 	MainLoop::finalize();
 
 	// Cleanup timers.
@@ -1310,6 +1448,8 @@ void SceneTree::_process(bool p_physics) {
 				}
 
 				if (using_threads) {
+					// Threaded groups must not see transforms that are only partially propagated.
+					flush_transform_propagation();
 					WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_groups_thread, p_physics, local_process_group_cache.size(), -1, true);
 					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
 				}
@@ -1626,13 +1766,129 @@ Vector<Node *> SceneTree::get_nodes_in_group(const StringName &p_group) {
 void SceneTree::_flush_delete_queue() {
 	_THREAD_SAFE_METHOD_
 
+	const bool free_on_thread = threaded_node_free && !Engine::get_singleton()->is_editor_hint();
+
 	while (delete_queue.size()) {
 		Object *obj = ObjectDB::get_instance(delete_queue.front()->get());
 		if (obj) {
-			memdelete(obj);
+			Node *node = free_on_thread ? Object::cast_to<Node>(obj) : nullptr;
+			if (node) {
+				if (!node->data.free_on_thread) {
+					_delete_node(node);
+				} // Else it was detached and queued along with an ancestor freed earlier in this flush.
+			} else {
+				memdelete(obj);
+			}
 		}
 		delete_queue.pop_front();
 	}
+
+	if (!threaded_free_nodes.is_empty()) {
+		wait_for_threaded_node_free();
+		SWAP(threaded_free_nodes, threaded_free_task_nodes);
+		threaded_free_task = WorkerThreadPool::get_singleton()->add_template_task(this, &SceneTree::_free_nodes_threaded, &threaded_free_task_nodes, false, SNAME("FreeNodes"));
+	}
+}
+
+void SceneTree::_delete_node(Node *p_node) {
+	LocalVector<Node *> branches;
+	_collect_thread_safe_branches(p_node, branches);
+	if (branches.is_empty()) {
+		memdelete(p_node);
+		return;
+	}
+
+	// Notifications and user code run while freeing may free or reparent the branches, so keep their IDs.
+	LocalVector<ObjectID> branch_ids;
+	branch_ids.reserve(branches.size());
+	for (Node *branch : branches) {
+		branch->data.free_on_thread = true;
+		branch_ids.push_back(branch->get_instance_id());
+	}
+
+	if (branches[0] == p_node) {
+		// Exits the tree right away, the branch is freed on a thread like any other.
+		if (p_node->data.parent) {
+			p_node->data.parent->remove_child(p_node);
+		}
+	} else {
+		// Detaches the branches instead of freeing them.
+		memdelete(p_node);
+	}
+
+	for (const ObjectID &id : branch_ids) {
+		Node *branch = ObjectDB::get_instance<Node>(id);
+		if (!branch) {
+			continue;
+		}
+		if (branch->data.parent || branch->data.tree) {
+			// Still in use, freeing may have been cancelled.
+			branch->data.free_on_thread = false;
+			continue;
+		}
+		if (_prepare_thread_safe_branch(branch, branch)) {
+			// Stays flagged, so the branch is skipped if it was queued for deletion itself.
+			threaded_free_nodes.push_back(branch);
+		} else {
+			branch->data.free_on_thread = false;
+			memdelete(branch);
+		}
+	}
+}
+
+bool SceneTree::_collect_thread_safe_branches(Node *p_node, LocalVector<Node *> &r_branches) {
+	bool safe = p_node->_is_thread_safe_to_free();
+	const uint32_t first = r_branches.size();
+
+	for (KeyValue<StringName, Node *> &K : p_node->data.children) {
+		if (!_collect_thread_safe_branches(K.value, r_branches)) {
+			safe = false;
+		}
+	}
+
+	if (safe) {
+		// Every child is a safe branch on its own, free them together with this node.
+		r_branches.resize(first);
+		r_branches.push_back(p_node);
+	}
+	return safe;
+}
+
+bool SceneTree::_prepare_thread_safe_branch(Node *p_branch, Node *p_node) {
+	if (!p_node->_is_thread_safe_to_free()) {
+		return false;
+	}
+
+	// Owners outside the branch are still around, let go of them here rather than on the thread.
+	Node *owner = p_node->data.owner;
+	if (owner && owner != p_branch && !p_branch->is_ancestor_of(owner)) {
+		p_node->_clean_up_owner();
+	}
+
+	for (KeyValue<StringName, Node *> &K : p_node->data.children) {
+		if (!_prepare_thread_safe_branch(p_branch, K.value)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void SceneTree::_free_nodes_threaded(LocalVector<Node *> *p_nodes) {
+	for (Node *node : *p_nodes) {
+		memdelete(node);
+	}
+	p_nodes->clear();
+}
+
+void SceneTree::set_threaded_node_free(bool p_enable) {
+	threaded_node_free = p_enable;
+}
+
+void SceneTree::wait_for_threaded_node_free() {
+	if (threaded_free_task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(threaded_free_task);
+		threaded_free_task = WorkerThreadPool::INVALID_TASK_ID;
+	}
 }
 
 void SceneTree::queue_delete(RequiredParam<Object> rp_object) {
@@ -1992,6 +2248,7 @@ void SceneTree::_bind_methods() {
 	BIND_ENUM_CONSTANT(GROUP_CALL_REVERSE);
 	BIND_ENUM_CONSTANT(GROUP_CALL_DEFERRED);
 	BIND_ENUM_CONSTANT(GROUP_CALL_UNIQUE);
+	BIND_ENUM_CONSTANT(GROUP_CALL_THREADED);
 }
 
 SceneTree *SceneTree::singleton = nullptr;
@@ -2047,6 +2304,13 @@ void SceneTree::set_disable_node_threading(bool p_disable) {
 	node_threading_disabled = p_disable;
 }
 
+void SceneTree::set_batch_transform_propagation(bool p_enable) {
+	if (!p_enable) {
+		flush_transform_propagation();
+	}
+	batch_transform_propagation = p_enable;
+}
+
 SceneTree::SceneTree() {
 	if (singleton == nullptr) {
 		singleton = this;
@@ -2057,6 +2321,8 @@ SceneTree::SceneTree() {
 	debug_paths_width = GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "debug/shapes/paths/geometry_width", PROPERTY_HINT_RANGE, "0.01,10,0.001,or_greater"), 2.0);
 	collision_debug_contacts = GLOBAL_DEF(PropertyInfo(Variant::INT, "debug/shapes/collision/max_contacts_displayed", PROPERTY_HINT_RANGE, "0,20000,1"), 10000);
 	accessibility_upd_per_sec = GLOBAL_GET(SNAME("accessibility/general/updates_per_second"));
+	batch_transform_propagation = GLOBAL_DEF("application/run/batch_transform_propagation", false);
+	threaded_node_free = GLOBAL_DEF("application/run/threaded_node_free", false);
 
 	GLOBAL_DEF("debug/shapes/collision/draw_2d_outlines", true);
 
@@ -2227,6 +2493,8 @@ SceneTree::SceneTree() {
 }
 
 SceneTree::~SceneTree() {
+	wait_for_threaded_node_free();
+
 	if (prev_scene_id.is_valid()) {
 		Node *prev_scene = ObjectDB::get_instance<Node>(prev_scene_id);
 		if (prev_scene) {
@@ -32,6 +32,7 @@
 
 #include "core/object/message_queue.h"
 #include "core/object/ref_counted.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/main_loop.h"
 #include "core/os/thread_safe.h"
 #include "core/templates/paged_allocator.h"
@@ -187,6 +188,12 @@ private:
 
 	List<ObjectID> delete_queue;
 
+	// Detached branches of queued nodes that are freed on a worker thread.
+	bool threaded_node_free = false;
+	LocalVector<Node *> threaded_free_nodes;
+	LocalVector<Node *> threaded_free_task_nodes;
+	WorkerThreadPool::TaskID threaded_free_task = WorkerThreadPool::INVALID_TASK_ID;
+
 	uint64_t accessibility_upd_per_sec = 0;
 	bool accessibility_force_update = true;
 	HashSet<ObjectID> accessibility_change_queue;
@@ -198,6 +205,27 @@ private:
 
 	_FORCE_INLINE_ void _update_group_order(SceneTreeGroup &g);
 
+	// Group members are mostly of the same few classes, so native methods are resolved once per class instead of once per node.
+	struct GroupCallMethodCache {
+		StringName class_name;
+		MethodBind *method = nullptr;
+	};
+
+	struct GroupCallThreadBatch {
+		Node *owner = nullptr; // Owner of the sub-thread process group these nodes belong to.
+		LocalVector<Node *> nodes;
+	};
+
+	struct GroupCallThreadData {
+		StringName function;
+		const Variant **args = nullptr;
+		int argcount = 0;
+		LocalVector<GroupCallThreadBatch> batches;
+	};
+
+	void _call_group_node(Node *p_node, const StringName &p_function, const Variant **p_args, int p_argcount, GroupCallMethodCache &r_cache);
+	void _call_group_thread(uint32_t p_index, GroupCallThreadData *p_data);
+
 	TypedArray<Node> _get_nodes_in_group(const StringName &p_group);
 
 	Node *current_scene = nullptr;
@@ -250,6 +278,10 @@ private:
 	void _call_group(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 
 	void _flush_delete_queue();
+	void _delete_node(Node *p_node);
+	bool _collect_thread_safe_branches(Node *p_node, LocalVector<Node *> &r_branches);
+	bool _prepare_thread_safe_branch(Node *p_branch, Node *p_node);
+	void _free_nodes_threaded(LocalVector<Node *> *p_nodes);
 	// Optimization.
 	friend class CanvasItem;
 	friend class Node3D;
@@ -257,6 +289,22 @@ private:
 
 	SelfList<Node>::List xform_change_list;
 
+	// Nodes whose transform changed on the main thread, but whose descendants have not been updated yet.
+	// They are propagated together on flush, or before any global transform that depends on them is read.
+	SelfList<Node>::List xform_propagate_list;
+	bool batch_transform_propagation = false;
+
+	template <typename T>
+	struct TransformPropagationBatch {
+		LocalVector<T *> subtrees;
+		LocalVector<LocalVector<T *>> notify;
+	};
+
+	template <typename T>
+	void _propagate_transforms(const LocalVector<T *> &p_roots);
+	template <typename T>
+	void _propagate_transform_subtree(uint32_t p_index, TransformPropagationBatch<T> *p_batch);
+
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
 #endif
@@ -298,6 +346,7 @@ public:
 		GROUP_CALL_REVERSE = 1,
 		GROUP_CALL_DEFERRED = 2,
 		GROUP_CALL_UNIQUE = 4,
+		GROUP_CALL_THREADED = 8,
 	};
 
 	RequiredResult<Window> get_root() const;
@@ -333,6 +382,8 @@ public:
 	}
 
 	void flush_transform_notifications();
+	void flush_transform_propagation();
+	_FORCE_INLINE_ bool has_pending_transform_propagation() const { return xform_propagate_list.first() != nullptr; }
 
 	bool is_accessibility_enabled() const;
 	bool is_accessibility_supported() const;
@@ -410,6 +461,9 @@ public:
 	int get_node_count() const;
 
 	void queue_delete(RequiredParam<Object> rp_object);
+	void set_threaded_node_free(bool p_enable);
+	bool is_threaded_node_free() const { return threaded_node_free; }
+	void wait_for_threaded_node_free();
 
 	Vector<Node *> get_nodes_in_group(const StringName &p_group);
 	Node *get_first_node_in_group(const StringName &p_group);
@@ -454,6 +508,8 @@ public:
 	static void add_idle_callback(IdleCallback p_callback);
 
 	void set_disable_node_threading(bool p_disable);
+	void set_batch_transform_propagation(bool p_enable);
+	bool is_batching_transform_propagation() const { return batch_transform_propagation; }
 	//default texture settings
 
 	void set_physics_interpolation_enabled(bool p_enabled);
@@ -35,6 +35,7 @@
 #include "core/config/engine.h"
 #include "core/config/project_settings.h"
 #include "core/math/transform_interpolator.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "scene/3d/visual_instance_3d.h"
 
@@ -98,6 +99,7 @@ void SceneTreeFTI::set_enabled(Node *p_root, bool p_enabled) {
 	data.request_reset_list.clear();
 
 	_clear_depth_lists();
+	_clear_batch();
 
 	// Node3D flags must be reset.
 	if (p_root) {
@@ -217,6 +219,83 @@ void SceneTreeFTI::_update_request_resets() {
 	data.request_reset_list.clear();
 }
 
+void SceneTreeFTI::_interpolate_batch(float p_interpolation_fraction) {
+	const LocalVector<Node3D *> &tick_list = data.tick_xform_list[data.mirror];
+	uint32_t tick_list_size = tick_list.size();
+
+	_clear_batch();
+	if (!tick_list_size) {
+		return;
+	}
+
+	data.batch_nodes.reserve(tick_list_size);
+	data.batch_xforms_prev.reserve(tick_list_size);
+	data.batch_xforms_curr.reserve(tick_list_size);
+
+	// Gather on the calling thread, as `get_transform()` may need to update a dirty local xform.
+	for (uint32_t n = 0; n < tick_list_size; n++) {
+		Node3D *s = tick_list[n];
+		if (!s->data.fti_on_tick_xform_list || !s->is_physics_interpolated()) {
+			continue;
+		}
+
+		s->data.fti_batch_index = data.batch_nodes.size();
+		data.batch_nodes.push_back(s);
+		data.batch_xforms_prev.push_back(s->data.local_transform_prev);
+		data.batch_xforms_curr.push_back(s->get_transform());
+	}
+
+	uint32_t batch_size = data.batch_nodes.size();
+	data.batch_xforms_interp.resize(batch_size);
+	data.batch_interpolation_fraction = p_interpolation_fraction;
+
+	uint32_t range_count = Math::division_round_up(batch_size, data.batch_range_size);
+	if (range_count >= data.batch_min_ranges_for_threads && WorkerThreadPool::get_singleton()->get_thread_count() > 1) {
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTreeFTI::_interpolate_batch_range, (void *)nullptr, range_count, -1, true, SNAME("InterpolateTransforms"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	} else {
+		for (uint32_t r = 0; r < range_count; r++) {
+			_interpolate_batch_range(r, nullptr);
+		}
+	}
+}
+
+void SceneTreeFTI::_interpolate_batch_range(uint32_t p_range, void *p_userdata) {
+	uint32_t from = p_range * data.batch_range_size;
+	uint32_t to = MIN(from + data.batch_range_size, data.batch_nodes.size());
+
+	const Transform3D *prev = data.batch_xforms_prev.ptr();
+	const Transform3D *curr = data.batch_xforms_curr.ptr();
+	Transform3D *interp = data.batch_xforms_interp.ptr();
+	float fraction = data.batch_interpolation_fraction;
+
+	// Must use the same interpolation as `_get_local_xform_interpolated()`,
+	// so results don't depend on whether a node was batched.
+	for (uint32_t n = from; n < to; n++) {
+		TransformInterpolator::interpolate_transform_3d(prev[n], curr[n], interp[n], fraction);
+	}
+}
+
+void SceneTreeFTI::_clear_batch() {
+	// Only the size is checked when looking up `fti_batch_index`, so there is no need to reset it on the nodes.
+	data.batch_nodes.clear();
+	data.batch_xforms_prev.clear();
+	data.batch_xforms_curr.clear();
+	data.batch_xforms_interp.clear();
+}
+
+void SceneTreeFTI::_get_local_xform_interpolated(Node3D &r_node, float p_interpolation_fraction, Transform3D &r_xform) {
+	uint32_t index = r_node.data.fti_batch_index;
+	if (index < data.batch_nodes.size() && data.batch_nodes[index] == &r_node) {
+		r_xform = data.batch_xforms_interp[index];
+		return;
+	}
+
+	// Make sure to call `get_transform()` rather than using local_transform directly, because
+	// local_transform may be dirty and need updating from rotation / scale.
+	TransformInterpolator::interpolate_transform_3d(r_node.data.local_transform_prev, r_node.get_transform(), r_xform, p_interpolation_fraction);
+}
+
 void SceneTreeFTI::node_3d_request_reset(Node3D *p_node) {
 	DEV_CHECK_ONCE(data.enabled);
 	DEV_ASSERT(p_node);
@@ -547,9 +626,7 @@ void SceneTreeFTI::_update_dirty_nodes(Node *p_node, uint32_t p_current_half_fra
 			// There may be no need to interpolate if the node has not been moved recently
 			// and is therefore not on the tick list...
 			if (s->data.fti_on_tick_xform_list) {
-				// Make sure to call `get_transform()` rather than using local_transform directly, because
-				// local_transform may be dirty and need updating from rotation / scale.
-				TransformInterpolator::interpolate_transform_3d(s->data.local_transform_prev, s->get_transform(), local_interp, p_interpolation_fraction);
+				_get_local_xform_interpolated(*s, p_interpolation_fraction, local_interp);
 			} else {
 				local_interp = s->get_transform();
 			}
@@ -637,6 +714,8 @@ void SceneTreeFTI::frame_update(Node *p_root, bool p_frame_start) {
 
 	uint32_t half_frame = p_frame_start ? (frame * 2) : ((frame * 2) + 1);
 
+	_interpolate_batch(interpolation_fraction);
+
 	bool print_debug_stats = false;
 	switch (data.traversal_mode) {
 		case TM_LEGACY: {
@@ -736,6 +815,8 @@ void SceneTreeFTI::frame_update(Node *p_root, bool p_frame_start) {
 	}
 	data.frame_xform_list_forced.clear();
 
+	_clear_batch();
+
 	if (!p_frame_start && data.periodic_debug_log) {
 		data.periodic_debug_log = false;
 	}
@@ -79,6 +79,11 @@ class SceneTreeFTI {
 	struct Data {
 		static const uint32_t scene_tree_depth_limit = 48;
 
+		// Interpolation batches are split into ranges of this many nodes,
+		// which are spread over worker threads when there are enough of them.
+		static const uint32_t batch_range_size = 512;
+		static const uint32_t batch_min_ranges_for_threads = 4;
+
 		// Prev / Curr lists of Node3Ds having local xforms pumped.
 		LocalVector<Node3D *> tick_xform_list[2];
 
@@ -94,6 +99,15 @@ class SceneTreeFTI {
 		LocalVector<Node3D *> request_reset_list;
 		LocalVector<Node3D *> dirty_node_depth_lists[scene_tree_depth_limit];
 
+		// Local xforms of the nodes moved on the last tick, interpolated in one batch
+		// at the start of each frame update rather than one at a time during traversal.
+		// Kept as separate arrays so the interpolation streams through contiguous memory.
+		LocalVector<Node3D *> batch_nodes;
+		LocalVector<Transform3D> batch_xforms_prev;
+		LocalVector<Transform3D> batch_xforms_curr;
+		LocalVector<Transform3D> batch_xforms_interp;
+		float batch_interpolation_fraction = 0;
+
 		// When we are using two alternating lists,
 		// which one is current.
 		uint32_t mirror = 0;
@@ -126,6 +140,11 @@ class SceneTreeFTI {
 	void _update_dirty_nodes(Node *p_node, uint32_t p_current_half_frame, float p_interpolation_fraction, bool p_active, const Transform3D *p_parent_global_xform = nullptr, int p_depth = 0);
 	void _update_request_resets();
 
+	void _interpolate_batch(float p_interpolation_fraction);
+	void _interpolate_batch_range(uint32_t p_range, void *p_userdata);
+	void _clear_batch();
+	void _get_local_xform_interpolated(Node3D &r_node, float p_interpolation_fraction, Transform3D &r_xform);
+
 	void _reset_flags(Node *p_node);
 	void _reset_node3d_flags(Node3D &r_node);
 	void _node_3d_notify_set_xform(Node3D &r_node);
@@ -33,6 +33,7 @@
 #ifdef GODOT_SCENE_TREE_FTI_VERIFY
 #include "scene_tree_fti_tests.h"
 
+#include "core/math/transform_interpolator.h"
 #include "scene/3d/node_3d.h"
 #include "scene/3d/visual_instance_3d.h"
 #include "scene/main/scene_tree_fti.h"
@@ -119,6 +120,16 @@ void SceneTreeFTITests::update_dirty_nodes(Node *p_node, uint32_t p_current_half
 		if (s->is_physics_interpolated()) {
 			if (s->data.fti_on_tick_xform_list) {
 				TransformInterpolator::interpolate_transform_3d(s->data.local_transform_prev, s->get_transform(), local_interp, p_interpolation_fraction);
+
+				// Every interpolated node moved on the last tick is batched,
+				// and the batch must give exactly the same result.
+				uint32_t batch_index = s->data.fti_batch_index;
+				bool batched = batch_index < data.batch_nodes.size() && data.batch_nodes[batch_index] == s;
+				DEV_ASSERT(batched);
+				if (batched && data.batch_xforms_interp[batch_index] != local_interp) {
+					debug_verify_failed(s, data.batch_xforms_interp[batch_index]);
+					DEV_ASSERT(data.batch_xforms_interp[batch_index] == local_interp);
+				}
 			} else {
 				local_interp = s->get_transform();
 			}
@@ -436,6 +436,7 @@ void register_scene_types() {
 	OS::get_singleton()->yield(); // may take time to init
 
 	GDREGISTER_CLASS(Node);
+	Node::add_thread_safe_free_class(Node::get_class_static());
 	GDREGISTER_CLASS(MissingNode);
 	GDREGISTER_ABSTRACT_CLASS(InstancePlaceholder);
 
@@ -623,6 +624,7 @@ void register_scene_types() {
 
 #ifndef _3D_DISABLED
 	GDREGISTER_CLASS(Node3D);
+	Node::add_thread_safe_free_class(Node3D::get_class_static());
 	GDREGISTER_ABSTRACT_CLASS(Node3DGizmo);
 	GDREGISTER_CLASS(Skin);
 	GDREGISTER_ABSTRACT_CLASS(SkinReference);
@@ -1373,6 +1375,7 @@ void unregister_scene_types() {
 	ColorPickerShape::finish_shaders();
 	BlitMaterial::cleanup_shader();
 	GraphEdit::finish_shaders();
+	Node::clear_thread_safe_free_classes();
 	SceneStringNames::free();
 
 	OS::get_singleton()->benchmark_end_measure("Scene", "Unregister Types");
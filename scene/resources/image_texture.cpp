@@ -121,6 +121,13 @@ Ref<Image> ImageTexture::get_image() const {
 	}
 }
 
+uint64_t ImageTexture::get_memory_usage_estimate() const {
+	if (!image_stored) {
+		return sizeof(ImageTexture);
+	}
+	return sizeof(ImageTexture) + Image::get_image_data_size(w, h, format, mipmaps);
+}
+
 int ImageTexture::get_width() const {
 	return w;
 }
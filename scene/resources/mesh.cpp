@@ -2013,6 +2013,24 @@ RID ArrayMesh::get_rid() const {
 	return mesh;
 }
 
+uint64_t ArrayMesh::get_memory_usage_estimate() const {
+	// Computed from the surface formats, as fetching the arrays back from the rendering server is expensive.
+	const RenderingServer *rs = RenderingServer::get_singleton();
+	if (!rs) {
+		return Mesh::get_memory_usage_estimate();
+	}
+
+	uint64_t size = sizeof(ArrayMesh);
+	for (const Surface &surface : surfaces) {
+		const uint64_t vertex_size = rs->mesh_surface_get_format_vertex_stride(surface.format, surface.array_length);
+		size += vertex_size * surface.array_length * (1 + blend_shapes.size());
+		size += uint64_t(rs->mesh_surface_get_format_attribute_stride(surface.format, surface.array_length)) * surface.array_length;
+		size += uint64_t(rs->mesh_surface_get_format_skin_stride(surface.format, surface.array_length)) * surface.array_length;
+		size += uint64_t(rs->mesh_surface_get_format_index_stride(surface.format, surface.array_length)) * surface.index_array_length;
+	}
+	return size;
+}
+
 AABB ArrayMesh::get_aabb() const {
 	return aabb;
 }
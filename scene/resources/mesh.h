@@ -389,6 +389,7 @@ public:
 
 	AABB get_aabb() const override;
 	virtual RID get_rid() const override;
+	virtual uint64_t get_memory_usage_estimate() const override;
 
 	void regen_normal_maps();
 
@@ -225,7 +225,59 @@ static Node *_find_node_by_id(Node *p_owner, Node *p_node, int32_t p_id) {
 	return nullptr;
 }
 
+void SceneState::_resolve_deferred_node_paths(const LocalVector<DeferredNodePathProperties> &p_deferred_node_paths) {
+	for (const DeferredNodePathProperties &dnp : p_deferred_node_paths) {
+		// Replace properties stored as NodePaths with actual Nodes.
+		Node *base = ObjectDB::get_instance<Node>(dnp.base);
+		ERR_CONTINUE_EDMSG(!base, vformat("Failed to set deferred property '%s' as the base node disappeared.", dnp.property));
+		if (dnp.value.get_type() == Variant::ARRAY) {
+			Array paths = dnp.value;
+
+			bool valid;
+			Array array = base->get(dnp.property, &valid);
+			ERR_CONTINUE_EDMSG(!valid, vformat("Failed to get property '%s' from node '%s'.", dnp.property, base->get_name()));
+			array = array.duplicate();
+
+			array.resize(paths.size());
+			for (int i = 0; i < array.size(); i++) {
+				array.set(i, base->get_node_or_null(paths[i]));
+			}
+			base->set(dnp.property, array);
+		} else if (dnp.value.get_type() == Variant::DICTIONARY) {
+			Dictionary paths = dnp.value;
+
+			bool valid;
+			Dictionary dict = base->get(dnp.property, &valid);
+			ERR_CONTINUE_EDMSG(!valid, vformat("Failed to get property '%s' from node '%s'.", dnp.property, base->get_name()));
+			dict = dict.duplicate();
+			bool convert_key = dict.get_typed_key_builtin() == Variant::OBJECT &&
+					ClassDB::is_parent_class(dict.get_typed_key_class_name(), "Node");
+			bool convert_value = dict.get_typed_value_builtin() == Variant::OBJECT &&
+					ClassDB::is_parent_class(dict.get_typed_value_class_name(), "Node");
+
+			for (const KeyValue<Variant, Variant> &kv : paths) {
+				Variant key = kv.key;
+				if (convert_key) {
+					key = base->get_node_or_null(key);
+				}
+				Variant value = kv.value;
+				if (convert_value) {
+					value = base->get_node_or_null(value);
+				}
+				dict[key] = value;
+			}
+			base->set(dnp.property, dict);
+		} else {
+			base->set(dnp.property, base->get_node_or_null(dnp.value));
+		}
+	}
+}
+
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
+	if (p_edit_state == GEN_EDIT_STATE_DISABLED && !Engine::get_singleton()->is_editor_hint() && _ensure_instantiation_plan()) {
+		return _instantiate_from_plan();
+	}
+
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
 
@@ -667,51 +719,7 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 		}
 	}
 
-	for (const DeferredNodePathProperties &dnp : deferred_node_paths) {
-		// Replace properties stored as NodePaths with actual Nodes.
-		Node *base = ObjectDB::get_instance<Node>(dnp.base);
-		ERR_CONTINUE_EDMSG(!base, vformat("Failed to set deferred property '%s' as the base node disappeared.", dnp.property));
-		if (dnp.value.get_type() == Variant::ARRAY) {
-			Array paths = dnp.value;
-
-			bool valid;
-			Array array = base->get(dnp.property, &valid);
-			ERR_CONTINUE_EDMSG(!valid, vformat("Failed to get property '%s' from node '%s'.", dnp.property, base->get_name()));
-			array = array.duplicate();
-
-			array.resize(paths.size());
-			for (int i = 0; i < array.size(); i++) {
-				array.set(i, base->get_node_or_null(paths[i]));
-			}
-			base->set(dnp.property, array);
-		} else if (dnp.value.get_type() == Variant::DICTIONARY) {
-			Dictionary paths = dnp.value;
-
-			bool valid;
-			Dictionary dict = base->get(dnp.property, &valid);
-			ERR_CONTINUE_EDMSG(!valid, vformat("Failed to get property '%s' from node '%s'.", dnp.property, base->get_name()));
-			dict = dict.duplicate();
-			bool convert_key = dict.get_typed_key_builtin() == Variant::OBJECT &&
-					ClassDB::is_parent_class(dict.get_typed_key_class_name(), "Node");
-			bool convert_value = dict.get_typed_value_builtin() == Variant::OBJECT &&
-					ClassDB::is_parent_class(dict.get_typed_value_class_name(), "Node");
-
-			for (const KeyValue<Variant, Variant> &kv : paths) {
-				Variant key = kv.key;
-				if (convert_key) {
-					key = base->get_node_or_null(key);
-				}
-				Variant value = kv.value;
-				if (convert_value) {
-					value = base->get_node_or_null(value);
-				}
-				dict[key] = value;
-			}
-			base->set(dnp.property, dict);
-		} else {
-			base->set(dnp.property, base->get_node_or_null(dnp.value));
-		}
-	}
+	_resolve_deferred_node_paths(deferred_node_paths);
 
 	for (KeyValue<Node *, HashMap<Ref<Resource>, Ref<Resource>>> &E : resources_local_to_scenes) {
 		for (KeyValue<Ref<Resource>, Ref<Resource>> &R : E.value) {
@@ -773,6 +781,360 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	return ret_nodes[0];
 }
 
+bool SceneState::_ensure_instantiation_plan() const {
+	MutexLock lock(plan_mutex);
+	if (!plan.built) {
+		_build_instantiation_plan();
+	}
+	return plan.usable;
+}
+
+void SceneState::_build_instantiation_plan() const {
+	plan.built = true;
+
+	int nc = nodes.size();
+	if (nc == 0 || base_scene_idx >= 0 || !editable_instances.is_empty()) {
+		return;
+	}
+
+	const int sname_count = names.size();
+	const int prop_count = variants.size();
+
+	LocalVector<InstantiationPlan::PlanNode> plan_nodes;
+	plan_nodes.resize(nc);
+
+	for (int i = 0; i < nc; i++) {
+		const NodeData &n = nodes[i];
+		InstantiationPlan::PlanNode &pn = plan_nodes[i];
+
+		// Inherited and instantiated nodes, and nodes referenced by path, need the generic path.
+		if (n.instance >= 0 || n.type == TYPE_INSTANTIATED || n.type < 0 || n.type >= sname_count || n.name < 0 || n.name >= sname_count) {
+			return;
+		}
+		if (i == 0) {
+			if (n.parent != -1) {
+				return;
+			}
+		} else if (n.parent < 0 || (n.parent & FLAG_ID_IS_PATH) || n.parent >= i) {
+			return;
+		}
+		if (n.owner >= 0 && ((n.owner & FLAG_ID_IS_PATH) || n.owner >= i)) {
+			return;
+		}
+
+		pn.type = names[n.type];
+		if (!ClassDB::is_parent_class(pn.type, SNAME("Node"))) {
+			return;
+		}
+		pn.creation_func = ClassDB::get_native_creation_func(pn.type);
+		if (!pn.creation_func) {
+			return;
+		}
+
+		pn.name = names[n.name];
+		pn.parent = n.parent;
+		pn.owner = n.owner;
+		pn.index = n.index;
+		if (i < ids.size()) {
+			pn.unique_id = ids[i];
+		}
+		if (i > 0) {
+			plan_nodes[pn.parent].child_count++;
+		}
+
+		for (const NodeData::Property &np : n.properties) {
+			if (np.value < 0 || np.value >= prop_count) {
+				return;
+			}
+
+			InstantiationPlan::Property property;
+			property.value = variants[np.value];
+
+			if (np.name & FLAG_PATH_PROPERTY_IS_NODE) {
+				int name_idx = np.name & FLAG_PROP_NAME_MASK;
+				if (name_idx >= sname_count) {
+					return;
+				}
+				property.name = names[name_idx];
+				property.is_deferred_node_path = true;
+				pn.properties.push_back(property);
+				continue;
+			}
+
+			if (np.name < 0 || np.name >= sname_count) {
+				return;
+			}
+			property.name = names[np.name];
+
+			if (property.name == CoreStringName(script)) {
+				const Ref<Script> script = property.value;
+				if (script.is_valid() && script->is_abstract()) {
+					return;
+				}
+				property.is_script = true;
+				pn.properties.push_back(property);
+				continue;
+			}
+
+			// Containers have to be duplicated and typed, and resources may have to be made local to the scene.
+			if (property.value.get_type() == Variant::ARRAY || property.value.get_type() == Variant::DICTIONARY) {
+				return;
+			}
+			if (property.value.get_type() == Variant::OBJECT) {
+				const Ref<Resource> res = property.value;
+				if (res.is_valid() && (res->is_local_to_scene() || Object::cast_to<MissingResource>(res.ptr()))) {
+					return;
+				}
+			}
+
+			ClassDB::PropertySetGet setget;
+			if (ClassDB::get_property_setget(pn.type, property.name, &setget) && setget._setptr) {
+				property.setter = setget._setptr;
+				property.getter = setget._getptr;
+				property.index = setget.index;
+			}
+			pn.properties.push_back(property);
+		}
+
+		for (int group : n.groups) {
+			if (group < 0 || group >= sname_count) {
+				return;
+			}
+			pn.groups.push_back(names[group]);
+		}
+	}
+
+	LocalVector<InstantiationPlan::Connection> plan_connections;
+	for (const ConnectionData &c : connections) {
+		if ((c.from & FLAG_ID_IS_PATH) || (c.to & FLAG_ID_IS_PATH) || c.from < 0 || c.from >= nc || c.to < 0 || c.to >= nc) {
+			return;
+		}
+		if (c.signal < 0 || c.signal >= sname_count || c.method < 0 || c.method >= sname_count) {
+			return;
+		}
+
+		InstantiationPlan::Connection pc;
+		pc.from = c.from;
+		pc.to = c.to;
+		pc.signal = names[c.signal];
+		pc.method = names[c.method];
+		pc.flags = CONNECT_PERSIST | c.flags | CONNECT_INHERITED;
+		pc.unbinds = c.unbinds;
+		for (int bind : c.binds) {
+			if (bind < 0 || bind >= prop_count) {
+				return;
+			}
+			pc.binds.push_back(variants[bind]);
+		}
+		plan_connections.push_back(pc);
+	}
+
+	plan.nodes = plan_nodes;
+	plan.connections = plan_connections;
+	plan.usable = true;
+}
+
+void SceneState::_clear_instantiation_plan() {
+	MutexLock lock(plan_mutex);
+	plan = InstantiationPlan();
+}
+
+void SceneState::_set_plan_property(Node *p_node, const InstantiationPlan::Property &p_property, const Variant &p_value) {
+	// Scripts can override how any property is set, so only call the setter directly on nodes without one.
+	if (!p_property.setter || p_node->get_script_instance()) {
+		p_node->set(p_property.name, p_value);
+		return;
+	}
+
+	Callable::CallError ce;
+	if (p_property.index >= 0) {
+		const Variant index = p_property.index;
+		const Variant *args[2] = { &index, &p_value };
+		p_property.setter->call(p_node, args, 2, ce);
+	} else {
+		const Variant *args[1] = { &p_value };
+		p_property.setter->call(p_node, args, 1, ce);
+	}
+}
+
+Node *SceneState::_instantiate_from_plan() const {
+	const int nc = plan.nodes.size();
+	Node **ret_nodes = (Node **)alloca(sizeof(Node *) * nc);
+
+	LocalVector<DeferredNodePathProperties> deferred_node_paths;
+
+	for (int i = 0; i < nc; i++) {
+		const InstantiationPlan::PlanNode &pn = plan.nodes[i];
+
+		Node *node = static_cast<Node *>(pn.creation_func(true));
+		node->set_unique_scene_id(pn.unique_id);
+
+		for (const InstantiationPlan::Property &property : pn.properties) {
+			if (property.is_deferred_node_path) {
+				DeferredNodePathProperties dnp;
+				dnp.value = property.value;
+				dnp.base = node->get_instance_id();
+				dnp.property = property.name;
+				deferred_node_paths.push_back(dnp);
+			} else if (property.is_script) {
+				node->set_script(property.value);
+			} else {
+				_set_plan_property(node, property, property.value);
+			}
+		}
+
+		for (const StringName &group : pn.groups) {
+			node->add_to_group(group, true);
+		}
+
+		if (i > 0) {
+			Node *parent = ret_nodes[pn.parent];
+			parent->_add_child_nocheck(node, pn.name);
+			if (pn.index >= 0 && pn.index < parent->get_child_count() - 1) {
+				parent->move_child(node, pn.index);
+			}
+		} else {
+			node->_set_name_nocheck(pn.name);
+		}
+
+		if (pn.owner >= 0) {
+			node->_set_owner_nocheck(ret_nodes[pn.owner]);
+			if (node->data.unique_name_in_owner) {
+				node->_acquire_unique_name_in_owner();
+			}
+		}
+
+		node->remove_meta("_edit_pinned_properties_");
+
+		ret_nodes[i] = node;
+	}
+
+	_resolve_deferred_node_paths(deferred_node_paths);
+
+	for (const InstantiationPlan::Connection &pc : plan.connections) {
+		Callable callable(ret_nodes[pc.to], pc.method);
+		if (!pc.binds.is_empty()) {
+			callable = callable.bindv(pc.binds);
+		}
+		if (pc.unbinds > 0) {
+			callable = callable.unbind(pc.unbinds);
+		}
+		ret_nodes[pc.from]->connect(pc.signal, callable, pc.flags);
+	}
+
+	return ret_nodes[0];
+}
+
+void SceneState::_build_reset_properties() const {
+	plan.reset_built = true;
+
+	for (InstantiationPlan::PlanNode &pn : plan.nodes) {
+		HashSet<StringName> handled;
+		handled.insert(CoreStringName(script));
+
+		for (const InstantiationPlan::Property &property : pn.properties) {
+			handled.insert(property.name);
+			if (!property.is_deferred_node_path && !property.is_script) {
+				pn.reset_properties.push_back(property);
+			}
+		}
+
+		// Properties not stored in the scene are restored to the class defaults.
+		List<PropertyInfo> property_list;
+		ClassDB::get_property_list(pn.type, &property_list);
+		for (const PropertyInfo &pi : property_list) {
+			if (!(pi.usage & PROPERTY_USAGE_STORAGE) || handled.has(pi.name)) {
+				continue;
+			}
+
+			ClassDB::PropertySetGet setget;
+			if (!ClassDB::get_property_setget(pn.type, pi.name, &setget) || !setget._setptr || !setget._getptr) {
+				continue;
+			}
+
+			bool valid = false;
+			InstantiationPlan::Property property;
+			property.value = ClassDB::class_get_default_property_value(pn.type, pi.name, &valid);
+			if (!valid) {
+				continue;
+			}
+			property.name = pi.name;
+			property.setter = setget._setptr;
+			property.getter = setget._getptr;
+			property.index = setget.index;
+			pn.reset_properties.push_back(property);
+		}
+	}
+}
+
+// Restores an instance of this scene to its freshly instantiated state, so it can be reused.
+// Only properties that changed are set again. Fails if the scene can't be instantiated from a plan,
+// or if the node tree of the instance no longer matches the scene.
+bool SceneState::reset_instance(Node *p_root) const {
+	ERR_FAIL_NULL_V(p_root, false);
+
+	{
+		MutexLock lock(plan_mutex);
+		if (!plan.built) {
+			_build_instantiation_plan();
+		}
+		if (!plan.usable) {
+			return false;
+		}
+		if (!plan.reset_built) {
+			_build_reset_properties();
+		}
+	}
+
+	const int nc = plan.nodes.size();
+	Node **instance_nodes = (Node **)alloca(sizeof(Node *) * nc);
+
+	for (int i = 0; i < nc; i++) {
+		const InstantiationPlan::PlanNode &pn = plan.nodes[i];
+		Node *node = i == 0 ? p_root : instance_nodes[pn.parent]->_get_child_by_name(pn.name);
+		if (!node || node->get_class_name() != pn.type || node->get_child_count(false) != pn.child_count) {
+			return false;
+		}
+		instance_nodes[i] = node;
+	}
+
+	for (int i = 0; i < nc; i++) {
+		Node *node = instance_nodes[i];
+		const bool has_script = node->get_script_instance() != nullptr;
+
+		for (const InstantiationPlan::Property &property : plan.nodes[i].reset_properties) {
+			Variant current;
+			if (property.getter && !has_script) {
+				Callable::CallError ce;
+				if (property.index >= 0) {
+					const Variant index = property.index;
+					const Variant *args[1] = { &index };
+					current = property.getter->call(node, args, 1, ce);
+				} else {
+					current = property.getter->call(node, nullptr, 0, ce);
+				}
+			} else {
+				current = node->get(property.name);
+			}
+
+			if (current == property.value) {
+				continue;
+			}
+
+			if (property.value.get_type() == Variant::ARRAY || property.value.get_type() == Variant::DICTIONARY) {
+				// Don't share the default container with the instance.
+				_set_plan_property(node, property, property.value.duplicate());
+			} else {
+				_set_plan_property(node, property, property.value);
+			}
+		}
+
+		node->request_ready();
+	}
+
+	return true;
+}
+
 Variant SceneState::make_local_resource(Variant &p_value, const SceneState::NodeData &p_node_data, HashMap<Node *, HashMap<Ref<Resource>, Ref<Resource>>> &p_resources_local_to_scenes, Node *p_node, const StringName p_sname, int p_i, Node **p_ret_nodes, SceneState::GenEditState p_edit_state) const {
 	Ref<Resource> res = p_value;
 	if (res.is_null() || !res->is_local_to_scene()) {
@@ -1508,6 +1870,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	_clear_instantiation_plan();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1750,6 +2113,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 	const Vector<int> sconns = p_dictionary["conns"];
 	ERR_FAIL_COND(sconns.size() < conn_count);
 
+	_clear_instantiation_plan();
+
 	Vector<String> snames = p_dictionary["names"];
 	if (snames.size()) {
 		int namecount = snames.size();
@@ -2386,6 +2751,7 @@ int SceneState::add_node_path(const NodePath &p_path, const PackedInt32Array &p_
 }
 
 int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int p_instance, int p_index, int32_t p_unique_id) {
+	_clear_instantiation_plan();
 	NodeData nd;
 	nd.parent = p_parent;
 	nd.owner = p_owner;
@@ -2413,15 +2779,18 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 	}
 	prop.value = p_value;
 	nodes.write[p_node].properties.push_back(prop);
+	_clear_instantiation_plan();
 }
 
 void SceneState::add_node_group(int p_node, int p_group) {
+	_clear_instantiation_plan();
 	ERR_FAIL_INDEX(p_node, nodes.size());
 	ERR_FAIL_INDEX(p_group, names.size());
 	nodes.write[p_node].groups.push_back(p_group);
 }
 
 void SceneState::set_base_scene(int p_idx) {
+	_clear_instantiation_plan();
 	ERR_FAIL_INDEX(p_idx, variants.size());
 	base_scene_idx = p_idx;
 }
@@ -2442,9 +2811,11 @@ void SceneState::add_connection(int p_from, int p_to, int p_signal, int p_method
 	c.unbinds = p_unbinds;
 	c.binds = p_binds;
 	connections.push_back(c);
+	_clear_instantiation_plan();
 }
 
 void SceneState::add_editable_instance(const NodePath &p_path) {
+	_clear_instantiation_plan();
 	editable_instances.push_back(p_path);
 }
 
@@ -2459,6 +2830,9 @@ bool SceneState::remove_group_references(const StringName &p_name) {
 			}
 		}
 	}
+	if (edited) {
+		_clear_instantiation_plan();
+	}
 	return edited;
 }
 
@@ -2473,6 +2847,9 @@ bool SceneState::rename_group_references(const StringName &p_old_name, const Str
 			}
 		}
 	}
+	if (edited) {
+		_clear_instantiation_plan();
+	}
 	return edited;
 }
 
@@ -2536,6 +2913,7 @@ SceneState::SceneState() {
 ////////////////
 
 void PackedScene::_set_bundled_scene(const Dictionary &p_scene) {
+	clear_instance_pool();
 	state->set_bundled_scene(p_scene);
 }
 
@@ -2544,10 +2922,12 @@ Dictionary PackedScene::_get_bundled_scene() const {
 }
 
 Error PackedScene::pack(Node *p_scene) {
+	clear_instance_pool();
 	return state->pack(p_scene);
 }
 
 void PackedScene::clear() {
+	clear_instance_pool();
 	state->clear();
 }
 
@@ -2582,6 +2962,15 @@ Node *PackedScene::instantiate(GenEditState p_edit_state) const {
 	ERR_FAIL_COND_V_MSG(p_edit_state != GEN_EDIT_STATE_DISABLED, nullptr, "Edit state is only for editors, does not work without tools compiled.");
 #endif
 
+	if (p_edit_state == GEN_EDIT_STATE_DISABLED) {
+		MutexLock lock(instance_pool_mutex);
+		if (!instance_pool.is_empty()) {
+			Node *pooled = instance_pool[instance_pool.size() - 1];
+			instance_pool.resize(instance_pool.size() - 1);
+			return pooled;
+		}
+	}
+
 	Node *s = state->instantiate((SceneState::GenEditState)p_edit_state);
 	if (!s) {
 		return nullptr;
@@ -2600,7 +2989,75 @@ Node *PackedScene::instantiate(GenEditState p_edit_state) const {
 	return s;
 }
 
+void PackedScene::set_instance_pool_size(int p_size) {
+	ERR_FAIL_COND(p_size < 0);
+
+	LocalVector<Node *> excess;
+	{
+		MutexLock lock(instance_pool_mutex);
+		instance_pool_size = p_size;
+		while ((int)instance_pool.size() > instance_pool_size) {
+			excess.push_back(instance_pool[instance_pool.size() - 1]);
+			instance_pool.resize(instance_pool.size() - 1);
+		}
+	}
+
+	for (Node *node : excess) {
+		memdelete(node);
+	}
+}
+
+int PackedScene::get_instance_pool_size() const {
+	MutexLock lock(instance_pool_mutex);
+	return instance_pool_size;
+}
+
+int PackedScene::get_pooled_instance_count() const {
+	MutexLock lock(instance_pool_mutex);
+	return instance_pool.size();
+}
+
+bool PackedScene::recycle_instance(Node *p_node) {
+	ERR_FAIL_NULL_V(p_node, false);
+	ERR_FAIL_COND_V_MSG(p_node->get_parent(), false, "Can't recycle a scene instance that still has a parent. Remove it from its parent first.");
+	ERR_FAIL_COND_V_MSG(p_node->is_queued_for_deletion(), false, "Can't recycle a scene instance that is queued for deletion.");
+	ERR_FAIL_COND_V_MSG(!is_built_in() && p_node->get_scene_file_path() != get_path(), false, vformat("Node \"%s\" is not an instance of this scene.", p_node->get_name()));
+
+	bool has_room;
+	{
+		MutexLock lock(instance_pool_mutex);
+		ERR_FAIL_COND_V_MSG(instance_pool.has(p_node), false, "Scene instance was already recycled.");
+		has_room = (int)instance_pool.size() < instance_pool_size;
+	}
+
+	// Properties are reset without holding the lock, as setters may run script code.
+	if (has_room && state->reset_instance(p_node)) {
+		MutexLock lock(instance_pool_mutex);
+		if ((int)instance_pool.size() < instance_pool_size) {
+			instance_pool.push_back(p_node);
+			return true;
+		}
+	}
+
+	memdelete(p_node);
+	return false;
+}
+
+void PackedScene::clear_instance_pool() {
+	LocalVector<Node *> pooled;
+	{
+		MutexLock lock(instance_pool_mutex);
+		pooled = instance_pool;
+		instance_pool.clear();
+	}
+
+	for (Node *node : pooled) {
+		memdelete(node);
+	}
+}
+
 void PackedScene::replace_state(Ref<SceneState> p_by) {
+	clear_instance_pool();
 	state = p_by;
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -2609,6 +3066,7 @@ void PackedScene::replace_state(Ref<SceneState> p_by) {
 }
 
 void PackedScene::recreate_state() {
+	clear_instance_pool();
 	state.instantiate();
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -2687,6 +3145,11 @@ void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pack", "path"), &PackedScene::pack);
 	ClassDB::bind_method(D_METHOD("instantiate", "edit_state"), &PackedScene::instantiate, DEFVAL(GEN_EDIT_STATE_DISABLED));
 	ClassDB::bind_method(D_METHOD("can_instantiate"), &PackedScene::can_instantiate);
+	ClassDB::bind_method(D_METHOD("set_instance_pool_size", "size"), &PackedScene::set_instance_pool_size);
+	ClassDB::bind_method(D_METHOD("get_instance_pool_size"), &PackedScene::get_instance_pool_size);
+	ClassDB::bind_method(D_METHOD("get_pooled_instance_count"), &PackedScene::get_pooled_instance_count);
+	ClassDB::bind_method(D_METHOD("recycle_instance", "node"), &PackedScene::recycle_instance);
+	ClassDB::bind_method(D_METHOD("clear_instance_pool"), &PackedScene::clear_instance_pool);
 	ClassDB::bind_method(D_METHOD("_set_bundled_scene", "scene"), &PackedScene::_set_bundled_scene);
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
 	ClassDB::bind_method(D_METHOD("get_state"), &PackedScene::get_state);
@@ -2702,3 +3165,7 @@ void PackedScene::_bind_methods() {
 PackedScene::PackedScene() {
 	state.instantiate();
 }
+
+PackedScene::~PackedScene() {
+	clear_instance_pool();
+}
@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/io/resource.h"
+#include "core/object/class_db.h"
 #include "scene/main/node.h"
 
 class PackedScene;
@@ -92,6 +93,62 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// Scenes without inheritance, sub-scene instances or node paths are instantiated from a plan with
+	// pre-resolved constructors, setters and node indices, built on the first instantiation at runtime.
+	struct InstantiationPlan {
+		struct Property {
+			StringName name;
+			Variant value;
+			MethodBind *setter = nullptr; // Null if the property has to be set through Object::set().
+			MethodBind *getter = nullptr;
+			int index = -1;
+			bool is_script = false;
+			bool is_deferred_node_path = false;
+		};
+
+		struct PlanNode {
+			ClassDB::CreationFunc creation_func = nullptr;
+			StringName type;
+			StringName name;
+			int parent = -1;
+			int owner = -1;
+			int index = -1;
+			int child_count = 0;
+			int32_t unique_id = Node::UNIQUE_SCENE_ID_UNASSIGNED;
+			LocalVector<Property> properties;
+			LocalVector<StringName> groups;
+			// Stored and default property values restored when recycling instances, see reset_instance().
+			LocalVector<Property> reset_properties;
+		};
+
+		struct Connection {
+			int from = 0;
+			int to = 0;
+			StringName signal;
+			StringName method;
+			uint32_t flags = 0;
+			int unbinds = 0;
+			Array binds;
+		};
+
+		LocalVector<PlanNode> nodes;
+		LocalVector<Connection> connections;
+		bool built = false;
+		bool usable = false;
+		bool reset_built = false;
+	};
+
+	mutable InstantiationPlan plan;
+	mutable Mutex plan_mutex;
+
+	bool _ensure_instantiation_plan() const;
+	void _build_instantiation_plan() const;
+	void _build_reset_properties() const;
+	void _clear_instantiation_plan();
+	Node *_instantiate_from_plan() const;
+	static void _set_plan_property(Node *p_node, const InstantiationPlan::Property &p_property, const Variant &p_value);
+	static void _resolve_deferred_node_paths(const LocalVector<DeferredNodePathProperties> &p_deferred_node_paths);
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map, HashSet<int32_t> &ids_saved);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -163,6 +220,7 @@ public:
 
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state) const;
+	bool reset_instance(Node *p_root) const;
 
 	Array setup_resources_in_array(Array &array_to_scan, const SceneState::NodeData &n, HashMap<Node *, HashMap<Ref<Resource>, Ref<Resource>>> &p_resources_local_to_scenes, Node *node, const StringName sname, int i, Node **ret_nodes, SceneState::GenEditState p_edit_state) const;
 	Dictionary setup_resources_in_dictionary(Dictionary &p_dictionary_to_scan, const SceneState::NodeData &p_n, HashMap<Node *, HashMap<Ref<Resource>, Ref<Resource>>> &p_resources_local_to_scenes, Node *p_node, const StringName p_sname, int p_i, Node **p_ret_nodes, SceneState::GenEditState p_edit_state) const;
@@ -251,6 +309,10 @@ class PackedScene : public Resource {
 
 	Ref<SceneState> state;
 
+	int instance_pool_size = 0;
+	mutable Mutex instance_pool_mutex;
+	mutable LocalVector<Node *> instance_pool;
+
 	void _set_bundled_scene(const Dictionary &p_scene);
 	Dictionary _get_bundled_scene() const;
 
@@ -274,6 +336,12 @@ public:
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
 
+	void set_instance_pool_size(int p_size);
+	int get_instance_pool_size() const;
+	int get_pooled_instance_count() const;
+	bool recycle_instance(Node *p_node);
+	void clear_instance_pool();
+
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
 
@@ -293,6 +361,7 @@ public:
 	Ref<SceneState> get_state() const;
 
 	PackedScene();
+	~PackedScene();
 };
 
 VARIANT_ENUM_CAST(PackedScene::GenEditState)
@@ -693,6 +693,7 @@ Error ResourceLoaderText::load() {
 
 					if (set_valid) {
 						res->set(assign, value);
+						res->add_loaded_property(value);
 					}
 				}
 				//it's assignment
@@ -834,6 +835,7 @@ Error ResourceLoaderText::load() {
 
 				if (set_valid) {
 					resource->set(assign, value);
+					resource->add_loaded_property(value);
 				}
 				//it's assignment
 			} else if (!next_tag.name.is_empty()) {
@@ -1676,6 +1678,7 @@ void ResourceFormatSaverTextInstance::_find_resources(const Variant &p_variant,
 			}
 
 			resource_set.insert(res);
+			res->materialize(); // Lazily loaded resources must be saved with their data.
 
 			List<PropertyInfo> property_list;
 
@@ -40,6 +40,20 @@ Ref<Image> Texture2D::get_image() const {
 	return ret;
 }
 
+uint64_t Texture2D::get_memory_usage_estimate() const {
+	// Computed from the dimensions, as fetching the image back from the rendering server is expensive.
+	const int width = get_width();
+	const int height = get_height();
+	if (width <= 0 || height <= 0) {
+		return Texture::get_memory_usage_estimate();
+	}
+	Image::Format format = get_format();
+	if (format == Image::FORMAT_MAX) {
+		format = Image::FORMAT_RGBA8; // Unknown, assume the most common one.
+	}
+	return sizeof(Texture2D) + Image::get_image_data_size(width, height, format, has_mipmaps());
+}
+
 Image::Format Texture2D::get_format() const {
 	Image::Format ret = Image::FORMAT_MAX;
 	GDVIRTUAL_CALL(_get_format, ret);
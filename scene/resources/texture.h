@@ -77,6 +77,7 @@ public:
 	virtual bool get_rect_region(const Rect2 &p_rect, const Rect2 &p_src_rect, Rect2 &r_rect, Rect2 &r_src_rect) const;
 
 	virtual Ref<Image> get_image() const;
+	virtual uint64_t get_memory_usage_estimate() const override;
 
 	virtual Ref<Resource> create_placeholder() const;
 
@@ -189,6 +189,156 @@ void RendererCanvasCull::_mark_ysort_dirty(RendererCanvasCull::Item *ysort_owner
 	} while (ysort_owner && ysort_owner->sort_y);
 }
 
+bool RendererCanvasCull::_is_item_spatially_indexable(const Item *p_item) const {
+	// Only leaves whose bounds are known without culling them can be skipped by the index. Everything that
+	// draws outside of its rect, or needs to be visited every frame, is always culled the regular way.
+	if (!p_item->child_items.is_empty() || p_item->vp_render || p_item->copy_back_buffer || p_item->use_identity_transform || p_item->repeat_source || p_item->update_when_visible || p_item->skeleton.is_valid() || p_item->canvas_group) {
+		return false;
+	}
+	return !(_interpolation_data.interpolation_enabled && p_item->interpolated && p_item->on_interpolate_transform_list);
+}
+
+void RendererCanvasCull::_item_spatial_changed(Item *p_item) {
+	if (p_item->parent_spatial_index && !p_item->spatial_update_item.in_list()) {
+		_spatial_update_list.add(&p_item->spatial_update_item);
+	}
+}
+
+void RendererCanvasCull::_update_item_spatial_bounds(Item *p_item) {
+	ChildSpatialIndex *index = p_item->parent_spatial_index;
+
+	if (!_is_item_spatially_indexable(p_item)) {
+		if (p_item->spatial_index_id.is_valid()) {
+			index->bvh.remove(p_item->spatial_index_id);
+			p_item->spatial_index_id = DynamicBVH::ID();
+			index->unindexed.push_back(p_item);
+		}
+		return;
+	}
+
+	Rect2 rect = p_item->get_rect();
+	if (p_item->visibility_notifier && p_item->visibility_notifier->area.size != Vector2()) {
+		rect = rect.merge(p_item->visibility_notifier->area);
+	}
+	// Grow by a pixel to account for the transform snapping done when culling.
+	rect = p_item->xform_curr.xform(rect).grow(1);
+	const AABB bounds(Vector3(rect.position.x, rect.position.y, 0), Vector3(rect.size.x, rect.size.y, 0));
+
+	if (p_item->spatial_index_id.is_valid()) {
+		index->bvh.update(p_item->spatial_index_id, bounds);
+	} else {
+		index->unindexed.erase_unordered(p_item);
+		p_item->spatial_index_id = index->bvh.insert(bounds, p_item);
+	}
+}
+
+void RendererCanvasCull::_update_spatial_indices() {
+	while (_spatial_update_list.first()) {
+		Item *item = _spatial_update_list.first()->self();
+		_spatial_update_list.remove(&item->spatial_update_item);
+		if (item->parent_spatial_index) {
+			_update_item_spatial_bounds(item);
+		}
+	}
+}
+
+void RendererCanvasCull::_spatial_index_add_child(ChildSpatialIndex *p_index, Item *p_child) {
+	p_child->parent_spatial_index = p_index;
+	p_child->spatial_index_id = DynamicBVH::ID();
+	p_index->unindexed.push_back(p_child);
+	_update_item_spatial_bounds(p_child);
+}
+
+void RendererCanvasCull::_spatial_index_remove_child(Item *p_child) {
+	ChildSpatialIndex *index = p_child->parent_spatial_index;
+	if (!index) {
+		return;
+	}
+
+	if (p_child->spatial_index_id.is_valid()) {
+		index->bvh.remove(p_child->spatial_index_id);
+	} else {
+		index->unindexed.erase_unordered(p_child);
+	}
+	p_child->parent_spatial_index = nullptr;
+	p_child->spatial_index_id = DynamicBVH::ID();
+	if (p_child->spatial_update_item.in_list()) {
+		_spatial_update_list.remove(&p_child->spatial_update_item);
+	}
+}
+
+bool RendererCanvasCull::_update_item_child_spatial_index(Item *p_item) {
+	int child_count = p_item->child_items.size();
+
+	if (!p_item->spatial_index) {
+		if (spatial_index_min_children <= 0 || child_count < spatial_index_min_children) {
+			return false;
+		}
+		p_item->spatial_index = memnew(ChildSpatialIndex);
+		for (Item *child : p_item->child_items) {
+			_spatial_index_add_child(p_item->spatial_index, child);
+		}
+	} else if (spatial_index_min_children <= 0 || child_count < spatial_index_min_children / 2) {
+		// Keep some hysteresis so items hovering around the threshold don't rebuild the index every frame.
+		for (Item *child : p_item->child_items) {
+			_spatial_index_remove_child(child);
+		}
+		memdelete(p_item->spatial_index);
+		p_item->spatial_index = nullptr;
+		return false;
+	}
+
+	return true;
+}
+
+bool RendererCanvasCull::_update_canvas_child_spatial_index(Canvas *p_canvas) {
+	int child_count = p_canvas->child_items.size();
+
+	if (!p_canvas->spatial_index) {
+		if (spatial_index_min_children <= 0 || child_count < spatial_index_min_children) {
+			return false;
+		}
+		p_canvas->spatial_index = memnew(ChildSpatialIndex);
+		for (const Canvas::ChildItem &child : p_canvas->child_items) {
+			_spatial_index_add_child(p_canvas->spatial_index, child.item);
+		}
+	} else if (spatial_index_min_children <= 0 || child_count < spatial_index_min_children / 2) {
+		for (const Canvas::ChildItem &child : p_canvas->child_items) {
+			_spatial_index_remove_child(child.item);
+		}
+		memdelete(p_canvas->spatial_index);
+		p_canvas->spatial_index = nullptr;
+		return false;
+	}
+
+	return true;
+}
+
+void RendererCanvasCull::_cull_spatial_index(ChildSpatialIndex *p_index, const Transform2D &p_xform, const Rect2 &p_clip_rect, LocalVector<Item *> &r_children) const {
+	struct CullRect {
+		LocalVector<Item *> *children = nullptr;
+		_FORCE_INLINE_ bool operator()(void *p_data) {
+			children->push_back((Item *)p_data);
+			return false;
+		}
+	};
+
+	// `_cull_canvas_item()` offsets the global rect of each item by the clip rect position before testing it
+	// against the clip rect, so in the space of the transforms, the visible area is the clip rect moved to the origin.
+	const Rect2 visible_rect(Point2(), p_clip_rect.size);
+
+	// Bring it into the space of the children, with a margin for pixel snapping.
+	const Rect2 rect = p_xform.affine_inverse().xform(visible_rect.grow(2));
+
+	r_children = p_index->unindexed;
+	CullRect cull_rect;
+	cull_rect.children = &r_children;
+	p_index->bvh.aabb_query(AABB(Vector3(rect.position.x, rect.position.y, -1), Vector3(rect.size.x, rect.size.y, 2)), cull_rect);
+
+	// Keep the draw order of the children.
+	r_children.sort_custom<ItemIndexSort>();
+}
+
 void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *ci, RendererCanvasCull::Item *p_canvas_clip, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list, const Transform2D &p_transform, const Rect2 &p_clip_rect, Rect2 p_global_rect, const Color &p_modulate, int p_z, RendererCanvasCull::Item *p_material_owner, bool p_use_canvas_group, RendererCanvasRender::Item *r_canvas_group_from) {
 	if (ci->copy_back_buffer) {
 		ci->copy_back_buffer->screen_rect = p_transform.xform(ci->copy_back_buffer->rect).intersection(p_clip_rect);
@@ -476,6 +626,14 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 			canvas_group_from = r_z_last_list[zidx];
 		}
 
+		// Canvas groups and repeats draw children outside of their own bounds, so they can't use the index.
+		LocalVector<Item *> visible_children;
+		if (!use_canvas_group && !(repeat_source_item && (repeat_size.x || repeat_size.y)) && final_xform.determinant() != 0 && _update_item_child_spatial_index(ci)) {
+			_cull_spatial_index(ci->spatial_index, final_xform, p_clip_rect, visible_children);
+			child_items = visible_children.ptr();
+			child_item_count = visible_children.size();
+		}
+
 		for (int i = 0; i < child_item_count; i++) {
 			if (!child_items[i]->behind && !use_canvas_group) {
 				continue;
@@ -501,9 +659,23 @@ void RendererCanvasCull::render_canvas(RID p_render_target, Canvas *p_canvas, co
 		p_canvas->children_order_dirty = false;
 	}
 
+	_update_spatial_indices();
+
 	int l = p_canvas->child_items.size();
 	Canvas::ChildItem *ci = p_canvas->child_items.ptrw();
 
+	LocalVector<Canvas::ChildItem> visible_items;
+	if (p_transform.determinant() != 0 && _update_canvas_child_spatial_index(p_canvas)) {
+		LocalVector<Item *> children;
+		_cull_spatial_index(p_canvas->spatial_index, p_transform, p_clip_rect, children);
+		visible_items.resize(children.size());
+		for (uint32_t i = 0; i < children.size(); i++) {
+			visible_items[i].item = children[i];
+		}
+		ci = visible_items.ptr();
+		l = visible_items.size();
+	}
+
 	_render_canvas_item_tree(p_render_target, ci, l, p_transform, p_clip_rect, p_canvas->modulate, p_lights, p_directional_lights, p_default_filter, p_default_repeat, p_snap_2d_vertices_to_pixel, canvas_cull_mask, r_render_info);
 }
 
@@ -511,6 +683,14 @@ bool RendererCanvasCull::was_sdf_used() {
 	return sdf_used;
 }
 
+void RendererCanvasCull::set_spatial_index_min_children(int p_count) {
+	spatial_index_min_children = MAX(p_count, 0);
+}
+
+int RendererCanvasCull::get_spatial_index_min_children() const {
+	return spatial_index_min_children;
+}
+
 RID RendererCanvasCull::canvas_allocate() {
 	return canvas_owner.allocate_rid();
 }
@@ -523,6 +703,7 @@ void RendererCanvasCull::canvas_set_item_mirroring(RID p_canvas, RID p_item, con
 	ERR_FAIL_NULL(canvas);
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 
 	int idx = canvas->find_item(canvas_item);
 	ERR_FAIL_COND(idx == -1);
@@ -538,6 +719,7 @@ void RendererCanvasCull::canvas_set_item_repeat(RID p_item, const Point2 &p_repe
 	ERR_FAIL_COND(p_repeat_times < 0);
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 
 	bool is_repeat_source = (p_repeat_size.x || p_repeat_size.y) && p_repeat_times;
 	canvas_item->repeat_source = is_repeat_source;
@@ -578,12 +760,15 @@ void RendererCanvasCull::canvas_item_set_parent(RID p_item, RID p_parent) {
 	ERR_FAIL_NULL(canvas_item);
 
 	if (canvas_item->parent.is_valid()) {
+		_spatial_index_remove_child(canvas_item);
+
 		if (canvas_owner.owns(canvas_item->parent)) {
 			Canvas *canvas = canvas_owner.get_or_null(canvas_item->parent);
 			canvas->erase_item(canvas_item);
 		} else if (canvas_item_owner.owns(canvas_item->parent)) {
 			Item *item_owner = canvas_item_owner.get_or_null(canvas_item->parent);
 			item_owner->child_items.erase(canvas_item);
+			_item_spatial_changed(item_owner);
 
 			if (item_owner->sort_y) {
 				_mark_ysort_dirty(item_owner);
@@ -600,10 +785,19 @@ void RendererCanvasCull::canvas_item_set_parent(RID p_item, RID p_parent) {
 			ci.item = canvas_item;
 			canvas->child_items.push_back(ci);
 			canvas->children_order_dirty = true;
+
+			if (canvas->spatial_index) {
+				_spatial_index_add_child(canvas->spatial_index, canvas_item);
+			}
 		} else if (canvas_item_owner.owns(p_parent)) {
 			Item *item_owner = canvas_item_owner.get_or_null(p_parent);
 			item_owner->child_items.push_back(canvas_item);
 			item_owner->children_order_dirty = true;
+			_item_spatial_changed(item_owner);
+
+			if (item_owner->spatial_index) {
+				_spatial_index_add_child(item_owner->spatial_index, canvas_item);
+			}
 
 			if (item_owner->sort_y) {
 				_mark_ysort_dirty(item_owner);
@@ -636,6 +830,7 @@ void RendererCanvasCull::canvas_item_set_light_mask(RID p_item, int p_mask) {
 void RendererCanvasCull::canvas_item_set_transform(RID p_item, const Transform2D &p_transform) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 
 	if (_interpolation_data.interpolation_enabled && canvas_item->interpolated) {
 		if (!canvas_item->on_interpolate_transform_list) {
@@ -681,6 +876,7 @@ void RendererCanvasCull::canvas_item_set_distance_field_mode(RID p_item, bool p_
 void RendererCanvasCull::canvas_item_set_custom_rect(RID p_item, bool p_custom_rect, const Rect2 &p_rect) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 
 	canvas_item->custom_rect = p_custom_rect;
 	canvas_item->rect = p_rect;
@@ -710,6 +906,7 @@ void RendererCanvasCull::canvas_item_set_draw_behind_parent(RID p_item, bool p_e
 void RendererCanvasCull::canvas_item_set_use_identity_transform(RID p_item, bool p_enable) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 
 	canvas_item->use_identity_transform = p_enable;
 }
@@ -717,6 +914,7 @@ void RendererCanvasCull::canvas_item_set_use_identity_transform(RID p_item, bool
 void RendererCanvasCull::canvas_item_set_update_when_visible(RID p_item, bool p_update) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 
 	canvas_item->update_when_visible = p_update;
 }
@@ -747,6 +945,7 @@ float RendererCanvasCull::canvas_item_get_compensated_antialiasing_width(float p
 void RendererCanvasCull::canvas_item_add_line(RID p_item, const Point2 &p_from, const Point2 &p_to, const Color &p_color, float p_width, bool p_antialiased) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 
 	Item::CommandPrimitive *line = canvas_item->alloc_command<Item::CommandPrimitive>();
 	ERR_FAIL_NULL(line);
@@ -981,6 +1180,7 @@ void RendererCanvasCull::canvas_item_add_polyline(RID p_item, const Vector<Point
 	ERR_FAIL_COND(p_points.size() < 2);
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 
 	Color color = Color(1, 1, 1, 1);
 
@@ -1258,6 +1458,7 @@ void RendererCanvasCull::canvas_item_add_multiline(RID p_item, const Vector<Poin
 		}
 		Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 		ERR_FAIL_NULL(canvas_item);
+		_item_spatial_changed(canvas_item);
 
 		Vector<Color> colors;
 		if (p_colors.size() == 1) {
@@ -1300,6 +1501,7 @@ void RendererCanvasCull::canvas_item_add_multiline(RID p_item, const Vector<Poin
 void RendererCanvasCull::canvas_item_add_rect(RID p_item, const Rect2 &p_rect, const Color &p_color, bool p_antialiased) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 
 	// Adjust the rectangle size to account for the antialiasing width.
 	const Rect2 &rect_adjusted = p_antialiased ? p_rect.grow(-FEATHER_SIZE * 0.25f) : p_rect;
@@ -1467,6 +1669,7 @@ void RendererCanvasCull::canvas_item_add_rect(RID p_item, const Rect2 &p_rect, c
 void RendererCanvasCull::canvas_item_add_ellipse(RID p_item, const Point2 &p_pos, float p_major, float p_minor, const Color &p_color, bool p_antialiased) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 
 	static const int ellipse_segments = 64;
 
@@ -1570,6 +1773,7 @@ void RendererCanvasCull::canvas_item_add_circle(RID p_item, const Point2 &p_pos,
 void RendererCanvasCull::canvas_item_add_texture_rect(RID p_item, const Rect2 &p_rect, RID p_texture, bool p_tile, const Color &p_modulate, bool p_transpose) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1601,6 +1805,7 @@ void RendererCanvasCull::canvas_item_add_texture_rect(RID p_item, const Rect2 &p
 void RendererCanvasCull::canvas_item_add_msdf_texture_rect_region(RID p_item, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate, int p_outline_size, float p_px_range, float p_scale) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1635,6 +1840,7 @@ void RendererCanvasCull::canvas_item_add_msdf_texture_rect_region(RID p_item, co
 void RendererCanvasCull::canvas_item_add_lcd_texture_rect_region(RID p_item, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1667,6 +1873,7 @@ void RendererCanvasCull::canvas_item_add_lcd_texture_rect_region(RID p_item, con
 void RendererCanvasCull::canvas_item_add_texture_rect_region(RID p_item, const Rect2 &p_rect, RID p_texture, const Rect2 &p_src_rect, const Color &p_modulate, bool p_transpose, bool p_clip_uv) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 
 	Item::CommandRect *rect = canvas_item->alloc_command<Item::CommandRect>();
 	ERR_FAIL_NULL(rect);
@@ -1708,6 +1915,7 @@ void RendererCanvasCull::canvas_item_add_texture_rect_region(RID p_item, const R
 void RendererCanvasCull::canvas_item_add_nine_patch(RID p_item, const Rect2 &p_rect, const Rect2 &p_source, RID p_texture, const Vector2 &p_topleft, const Vector2 &p_bottomright, RSE::NinePatchAxisMode p_x_axis_mode, RSE::NinePatchAxisMode p_y_axis_mode, bool p_draw_center, const Color &p_modulate) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 
 	Item::CommandNinePatch *style = canvas_item->alloc_command<Item::CommandNinePatch>();
 	ERR_FAIL_NULL(style);
@@ -1732,6 +1940,7 @@ void RendererCanvasCull::canvas_item_add_primitive(RID p_item, const Vector<Poin
 
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 
 	Item::CommandPrimitive *prim = canvas_item->alloc_command<Item::CommandPrimitive>();
 	ERR_FAIL_NULL(prim);
@@ -1758,6 +1967,7 @@ void RendererCanvasCull::canvas_item_add_primitive(RID p_item, const Vector<Poin
 void RendererCanvasCull::canvas_item_add_polygon(RID p_item, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs, RID p_texture) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 #ifdef DEBUG_ENABLED
 	int pointcount = p_points.size();
 	ERR_FAIL_COND(pointcount < 3);
@@ -1779,6 +1989,7 @@ void RendererCanvasCull::canvas_item_add_polygon(RID p_item, const Vector<Point2
 void RendererCanvasCull::canvas_item_add_triangle_array(RID p_item, const Vector<int> &p_indices, const Vector<Point2> &p_points, const Vector<Color> &p_colors, const Vector<Point2> &p_uvs, const Vector<int> &p_bones, const Vector<float> &p_weights, RID p_texture, int p_count) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 
 	int vertex_count = p_points.size();
 	ERR_FAIL_COND(vertex_count == 0);
@@ -1800,6 +2011,7 @@ void RendererCanvasCull::canvas_item_add_triangle_array(RID p_item, const Vector
 void RendererCanvasCull::canvas_item_add_set_transform(RID p_item, const Transform2D &p_transform) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 
 	Item::CommandTransform *tr = canvas_item->alloc_command<Item::CommandTransform>();
 	ERR_FAIL_NULL(tr);
@@ -1809,6 +2021,7 @@ void RendererCanvasCull::canvas_item_add_set_transform(RID p_item, const Transfo
 void RendererCanvasCull::canvas_item_add_mesh(RID p_item, const RID &p_mesh, const Transform2D &p_transform, const Color &p_modulate, RID p_texture) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 	ERR_FAIL_COND(!p_mesh.is_valid());
 
 	Item::CommandMesh *m = canvas_item->alloc_command<Item::CommandMesh>();
@@ -1828,6 +2041,7 @@ void RendererCanvasCull::canvas_item_add_mesh(RID p_item, const RID &p_mesh, con
 void RendererCanvasCull::canvas_item_add_particles(RID p_item, RID p_particles, RID p_texture) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 
 	Item::CommandParticles *part = canvas_item->alloc_command<Item::CommandParticles>();
 	ERR_FAIL_NULL(part);
@@ -1842,6 +2056,7 @@ void RendererCanvasCull::canvas_item_add_particles(RID p_item, RID p_particles,
 void RendererCanvasCull::canvas_item_add_multimesh(RID p_item, RID p_mesh, RID p_texture) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 
 	Item::CommandMultiMesh *mm = canvas_item->alloc_command<Item::CommandMultiMesh>();
 	ERR_FAIL_NULL(mm);
@@ -1853,6 +2068,7 @@ void RendererCanvasCull::canvas_item_add_multimesh(RID p_item, RID p_mesh, RID p
 void RendererCanvasCull::canvas_item_add_clip_ignore(RID p_item, bool p_ignore) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 
 	Item::CommandClipIgnore *ci = canvas_item->alloc_command<Item::CommandClipIgnore>();
 	ERR_FAIL_NULL(ci);
@@ -1862,6 +2078,7 @@ void RendererCanvasCull::canvas_item_add_clip_ignore(RID p_item, bool p_ignore)
 void RendererCanvasCull::canvas_item_add_animation_slice(RID p_item, double p_animation_length, double p_slice_begin, double p_slice_end, double p_offset) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 
 	Item::CommandAnimationSlice *as = canvas_item->alloc_command<Item::CommandAnimationSlice>();
 	ERR_FAIL_NULL(as);
@@ -1899,6 +2116,7 @@ void RendererCanvasCull::canvas_item_set_z_as_relative_to_parent(RID p_item, boo
 void RendererCanvasCull::canvas_item_attach_skeleton(RID p_item, RID p_skeleton) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 	if (canvas_item->skeleton == p_skeleton) {
 		return;
 	}
@@ -1928,6 +2146,7 @@ void RendererCanvasCull::canvas_item_attach_skeleton(RID p_item, RID p_skeleton)
 void RendererCanvasCull::canvas_item_set_copy_to_backbuffer(RID p_item, bool p_enable, const Rect2 &p_rect) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 	if (p_enable && (canvas_item->copy_back_buffer == nullptr)) {
 		canvas_item->copy_back_buffer = memnew(RendererCanvasRender::Item::CopyBackBuffer);
 	}
@@ -1945,6 +2164,7 @@ void RendererCanvasCull::canvas_item_set_copy_to_backbuffer(RID p_item, bool p_e
 void RendererCanvasCull::canvas_item_clear(RID p_item) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 
 	canvas_item->clear();
 
@@ -2023,6 +2243,7 @@ void RendererCanvasCull::canvas_item_get_instance_shader_parameter_list(RID p_it
 void RendererCanvasCull::canvas_item_set_visibility_notifier(RID p_item, bool p_enable, const Rect2 &p_area, const Callable &p_enter_callable, const Callable &p_exit_callable) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 
 	if (p_enable) {
 		if (!canvas_item->visibility_notifier) {
@@ -2052,12 +2273,14 @@ bool RendererCanvasCull::canvas_item_get_debug_redraw() const {
 void RendererCanvasCull::canvas_item_set_interpolated(RID p_item, bool p_interpolated) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 	canvas_item->interpolated = p_interpolated;
 }
 
 void RendererCanvasCull::canvas_item_reset_physics_interpolation(RID p_item) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 	canvas_item->xform_prev = canvas_item->xform_curr;
 }
 
@@ -2065,6 +2288,7 @@ void RendererCanvasCull::canvas_item_reset_physics_interpolation(RID p_item) {
 void RendererCanvasCull::canvas_item_transform_physics_interpolation(RID p_item, const Transform2D &p_transform) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 	canvas_item->xform_prev = p_transform * canvas_item->xform_prev;
 	canvas_item->xform_curr = p_transform * canvas_item->xform_curr;
 }
@@ -2072,6 +2296,7 @@ void RendererCanvasCull::canvas_item_transform_physics_interpolation(RID p_item,
 void RendererCanvasCull::canvas_item_set_canvas_group_mode(RID p_item, RSE::CanvasGroupMode p_mode, float p_clear_margin, bool p_fit_empty, float p_fit_margin, bool p_blur_mipmaps) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
+	_item_spatial_changed(canvas_item);
 
 	if (p_mode == RSE::CANVAS_GROUP_MODE_DISABLED) {
 		if (canvas_item->canvas_group != nullptr) {
@@ -2621,9 +2846,15 @@ bool RendererCanvasCull::free(RID p_rid) {
 		}
 
 		for (int i = 0; i < canvas->child_items.size(); i++) {
+			_spatial_index_remove_child(canvas->child_items[i].item);
 			canvas->child_items[i].item->parent = RID();
 		}
 
+		if (canvas->spatial_index) {
+			memdelete(canvas->spatial_index);
+			canvas->spatial_index = nullptr;
+		}
+
 		for (RendererCanvasRender::Light *E : canvas->lights) {
 			E->canvas = RID();
 		}
@@ -2640,12 +2871,15 @@ bool RendererCanvasCull::free(RID p_rid) {
 		_interpolation_data.notify_free_canvas_item(p_rid, *canvas_item);
 
 		if (canvas_item->parent.is_valid()) {
+			_spatial_index_remove_child(canvas_item);
+
 			if (canvas_owner.owns(canvas_item->parent)) {
 				Canvas *canvas = canvas_owner.get_or_null(canvas_item->parent);
 				canvas->erase_item(canvas_item);
 			} else if (canvas_item_owner.owns(canvas_item->parent)) {
 				Item *item_owner = canvas_item_owner.get_or_null(canvas_item->parent);
 				item_owner->child_items.erase(canvas_item);
+				_item_spatial_changed(item_owner);
 
 				if (item_owner->sort_y) {
 					_mark_ysort_dirty(item_owner);
@@ -2654,9 +2888,15 @@ bool RendererCanvasCull::free(RID p_rid) {
 		}
 
 		for (int i = 0; i < canvas_item->child_items.size(); i++) {
+			_spatial_index_remove_child(canvas_item->child_items[i]);
 			canvas_item->child_items[i]->parent = RID();
 		}
 
+		if (canvas_item->spatial_index) {
+			memdelete(canvas_item->spatial_index);
+			canvas_item->spatial_index = nullptr;
+		}
+
 		if (canvas_item->visibility_notifier != nullptr) {
 			visibility_notifier_allocator.free(canvas_item->visibility_notifier);
 		}
@@ -2780,6 +3020,14 @@ void RendererCanvasCull::update_interpolation_tick(bool p_process) {
 	SWAP(_interpolation_data.m_list_curr, _interpolation_data.m_list_prev); \
 	_interpolation_data.m_list_curr->clear();
 
+	// Items that stopped being interpolated have static bounds again, so they can go back into the spatial index.
+	for (const RID &rid : *_interpolation_data.canvas_item_transform_update_list_prev) {
+		Item *item = canvas_item_owner.get_or_null(rid);
+		if (item && !item->on_interpolate_transform_list) {
+			_item_spatial_changed(item);
+		}
+	}
+
 	GODOT_UPDATE_INTERPOLATION_TICK(canvas_item_transform_update_list_prev, canvas_item_transform_update_list_curr, Item, canvas_item_owner);
 	GODOT_UPDATE_INTERPOLATION_TICK(canvas_light_transform_update_list_prev, canvas_light_transform_update_list_curr, RendererCanvasRender::Light, canvas_light_owner);
 	GODOT_UPDATE_INTERPOLATION_TICK(canvas_light_occluder_transform_update_list_prev, canvas_light_occluder_transform_update_list_curr, RendererCanvasRender::LightOccluderInstance, canvas_light_occluder_owner);
@@ -2833,6 +3081,8 @@ RendererCanvasCull::RendererCanvasCull() {
 
 	debug_redraw_time = GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "debug/canvas_items/debug_redraw_time", PROPERTY_HINT_RANGE, "0.1,2,0.001,or_greater"), 1.0);
 	debug_redraw_color = GLOBAL_DEF(PropertyInfo(Variant::COLOR, "debug/canvas_items/debug_redraw_color"), Color(1.0, 0.2, 0.2, 0.5));
+
+	spatial_index_min_children = GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/2d/culling/spatial_index_min_children", PROPERTY_HINT_RANGE, "0,65536,1,or_greater"), 0);
 }
 
 RendererCanvasCull::~RendererCanvasCull() {
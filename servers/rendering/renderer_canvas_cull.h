@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "core/math/dynamic_bvh.h"
 #include "core/templates/paged_allocator.h"
 #include "servers/rendering/instance_uniforms.h"
 #include "servers/rendering/renderer_canvas_render.h"
@@ -42,6 +43,16 @@ class RendererCanvasCull {
 	static void _dependency_deleted(const RID &p_dependency, DependencyTracker *p_tracker);
 
 public:
+	struct Item;
+
+	// Bounding volume hierarchy over the children of a canvas or canvas item with many children, so culling
+	// only visits the children that can be visible. Only leaf items with static bounds are inserted in it,
+	// the rest are listed in `unindexed` and always visited.
+	struct ChildSpatialIndex {
+		DynamicBVH bvh;
+		LocalVector<Item *> unindexed;
+	};
+
 	struct Item : public RendererCanvasRender::Item {
 		RID parent; // canvas it belongs to
 		RID self;
@@ -83,8 +94,14 @@ public:
 
 		bool update_dependencies = false;
 
+		ChildSpatialIndex *spatial_index = nullptr; // Index over `child_items`, if any.
+		ChildSpatialIndex *parent_spatial_index = nullptr; // Index of the parent this item is listed in, if any.
+		DynamicBVH::ID spatial_index_id;
+		SelfList<Item> spatial_update_item;
+
 		Item() :
-				update_item(this) {
+				update_item(this),
+				spatial_update_item(this) {
 			children_order_dirty = true;
 			E = nullptr;
 			z_index = 0;
@@ -159,6 +176,7 @@ public:
 
 		bool children_order_dirty;
 		Vector<ChildItem> child_items;
+		ChildSpatialIndex *spatial_index = nullptr;
 		Color modulate;
 		RID parent;
 		float parent_scale;
@@ -213,6 +231,19 @@ private:
 	int _count_ysort_children(RendererCanvasCull::Item *p_canvas_item);
 	void _mark_ysort_dirty(RendererCanvasCull::Item *ysort_owner);
 
+	int spatial_index_min_children = 0;
+	SelfList<Item>::List _spatial_update_list;
+
+	bool _is_item_spatially_indexable(const Item *p_item) const;
+	void _item_spatial_changed(Item *p_item);
+	void _update_item_spatial_bounds(Item *p_item);
+	void _update_spatial_indices();
+	void _spatial_index_add_child(ChildSpatialIndex *p_index, Item *p_child);
+	void _spatial_index_remove_child(Item *p_child);
+	bool _update_item_child_spatial_index(Item *p_item);
+	bool _update_canvas_child_spatial_index(Canvas *p_canvas);
+	void _cull_spatial_index(ChildSpatialIndex *p_index, const Transform2D &p_xform, const Rect2 &p_clip_rect, LocalVector<Item *> &r_children) const;
+
 	static constexpr int z_range = RSE::CANVAS_ITEM_Z_MAX - RSE::CANVAS_ITEM_Z_MIN + 1;
 
 	RendererCanvasRender::Item **z_list;
@@ -225,6 +256,9 @@ public:
 
 	bool was_sdf_used();
 
+	void set_spatial_index_min_children(int p_count);
+	int get_spatial_index_min_children() const;
+
 	RID canvas_allocate();
 	void canvas_initialize(RID p_rid);
 
@@ -0,0 +1,96 @@
+/**************************************************************************/
+/*  benchmark_json.cpp                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(benchmark_json)
+
+#include "core/io/json.h"
+#include "tests/test_benchmark.h"
+
+namespace BenchmarkJSON {
+
+static Array make_document(int p_count) {
+	Array document;
+	for (int i = 0; i < p_count; i++) {
+		Dictionary entry;
+		entry["id"] = i;
+		entry["name"] = "server_config_entry_" + itos(i);
+		entry["description"] = String::utf8("A longer description with ünïcödé text, \"quotes\" and a newline\n.");
+		entry["weights"] = Array({ 0.25, 0.5, 0.75, 1.0 });
+		entry["enabled"] = i % 2 == 0;
+		document.push_back(entry);
+	}
+	return document;
+}
+
+TEST_SUITE(TEST_BENCHMARK_SUITE) {
+	TEST_CASE("[JSON] Parse and stringify") {
+		const Array document = make_document(2000);
+		const String text = JSON::stringify(document);
+		const PackedByteArray bytes = text.to_utf8_buffer();
+
+		TestBenchmark::run("JSON parse String (2000 objects)", [&]() {
+			JSON json;
+			json.parse(text);
+			TestBenchmark::do_not_optimize(json.get_data());
+		});
+
+		TestBenchmark::run("JSON parse UTF-8 bytes via String (2000 objects)", [&]() {
+			JSON json;
+			json.parse(String::utf8((const char *)bytes.ptr(), bytes.size()));
+			TestBenchmark::do_not_optimize(json.get_data());
+		});
+
+		TestBenchmark::run("JSON parse_utf8 (2000 objects)", [&]() {
+			JSON json;
+			json.parse_utf8(bytes);
+			TestBenchmark::do_not_optimize(json.get_data());
+		});
+
+		TestBenchmark::run("JSON stringify + to_utf8_buffer (2000 objects)", [&]() {
+			PackedByteArray result = JSON::stringify(document).to_utf8_buffer();
+			TestBenchmark::do_not_optimize(result.ptr());
+		});
+
+		TestBenchmark::run("JSON stringify_utf8 (2000 objects)", [&]() {
+			PackedByteArray result = JSON::stringify_utf8(document);
+			TestBenchmark::do_not_optimize(result.ptr());
+		});
+
+		JSON json_string;
+		JSON json_utf8;
+		CHECK(json_string.parse(text) == OK);
+		CHECK(json_utf8.parse_utf8(bytes) == OK);
+		CHECK(json_utf8.get_data() == json_string.get_data());
+	}
+}
+
+} // namespace BenchmarkJSON
@@ -0,0 +1,141 @@
+/**************************************************************************/
+/*  benchmark_marshalls.cpp                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(benchmark_marshalls)
+
+#include "core/io/marshalls.h"
+#include "core/variant/array.h"
+#include "core/variant/dictionary.h"
+#include "tests/test_benchmark.h"
+
+namespace BenchmarkMarshalls {
+
+static Dictionary make_entity(int p_index) {
+	Dictionary entity;
+	entity["id"] = p_index;
+	entity["name"] = "entity_" + itos(p_index);
+	entity["position"] = Vector3(p_index, p_index * 2, p_index * 3);
+	entity["health"] = 100.0;
+	entity["alive"] = true;
+	return entity;
+}
+
+static void benchmark_roundtrip(const String &p_name, const Variant &p_value) {
+	int len = 0;
+	Error err = encode_variant(p_value, nullptr, len);
+	REQUIRE(err == OK);
+	Vector<uint8_t> buffer;
+	buffer.resize(len);
+
+	TestBenchmark::run(p_name + " encode (size + write)", [&]() {
+		int size = 0;
+		encode_variant(p_value, nullptr, size);
+		encode_variant(p_value, buffer.ptrw(), size);
+		TestBenchmark::do_not_optimize(buffer.ptr());
+	});
+
+	LocalVector<uint8_t> reused_buffer;
+	TestBenchmark::run(p_name + " encode (single pass)", [&]() {
+		reused_buffer.clear();
+		encode_variant_to_buffer(p_value, reused_buffer);
+		TestBenchmark::do_not_optimize(reused_buffer.ptr());
+	});
+
+	LocalVector<uint8_t> schema_buffer;
+	TestBenchmark::run(p_name + " encode (omitted element headers)", [&]() {
+		schema_buffer.clear();
+		encode_variant_to_buffer(p_value, schema_buffer, false, true);
+		TestBenchmark::do_not_optimize(schema_buffer.ptr());
+	});
+
+	TestBenchmark::run(p_name + " decode", [&]() {
+		Variant decoded;
+		decode_variant(decoded, buffer.ptr(), buffer.size());
+		TestBenchmark::do_not_optimize(decoded);
+	});
+
+	TestBenchmark::run(p_name + " decode (omitted element headers)", [&]() {
+		Variant decoded;
+		decode_variant(decoded, schema_buffer.ptr(), schema_buffer.size());
+		TestBenchmark::do_not_optimize(decoded);
+	});
+
+	Variant target;
+	decode_variant(target, buffer.ptr(), buffer.size());
+	TestBenchmark::run(p_name + " decode (in place)", [&]() {
+		decode_variant_in_place(target, buffer.ptr(), buffer.size());
+		TestBenchmark::do_not_optimize(target);
+	});
+
+	Variant decoded;
+	err = decode_variant(decoded, buffer.ptr(), buffer.size());
+	CHECK(err == OK);
+	CHECK(decoded == p_value);
+	err = decode_variant(decoded, schema_buffer.ptr(), schema_buffer.size());
+	CHECK(err == OK);
+	CHECK(decoded == p_value);
+	CHECK(target == p_value);
+}
+
+TEST_SUITE(TEST_BENCHMARK_SUITE) {
+	TEST_CASE("[Marshalls] Encode and decode") {
+		benchmark_roundtrip("Small Dictionary", make_entity(1));
+
+		Array ints;
+		for (int i = 0; i < 10000; i++) {
+			ints.push_back(i);
+		}
+		benchmark_roundtrip("Array of 10k ints", ints);
+
+		Array typed_floats;
+		typed_floats.set_typed(Variant::FLOAT, StringName(), Variant());
+		for (int i = 0; i < 10000; i++) {
+			typed_floats.push_back(i * 0.25);
+		}
+		benchmark_roundtrip("Typed Array of 10k floats", typed_floats);
+
+		Array entities;
+		for (int i = 0; i < 1000; i++) {
+			entities.push_back(make_entity(i));
+		}
+		benchmark_roundtrip("Array of 1k Dictionaries", entities);
+
+		PackedFloat32Array floats;
+		floats.resize(10000);
+		for (int i = 0; i < floats.size(); i++) {
+			floats.set(i, i * 0.5f);
+		}
+		benchmark_roundtrip("PackedFloat32Array of 10k", floats);
+	}
+}
+
+} // namespace BenchmarkMarshalls
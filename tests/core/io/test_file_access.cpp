@@ -297,4 +297,38 @@ TEST_CASE("[FileAccess] Cursor positioning") {
 	}
 }
 
+TEST_CASE("[FileAccess] Buffer views") {
+	const String file_path = TestUtils::get_temp_path("buffer_views.bin");
+	{
+		Ref<FileAccess> f = FileAccess::open(file_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		for (int i = 0; i < 256; i++) {
+			f->store_8(i);
+		}
+		// Files open for writing are not mapped.
+		CHECK(f->get_buffer_view(1) == nullptr);
+	}
+
+	Ref<FileAccess> f = FileAccess::open(file_path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+	f->seek(16);
+	const uint8_t *view = f->get_buffer_view(32);
+#if defined(UNIX_ENABLED) && !defined(WEB_ENABLED)
+	REQUIRE(view != nullptr);
+#endif
+	if (view) {
+		CHECK(view[0] == 16);
+		CHECK(view[31] == 47);
+		CHECK(f->get_position() == 48);
+		CHECK(f->get_8() == 48);
+		CHECK(f->get_mapped_data().size() == 256);
+
+		// Views past the end fail without moving.
+		CHECK(f->get_buffer_view(1000) == nullptr);
+		CHECK(f->get_position() == 49);
+	} else {
+		CHECK(f->get_position() == 16);
+	}
+}
+
 } // namespace TestFileAccess
@@ -0,0 +1,139 @@
+/**************************************************************************/
+/*  test_file_access_async.cpp                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_file_access_async)
+
+#include "core/io/file_access.h"
+#include "core/io/file_access_async.h"
+#include "core/os/os.h"
+#include "core/templates/local_vector.h"
+#include "tests/test_utils.h"
+
+namespace TestFileAccessAsync {
+
+static String _write_test_file(const String &p_name, int p_size) {
+	const String file_path = TestUtils::get_temp_path(p_name);
+	Ref<FileAccess> f = FileAccess::open(file_path, FileAccess::WRITE);
+	for (int i = 0; i < p_size; i++) {
+		f->store_8(i & 0xFF);
+	}
+	return file_path;
+}
+
+TEST_CASE("[FileAccessAsync] Reads") {
+	FileAccessAsync *file_access_async = FileAccessAsync::get_singleton();
+	REQUIRE(file_access_async != nullptr);
+	const String file_path = _write_test_file("async_read.bin", 100000);
+
+	SUBCASE("Whole file") {
+		FileAccessAsync::ReadID id = file_access_async->read(file_path);
+		REQUIRE(id != FileAccessAsync::INVALID_READ_ID);
+		Vector<uint8_t> data;
+		CHECK(file_access_async->wait_for_read(id, &data) == OK);
+		REQUIRE(data.size() == 100000);
+		CHECK(data[0] == 0);
+		CHECK(data[255] == 255);
+		CHECK(data[99999] == (99999 & 0xFF));
+	}
+
+	SUBCASE("Range") {
+		FileAccessAsync::ReadID id = file_access_async->read(file_path, 1000, 16);
+		Vector<uint8_t> data;
+		CHECK(file_access_async->wait_for_read(id, &data) == OK);
+		REQUIRE(data.size() == 16);
+		CHECK(data[0] == (1000 & 0xFF));
+		CHECK(data[15] == (1015 & 0xFF));
+	}
+
+	SUBCASE("Range is clamped to the end of the file") {
+		FileAccessAsync::ReadID id = file_access_async->read(file_path, 99990, 100);
+		Vector<uint8_t> data;
+		CHECK(file_access_async->wait_for_read(id, &data) == OK);
+		CHECK(data.size() == 10);
+	}
+
+	SUBCASE("Completion can be polled") {
+		FileAccessAsync::ReadID id = file_access_async->read(file_path, 0, 64);
+		while (!file_access_async->is_read_completed(id)) {
+			OS::get_singleton()->delay_usec(100);
+		}
+		Vector<uint8_t> data;
+		CHECK(file_access_async->wait_for_read(id, &data) == OK);
+		CHECK(data.size() == 64);
+	}
+
+	SUBCASE("Many reads in flight") {
+		LocalVector<FileAccessAsync::ReadID> ids;
+		for (int i = 0; i < 512; i++) {
+			ids.push_back(file_access_async->read(file_path, i * 100, 100));
+		}
+		for (uint32_t i = 0; i < ids.size(); i++) {
+			Vector<uint8_t> data;
+			CHECK(file_access_async->wait_for_read(ids[i], &data) == OK);
+			REQUIRE(data.size() == 100);
+			CHECK(data[0] == ((i * 100) & 0xFF));
+		}
+	}
+}
+
+TEST_CASE("[FileAccessAsync] Errors") {
+	FileAccessAsync *file_access_async = FileAccessAsync::get_singleton();
+	REQUIRE(file_access_async != nullptr);
+
+	FileAccessAsync::ReadID id = file_access_async->read(TestUtils::get_temp_path("async_missing.bin"));
+	CHECK(file_access_async->wait_for_read(id) != OK);
+
+	const String file_path = _write_test_file("async_errors.bin", 16);
+	id = file_access_async->read(file_path, 32);
+	CHECK(file_access_async->wait_for_read(id) == ERR_FILE_EOF);
+
+	ERR_PRINT_OFF;
+	CHECK(file_access_async->wait_for_read(id) == ERR_INVALID_PARAMETER);
+	ERR_PRINT_ON;
+}
+
+TEST_CASE("[FileAccessAsync] Prefetch") {
+	FileAccessAsync *file_access_async = FileAccessAsync::get_singleton();
+	REQUIRE(file_access_async != nullptr);
+	const String file_path = _write_test_file("async_prefetch.bin", 4096);
+
+	file_access_async->prefetch(file_path);
+	file_access_async->prefetch(TestUtils::get_temp_path("async_missing.bin"));
+
+	// Prefetching does not change what later reads return.
+	FileAccessAsync::ReadID id = file_access_async->read(file_path);
+	Vector<uint8_t> data;
+	CHECK(file_access_async->wait_for_read(id, &data) == OK);
+	CHECK(data.size() == 4096);
+}
+
+} // namespace TestFileAccessAsync
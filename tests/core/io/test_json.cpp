@@ -342,6 +342,68 @@ TEST_CASE("[JSON] Parsing escape sequences") {
 	}
 }
 
+TEST_CASE("[JSON] Parsing UTF-8 bytes") {
+	// The UTF-8 parser must produce the same results as parsing a String.
+	const String documents[] = {
+		"null",
+		"-12.5e3",
+		"[1, 2.5, true, false, null, \"text\"]",
+		"{\"key\": {\"nested\": [\"a\", \"\\n\\t\\\"\\u00e9\\ud83d\\ude00\"]}, \"long string value without escapes\": 1}",
+		String::utf8("{\"ünïcödé\": \"日本語 ✓ 😀\", \"mixed\": \"ab\\\"cd\"}"),
+		String::utf8("\"\xef\xbb\xbf inside\""),
+	};
+
+	for (const String &document : documents) {
+		JSON json_string;
+		JSON json_utf8;
+		CHECK(json_string.parse(document) == OK);
+		CHECK_MESSAGE(
+				json_utf8.parse_utf8(document.to_utf8_buffer()) == OK,
+				vformat("Parsing `%s` as UTF-8 should parse successfully.", document));
+		CHECK_MESSAGE(
+				json_utf8.get_data() == json_string.get_data(),
+				vformat("Parsing `%s` as UTF-8 should return the same value as parsing it as a String.", document));
+	}
+
+	JSON json;
+
+	// Numbers at the very end of the buffer must not read past it.
+	PackedByteArray number;
+	number.push_back('4');
+	number.push_back('2');
+	CHECK(json.parse_utf8(number) == OK);
+	CHECK((int)json.get_data() == 42);
+
+	// Numbers longer than any fixed-size buffer must be parsed whole.
+	const String long_number = "1." + String("0").repeat(200) + "1e2";
+	CHECK(json.parse_utf8(("[" + long_number + "]").to_utf8_buffer()) == OK);
+	CHECK(double(Array(json.get_data())[0]) == doctest::Approx(100.0));
+
+	PackedByteArray with_bom = String("[1]").to_utf8_buffer();
+	with_bom.insert(0, 0xbf);
+	with_bom.insert(0, 0xbb);
+	with_bom.insert(0, 0xef);
+	CHECK(json.parse_utf8(with_bom) == OK);
+	CHECK(Array(json.get_data()).size() == 1);
+
+	CHECK(json.parse_utf8(String("[\n1,\n2\n").to_utf8_buffer()) == ERR_PARSE_ERROR);
+	CHECK(json.get_error_line() == 3);
+	CHECK(json.parse_utf8(String("{\"unterminated").to_utf8_buffer()) == ERR_PARSE_ERROR);
+}
+
+TEST_CASE("[JSON] Stringify to UTF-8 bytes") {
+	Dictionary dictionary;
+	dictionary["name"] = String::utf8("ünïcödé 😀");
+	dictionary["escapes"] = "\\\b\f\n\r\t\v\"";
+	dictionary["array"] = Array({ 1, 2.5, true, Variant() });
+	dictionary["nested"] = Dictionary();
+
+	CHECK(JSON::stringify_utf8(dictionary) == JSON::stringify(dictionary).to_utf8_buffer());
+	CHECK(JSON::stringify_utf8(dictionary, "\t", false, true) == JSON::stringify(dictionary, "\t", false, true).to_utf8_buffer());
+	CHECK(String("test\"\n").json_escape() == "test\\\"\\n");
+	CHECK(String("plain").json_escape() == "plain");
+}
+
 TEST_CASE("[JSON] Serialization") {
 	JSON json;
 
@@ -490,4 +490,162 @@ TEST_CASE("[Marshalls] Typed dictionary decoding") {
 	CHECK(dictionary[Variant(uint64_t(0x0f123456789abcdef))] == Variant(uint64_t(0x0f123456789abcdef)));
 }
 
+static LocalVector<uint8_t> encode_to_vector(const Variant &p_variant) {
+	int len = 0;
+	REQUIRE(encode_variant(p_variant, nullptr, len) == OK);
+	LocalVector<uint8_t> buffer;
+	buffer.resize(len);
+	REQUIRE(encode_variant(p_variant, buffer.ptr(), len) == OK);
+	return buffer;
+}
+
+static bool is_same_bytes(const LocalVector<uint8_t> &p_a, const LocalVector<uint8_t> &p_b) {
+	return p_a.size() == p_b.size() && memcmp(p_a.ptr(), p_b.ptr(), p_a.size()) == 0;
+}
+
+TEST_CASE("[Marshalls] Single-pass buffer encoding") {
+	Array typed_ints;
+	typed_ints.set_typed(Variant::INT, StringName(), Variant());
+	typed_ints.push_back(1);
+	typed_ints.push_back(int64_t(1) << 40);
+
+	Dictionary dict;
+	dict["name"] = "caf\u00e9";
+	dict[StringName("key")] = NodePath("a/b:c");
+	dict[3] = 0.5;
+	dict[4] = 0.1;
+	dict["ints"] = typed_ints;
+	dict["bytes"] = PackedByteArray({ 1, 2, 3 });
+	dict["strings"] = PackedStringArray({ "a", "bc", "abc", "caf\u00e9", "" });
+	dict["nested"] = Array({ Vector3(1, 2, 3), Color(1, 0, 0), Variant() });
+
+	LocalVector<uint8_t> expected = encode_to_vector(dict);
+
+	LocalVector<uint8_t> buffer;
+	CHECK(encode_variant_to_buffer(dict, buffer) == OK);
+	CHECK(is_same_bytes(buffer, expected));
+
+	// Appends to the existing content.
+	CHECK(encode_variant_to_buffer(dict, buffer) == OK);
+	REQUIRE(buffer.size() == expected.size() * 2);
+	CHECK(memcmp(buffer.ptr() + expected.size(), expected.ptr(), expected.size()) == 0);
+}
+
+TEST_CASE("[Marshalls] Buffer encoding size limit") {
+	Array array;
+	array.push_back(PackedStringArray({ "first", "second" }));
+	array.push_back(String("x").repeat(64));
+	const LocalVector<uint8_t> expected = encode_to_vector(array);
+
+	LocalVector<uint8_t> buffer;
+	CHECK(encode_variant_to_buffer(array, buffer, false, false, expected.size()) == OK);
+	CHECK(is_same_bytes(buffer, expected));
+
+	// Stops before the end, and leaves the buffer as it was.
+	buffer.clear();
+	buffer.push_back(7);
+	CHECK(encode_variant_to_buffer(array, buffer, false, false, expected.size() - 1) == ERR_OUT_OF_MEMORY);
+	CHECK(buffer.size() == 1);
+	CHECK(encode_variant_to_buffer(array, buffer, false, false, 16) == ERR_OUT_OF_MEMORY);
+	CHECK(buffer.size() == 1);
+}
+
+TEST_CASE("[Marshalls] Omitted element headers") {
+	Array array;
+	array.set_typed(Variant::INT, StringName(), Variant());
+	array.push_back(1);
+	array.push_back(int64_t(1) << 40);
+
+	LocalVector<uint8_t> buffer;
+	CHECK(encode_variant_to_buffer(array, buffer, false, true) == OK);
+	REQUIRE(buffer.size() == 32);
+	CHECK_MESSAGE(buffer[0] == 0x1c, "Variant::ARRAY");
+	CHECK_MESSAGE(buffer[2] == 0x11, "CONTAINER_TYPE_KIND_BUILTIN | HEADER_DATA_FLAG_OMIT_ELEMENT_HEADERS");
+	CHECK_MESSAGE(buffer[12] == 0x02, "Shared element header: Variant::INT");
+	CHECK_MESSAGE(buffer[14] == 0x01, "Shared element header: HEADER_DATA_FLAG_64");
+	CHECK(decode_uint64(&buffer[16]) == 1);
+	CHECK(decode_uint64(&buffer[24]) == uint64_t(1) << 40);
+
+	Variant decoded;
+	int len = 0;
+	CHECK(decode_variant(decoded, buffer.ptr(), buffer.size(), &len) == OK);
+	CHECK(len == 32);
+	CHECK(decoded == array);
+	CHECK(Array(decoded).get_typed_builtin() == Variant::INT);
+
+	// Only keys share a header, values are untyped.
+	Dictionary dict;
+	dict.set_typed(Variant::STRING, StringName(), Variant(), Variant::NIL, StringName(), Variant());
+	dict["a"] = 1;
+	dict["b"] = Vector2(1, 2);
+	buffer.clear();
+	CHECK(encode_variant_to_buffer(dict, buffer, false, true) == OK);
+	CHECK(buffer.size() < encode_to_vector(dict).size());
+	CHECK(decode_variant(decoded, buffer.ptr(), buffer.size(), &len) == OK);
+	CHECK(len == int(buffer.size()));
+	CHECK(decoded == dict);
+
+	// Untyped containers keep their element headers.
+	Array untyped = { 1, "a" };
+	buffer.clear();
+	CHECK(encode_variant_to_buffer(untyped, buffer, false, true) == OK);
+	CHECK(is_same_bytes(buffer, encode_to_vector(untyped)));
+
+	// A shared header that does not match the container type is rejected.
+	uint8_t invalid[] = {
+		0x1c, 0x00, 0x11, 0x00, // Variant::ARRAY, CONTAINER_TYPE_KIND_BUILTIN | HEADER_DATA_FLAG_OMIT_ELEMENT_HEADERS
+		0x02, 0x00, 0x00, 0x00, // Array type (Variant::INT).
+		0x01, 0x00, 0x00, 0x00, // Array size.
+		0x04, 0x00, 0x00, 0x00, // Shared element header (Variant::STRING).
+		0x00, 0x00, 0x00, 0x00 // Element value.
+	};
+	ERR_PRINT_OFF;
+	CHECK(decode_variant(decoded, invalid, 20) == ERR_INVALID_DATA);
+	ERR_PRINT_ON;
+}
+
+TEST_CASE("[Marshalls] In-place decoding") {
+	Array inner = { 1, 2, 3 };
+	Dictionary dict;
+	dict["stale"] = true;
+	dict["inner"] = inner;
+	Array array;
+	array.set_typed(Variant::DICTIONARY, StringName(), Variant());
+	array.push_back(dict);
+	Variant target = array;
+
+	Dictionary new_dict;
+	new_dict["inner"] = Array({ 4, 5 });
+	new_dict["added"] = "value";
+	Array new_array;
+	new_array.set_typed(Variant::DICTIONARY, StringName(), Variant());
+	new_array.push_back(new_dict);
+	new_array.push_back(Dictionary());
+	LocalVector<uint8_t> buffer = encode_to_vector(new_array);
+
+	int len = 0;
+	CHECK(decode_variant_in_place(target, buffer.ptr(), buffer.size(), &len) == OK);
+	CHECK(len == int(buffer.size()));
+	CHECK(target == new_array);
+	CHECK(Array(target).is_same_instance(array));
+	CHECK(Array(target).get_typed_builtin() == Variant::DICTIONARY);
+	CHECK(Dictionary(array[0]).is_same_instance(dict));
+	CHECK_FALSE(dict.has("stale"));
+	CHECK(Array(dict["inner"]).is_same_instance(inner));
+	CHECK(inner == Array({ 4, 5 }));
+
+	// A container with different typing is replaced.
+	Array untyped = { 1 };
+	target = untyped;
+	CHECK(decode_variant_in_place(target, buffer.ptr(), buffer.size()) == OK);
+	CHECK(target == new_array);
+	CHECK_FALSE(Array(target).is_same_instance(untyped));
+	CHECK(untyped == Array({ 1 }));
+
+	// Other types are decoded normally.
+	target = 5;
+	CHECK(decode_variant_in_place(target, buffer.ptr(), buffer.size()) == OK);
+	CHECK(target == new_array);
+}
+
 } // namespace TestMarshalls
@@ -33,6 +33,7 @@
 TEST_FORCE_LINK(test_pck_packer)
 
 #include "core/io/file_access.h"
+#include "core/io/file_access_pack.h"
 #include "core/io/pck_packer.h"
 #include "core/os/os.h"
 #include "tests/test_utils.h"
@@ -120,4 +121,48 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			"The generated non-empty PCK file shouldn't be too large.");
 }
 
+TEST_CASE("[PCKPacker] Read a packed file through the memory mapping") {
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_mapped.pck");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	const PackedByteArray contents = String("Mapped contents").to_utf8_buffer();
+	REQUIRE(pck_packer.add_file_from_buffer("mapped/data.txt", contents) == OK);
+	REQUIRE(pck_packer.flush() == OK);
+
+	// A truncated directory is rejected without registering the mapping or any path.
+	const PackedByteArray pck_data = FileAccess::get_file_as_bytes(output_pck_path);
+	const String truncated_pck_path = TestUtils::get_temp_path("output_mapped_truncated.pck");
+	{
+		Ref<FileAccess> f = FileAccess::open(truncated_pck_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(pck_data.ptr(), pck_data.size() - 8);
+	}
+	ERR_PRINT_OFF;
+	CHECK(PackedData::get_singleton()->add_pack(truncated_pck_path, true, 0) != OK);
+	ERR_PRINT_ON;
+	CHECK(PackedData::get_singleton()->get_mapped_pack(truncated_pck_path).is_null());
+
+	REQUIRE(PackedData::get_singleton()->add_pack(output_pck_path, true, 0) == OK);
+	Ref<FileAccess> file = PackedData::get_singleton()->try_open_path("res://mapped/data.txt");
+	REQUIRE(file.is_valid());
+	CHECK(file->get_length() == uint64_t(contents.size()));
+
+	Ref<FileAccess> pack = FileAccess::open(output_pck_path, FileAccess::READ);
+	if (pack->get_mapped_data().is_empty()) {
+		// Memory mapping isn't supported on this platform, the file is read from the pack instead.
+		CHECK(file->get_buffer_view(1) == nullptr);
+		CHECK(file->get_buffer(contents.size()) == contents);
+		return;
+	}
+
+	CHECK(PackedData::get_singleton()->get_mapped_pack(output_pck_path).is_valid());
+	CHECK(file->get_mapped_data().size() == uint64_t(contents.size()));
+	const uint8_t *view = file->get_buffer_view(contents.size());
+	REQUIRE(view != nullptr);
+	CHECK(memcmp(view, contents.ptr(), contents.size()) == 0);
+	CHECK(file->get_position() == uint64_t(contents.size()));
+	// No view past the end of the packed file, even though the pack continues.
+	CHECK(file->get_buffer_view(1) == nullptr);
+}
+
 } // namespace TestPCKPacker
@@ -32,10 +32,14 @@
 
 TEST_FORCE_LINK(test_resource)
 
+#include "core/config/project_settings.h"
+#include "core/io/image.h"
 #include "core/io/resource.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
 #include "core/object/class_db.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
 #include "scene/main/node.h"
 #include "tests/test_utils.h"
 
@@ -573,6 +577,229 @@ TEST_CASE("[Resource] Saving and loading") {
 			"The loaded child resource name should be equal to the expected value.");
 }
 
+TEST_CASE("[Resource] Loading binary resources with large sub-resources") {
+	// Large enough to have the sub-resources decoded on worker threads.
+	PackedByteArray bytes;
+	bytes.resize(256 * 1024);
+	for (int i = 0; i < bytes.size(); i++) {
+		bytes.write[i] = i % 251;
+	}
+	PackedFloat32Array floats;
+	floats.resize(64 * 1024);
+	for (int i = 0; i < floats.size(); i++) {
+		floats.write[i] = i * 0.5f;
+	}
+
+	Ref<Resource> resource = memnew(Resource);
+	Ref<Resource> shared_child = memnew(Resource);
+	shared_child->set_name("Shared");
+	for (int i = 0; i < 4; i++) {
+		Ref<Resource> child = memnew(Resource);
+		child->set_name(vformat("Child %d", i));
+		child->set_meta("bytes", bytes);
+		child->set_meta("floats", floats);
+		// References to other resources are resolved once those are loaded.
+		child->set_meta("shared", shared_child);
+		resource->set_meta(vformat("child_%d", i), child);
+	}
+	resource->set_meta("bytes", bytes);
+
+	const String save_path = TestUtils::get_temp_path("resource_large.res");
+	REQUIRE(ResourceSaver::save(resource, save_path) == OK);
+
+	Ref<Resource> loaded = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded.is_valid());
+	CHECK(loaded->get_meta("bytes") == Variant(bytes));
+
+	Ref<Resource> loaded_shared;
+	for (int i = 0; i < 4; i++) {
+		Ref<Resource> child = loaded->get_meta(vformat("child_%d", i));
+		REQUIRE(child.is_valid());
+		CHECK(child->get_name() == vformat("Child %d", i));
+		CHECK(child->get_meta("bytes") == Variant(bytes));
+		CHECK(child->get_meta("floats") == Variant(floats));
+
+		Ref<Resource> shared = child->get_meta("shared");
+		REQUIRE(shared.is_valid());
+		CHECK(shared->get_name() == "Shared");
+		if (loaded_shared.is_valid()) {
+			CHECK_MESSAGE(shared == loaded_shared, "Sub-resources should be shared after loading.");
+		}
+		loaded_shared = shared;
+	}
+}
+
+TEST_CASE("[Resource] Lazy sub-resource loading") {
+	Ref<Resource> resource = memnew(Resource);
+	Ref<Resource> shared_child = memnew(Resource);
+	shared_child->set_scene_unique_id("shared");
+	shared_child->set_meta("value", 42);
+	for (int i = 0; i < 3; i++) {
+		Ref<Resource> child = memnew(Resource);
+		child->set_scene_unique_id(vformat("child_%d", i));
+		child->set_meta("value", i);
+		child->set_meta("shared", shared_child);
+		resource->set_meta(vformat("child_%d", i), child);
+	}
+
+	const String save_path = TestUtils::get_temp_path("resource_lazy.res");
+	REQUIRE(ResourceSaver::save(resource, save_path) == OK);
+	const String local_path = ProjectSettings::get_singleton()->localize_path(save_path);
+
+	ResourceLoader::set_lazy_subresource_loading(local_path, true);
+	CHECK(ResourceLoader::is_lazy_subresource_loading(local_path));
+
+	Ref<Resource> loaded = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_REUSE);
+	REQUIRE(loaded.is_valid());
+	CHECK(loaded->is_materialized());
+
+	// Everything reachable is materialized before the load returns, as shells can't intercept property access.
+	Ref<Resource> shared;
+	for (int i = 0; i < 3; i++) {
+		Ref<Resource> child = loaded->get_meta(vformat("child_%d", i));
+		REQUIRE(child.is_valid());
+		CHECK(child->is_materialized());
+		CHECK(int(child->get_meta("value")) == i);
+		Ref<Resource> child_shared = child->get_meta("shared");
+		REQUIRE(child_shared.is_valid());
+		if (shared.is_null()) {
+			shared = child_shared;
+		}
+		CHECK_MESSAGE(child_shared == shared, "Sub-resources should be shared after materializing.");
+	}
+	CHECK(shared->is_materialized());
+	CHECK(int(shared->get_meta("value")) == 42);
+
+	Ref<Resource> loaded_shared = ResourceLoader::load(local_path + "::shared");
+	CHECK(loaded_shared == shared);
+
+	ResourceLoader::set_lazy_subresource_loading(local_path, false);
+	CHECK_FALSE(ResourceLoader::is_lazy_subresource_loading(local_path));
+}
+
+class TestLazyData : public ResourceLazyData {
+	GDSOFTCLASS(TestLazyData, ResourceLazyData);
+
+protected:
+	virtual Error _read(Ref<RefCounted> &r_properties) override {
+		read_count.increment();
+		OS::get_singleton()->delay_usec(1000);
+		return OK;
+	}
+
+	virtual Error _apply(Resource *p_resource, const Ref<RefCounted> &p_properties) override {
+		apply_count.increment();
+		p_resource->set_meta("value", 42);
+		return OK;
+	}
+
+public:
+	SafeNumeric<uint32_t> read_count;
+	SafeNumeric<uint32_t> apply_count;
+};
+
+TEST_CASE("[Resource] Materializing from several threads") {
+	Ref<Resource> resource = memnew(Resource);
+	Ref<TestLazyData> lazy_data;
+	lazy_data.instantiate();
+	resource->set_lazy_data(lazy_data);
+	CHECK_FALSE(resource->is_materialized());
+
+	Thread threads[4];
+	for (Thread &thread : threads) {
+		thread.start([](void *p_resource) { ((Resource *)p_resource)->materialize(); }, resource.ptr());
+	}
+	for (Thread &thread : threads) {
+		thread.wait_to_finish();
+	}
+
+	CHECK(resource->is_materialized());
+	CHECK(int(resource->get_meta("value")) == 42);
+	CHECK_MESSAGE(lazy_data->apply_count.get() == 1, "The properties should only be applied once.");
+	CHECK(lazy_data->read_count.get() >= 1);
+
+	CHECK(resource->materialize() == OK);
+	CHECK_MESSAGE(lazy_data->read_count.get() <= 4, "A materialized resource shouldn't be read again.");
+}
+
+TEST_CASE("[Resource] Streaming budget") {
+	String paths[3];
+	for (int i = 0; i < 3; i++) {
+		const String save_path = TestUtils::get_temp_path(vformat("streaming_%d.res", i));
+		ResourceSaver::save(Image::create_empty(64, 64, false, Image::FORMAT_RGBA8), save_path);
+		paths[i] = ProjectSettings::get_singleton()->localize_path(save_path);
+		ResourceCache::set_streamable(paths[i], true);
+	}
+	const uint64_t image_size = Image::create_empty(64, 64, false, Image::FORMAT_RGBA8)->get_memory_usage_estimate();
+	const uint64_t evictions = ResourceCache::get_streaming_eviction_count();
+	ResourceCache::set_streaming_budget(image_size * 2);
+
+	{
+		Ref<Resource> resource_0 = ResourceLoader::load(paths[0]);
+		Ref<Resource> resource_1 = ResourceLoader::load(paths[1]);
+		REQUIRE(resource_0.is_valid());
+		REQUIRE(resource_1.is_valid());
+	}
+	CHECK_MESSAGE(
+			(ResourceCache::has(paths[0]) && ResourceCache::has(paths[1])),
+			"Streamable resources should be kept in the cache after their last use.");
+	CHECK(ResourceCache::get_streaming_resource_count() == 2);
+	CHECK(ResourceCache::get_streaming_memory_usage() == image_size * 2);
+
+	// Requesting the first resource again makes the second one the least recently used.
+	ResourceLoader::load(paths[0]);
+	ResourceLoader::load(paths[2]);
+	CHECK_MESSAGE(
+			!ResourceCache::has(paths[1]),
+			"The least recently used resource should be evicted when over budget.");
+	CHECK(ResourceCache::has(paths[0]));
+	CHECK(ResourceCache::has(paths[2]));
+	CHECK(ResourceCache::get_streaming_eviction_count() == evictions + 1);
+	CHECK(ResourceCache::get_streaming_memory_usage() == image_size * 2);
+
+	Ref<Resource> reloaded = ResourceLoader::load(paths[1]);
+	CHECK_MESSAGE(
+			reloaded.is_valid(),
+			"Evicted resources should be loaded again on request.");
+	CHECK(!ResourceCache::has(paths[0]));
+
+	// Resources still in use stay cached when released from the budget.
+	ResourceCache::set_streamable(paths[1], false);
+	CHECK(ResourceCache::has(paths[1]));
+	CHECK(ResourceCache::get_streaming_resource_count() == 1);
+
+	ResourceCache::set_streaming_budget(0);
+	CHECK(ResourceCache::get_streaming_resource_count() == 0);
+	CHECK(ResourceCache::get_streaming_memory_usage() == 0);
+	CHECK(!ResourceCache::has(paths[2]));
+
+	for (int i = 0; i < 3; i++) {
+		ResourceCache::set_streamable(paths[i], false);
+	}
+}
+
+TEST_CASE("[Resource] Memory usage estimate") {
+	PackedByteArray bytes;
+	bytes.resize(4096);
+	Dictionary dict;
+	dict["bytes"] = bytes;
+
+	Ref<Resource> resource = memnew(Resource);
+	const uint64_t empty_size = resource->get_memory_usage_estimate();
+	resource->set_meta("dict", dict);
+	CHECK_MESSAGE(
+			resource->get_memory_usage_estimate() >= empty_size + bytes.size(),
+			"Data held in dictionaries should be accounted for.");
+
+	const String save_path = TestUtils::get_temp_path("memory_usage.tres");
+	ResourceSaver::save(resource, save_path);
+	Ref<Resource> loaded = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(loaded.is_valid());
+	CHECK_MESSAGE(
+			loaded->get_memory_usage_estimate() >= empty_size + bytes.size(),
+			"The estimate measured while loading should account for the loaded properties.");
+}
+
 TEST_CASE("[Resource] Breaking circular references on save") {
 	Ref<Resource> resource_a = memnew(Resource);
 	resource_a->set_name("A");
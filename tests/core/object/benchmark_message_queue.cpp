@@ -0,0 +1,91 @@
+/**************************************************************************/
+/*  benchmark_message_queue.cpp                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(benchmark_message_queue)
+
+#include "core/object/callable_mp.h"
+#include "core/object/message_queue.h"
+#include "tests/test_benchmark.h"
+
+namespace BenchmarkMessageQueue {
+
+class CallCounter : public Object {
+public:
+	uint64_t calls = 0;
+
+	void count() { calls++; }
+	void count_by(int p_amount) { calls += p_amount; }
+};
+
+TEST_SUITE(TEST_BENCHMARK_SUITE) {
+	TEST_CASE("[MessageQueue] Queue and flush deferred calls") {
+		const int count = 10000;
+		CallQueue queue;
+		CallCounter *counter = memnew(CallCounter);
+
+		TestBenchmark::run("10k deferred calls through callables", [&]() {
+			for (int i = 0; i < count; i++) {
+				queue.push_callable(callable_mp(counter, &CallCounter::count_by), 1);
+			}
+			queue.flush();
+		});
+
+		TestBenchmark::run("10k native deferred calls", [&]() {
+			for (int i = 0; i < count; i++) {
+				queue.push_native_call(counter, &CallCounter::count_by, 1);
+			}
+			queue.flush();
+		});
+
+		// Like many children of a container each asking it to sort again.
+		const Callable callable = callable_mp(counter, &CallCounter::count);
+		TestBenchmark::run("10k deferred calls of the same callable", [&]() {
+			for (int i = 0; i < count; i++) {
+				queue.push_callable(callable);
+			}
+			queue.flush();
+		});
+
+		TestBenchmark::run("10k unique deferred calls of the same callable", [&]() {
+			for (int i = 0; i < count; i++) {
+				queue.push_unique_callable(callable);
+			}
+			queue.flush();
+		});
+
+		CHECK(counter->calls > 0);
+
+		memdelete(counter);
+	}
+}
+
+} // namespace BenchmarkMessageQueue
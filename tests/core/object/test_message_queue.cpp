@@ -0,0 +1,152 @@
+/**************************************************************************/
+/*  test_message_queue.cpp                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_message_queue)
+
+#include "core/object/callable_mp.h"
+#include "core/object/message_queue.h"
+
+namespace TestMessageQueue {
+
+class _TestMessageQueueObject : public Object {
+public:
+	int calls = 0;
+	int sum = 0;
+	String text;
+
+	void increment() { calls++; }
+	void add(int p_value, const String &p_text) {
+		calls++;
+		sum += p_value;
+		text += p_text;
+	}
+};
+
+TEST_CASE("[MessageQueue] Native calls") {
+	CallQueue queue;
+	_TestMessageQueueObject *object = memnew(_TestMessageQueueObject);
+
+	CHECK(queue.push_native_call(object, &_TestMessageQueueObject::increment) == OK);
+	CHECK(queue.push_native_call(object, &_TestMessageQueueObject::add, 3, String("a")) == OK);
+	CHECK(queue.push_native_call(object, &_TestMessageQueueObject::add, 4, String("b")) == OK);
+	CHECK(queue.has_messages());
+	CHECK(object->calls == 0);
+
+	queue.flush();
+	CHECK_FALSE(queue.has_messages());
+	CHECK(object->calls == 3);
+	CHECK(object->sum == 7);
+	CHECK(object->text == "ab");
+
+	SUBCASE("Mixed with Variant calls") {
+		queue.push_callable(callable_mp(object, &_TestMessageQueueObject::add), 1, "c");
+		queue.push_native_call(object, &_TestMessageQueueObject::add, 2, String("d"));
+		queue.push_callable(callable_mp(object, &_TestMessageQueueObject::add), 3, "e");
+		queue.flush();
+		CHECK(object->calls == 6);
+		CHECK(object->sum == 13);
+		CHECK(object->text == "abcde");
+	}
+
+	SUBCASE("Freed objects are skipped") {
+		_TestMessageQueueObject *freed = memnew(_TestMessageQueueObject);
+		queue.push_native_call(freed, &_TestMessageQueueObject::increment);
+		queue.push_native_call(object, &_TestMessageQueueObject::increment);
+		memdelete(freed);
+		queue.flush();
+		CHECK(object->calls == 4);
+	}
+
+	SUBCASE("Cleared calls are not made") {
+		queue.push_native_call(object, &_TestMessageQueueObject::add, 5, String("f"));
+		queue.clear();
+		queue.flush();
+		CHECK(object->calls == 3);
+		CHECK(object->text == "ab");
+	}
+
+	memdelete(object);
+}
+
+TEST_CASE("[MessageQueue] Unique calls") {
+	CallQueue queue;
+	_TestMessageQueueObject *object = memnew(_TestMessageQueueObject);
+	Callable increment = callable_mp(object, &_TestMessageQueueObject::increment);
+
+	queue.push_unique_callable(increment);
+	queue.push_unique_callable(increment);
+	queue.push_callable(increment);
+	queue.push_unique_callable(increment);
+	queue.flush();
+	CHECK(object->calls == 2);
+
+	queue.end_frame();
+	CHECK(queue.get_frame_message_count() == 2);
+	CHECK(queue.get_frame_coalesced_count() == 2);
+
+	SUBCASE("Arguments of the first call are kept") {
+		Callable add = callable_mp(object, &_TestMessageQueueObject::add);
+		queue.push_unique_callable(add, 1, "a");
+		queue.push_unique_callable(add, 2, "b");
+		queue.flush();
+		CHECK(object->calls == 3);
+		CHECK(object->sum == 1);
+		CHECK(object->text == "a");
+	}
+
+	SUBCASE("Calls can be queued again once flushed") {
+		queue.push_unique_callable(increment);
+		queue.flush();
+		queue.push_unique_callable(increment);
+		queue.flush();
+		CHECK(object->calls == 4);
+	}
+
+	SUBCASE("Calls can be queued again once cleared") {
+		queue.push_unique_callable(increment);
+		queue.clear();
+		queue.push_unique_callable(increment);
+		queue.flush();
+		CHECK(object->calls == 3);
+	}
+
+	SUBCASE("Frame statistics are reset") {
+		queue.end_frame();
+		CHECK(queue.get_frame_message_count() == 0);
+		CHECK(queue.get_frame_coalesced_count() == 0);
+		CHECK(queue.get_frame_flush_time_usec() == 0);
+	}
+
+	memdelete(object);
+}
+
+} // namespace TestMessageQueue
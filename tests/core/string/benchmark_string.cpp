@@ -0,0 +1,167 @@
+/**************************************************************************/
+/*  benchmark_string.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(benchmark_string)
+
+#include "core/io/json.h"
+#include "core/string/string_name.h"
+#include "core/string/ustring.h"
+#include "core/variant/variant_parser.h"
+#include "tests/test_benchmark.h"
+
+namespace BenchmarkString {
+
+TEST_SUITE(TEST_BENCHMARK_SUITE) {
+	TEST_CASE("[String] Construction and conversion") {
+		TestBenchmark::run("String from short ASCII literal", [&]() {
+			String string = "position";
+			TestBenchmark::do_not_optimize(string.ptr());
+		});
+
+		const CharString utf8 = String("The quick brown fox jumps over the lazy dog. Ça va? Ünïcödé ✓").utf8();
+		TestBenchmark::run("String::utf8 parse (64 bytes)", [&]() {
+			String string = String::utf8(utf8.get_data(), utf8.length());
+			TestBenchmark::do_not_optimize(string.ptr());
+		});
+
+		const String string = String::utf8(utf8.get_data());
+		TestBenchmark::run("String::utf8 encode (64 bytes)", [&]() {
+			CharString encoded = string.utf8();
+			TestBenchmark::do_not_optimize(encoded.ptr());
+		});
+
+		TestBenchmark::run("String::hash (64 bytes)", [&]() {
+			TestBenchmark::do_not_optimize(string.hash());
+		});
+
+		CHECK(string.length() > 0);
+	}
+
+	TEST_CASE("[String] Concatenation and formatting") {
+		TestBenchmark::run("String += 1k short strings", [&]() {
+			String string;
+			for (int i = 0; i < 1000; i++) {
+				string += "item";
+			}
+			TestBenchmark::do_not_optimize(string.ptr());
+		});
+
+		TestBenchmark::run("String + itos (short)", [&]() {
+			String string = String("node_") + itos(12345);
+			TestBenchmark::do_not_optimize(string.ptr());
+		});
+
+		TestBenchmark::run("String::num_real", [&]() {
+			String string = String::num_real(3.14159265);
+			TestBenchmark::do_not_optimize(string.ptr());
+		});
+
+		const String csv = "alpha,beta,gamma,delta,epsilon,zeta,eta,theta,iota,kappa";
+		TestBenchmark::run("String::split (10 parts)", [&]() {
+			Vector<String> parts = csv.split(",");
+			TestBenchmark::do_not_optimize(parts.ptr());
+		});
+
+		CHECK(csv.split(",").size() == 10);
+	}
+
+	TEST_CASE("[String] Parsing text formats") {
+		// Mostly short names and keys, like typical scene and JSON files.
+		String scene_text;
+		String json_text = "[";
+		for (int i = 0; i < 200; i++) {
+			scene_text += vformat("[node name=\"Node%d\" type=\"Sprite2D\" parent=\"Root/Level\"]\n", i);
+			scene_text += vformat("position = Vector2(%d, %d)\n", i, i * 2);
+			scene_text += "texture = \"res://icon.svg\"\nmodulate = Color(1, 1, 1, 1)\nz_index = 1\n\n";
+			json_text += vformat("%s{\"id\": %d, \"name\": \"item_%d\", \"tags\": [\"a\", \"bb\", \"ccc\"], \"visible\": true}", i > 0 ? "," : "", i, i);
+		}
+		json_text += "]";
+
+		TestBenchmark::run("VariantParser scene text (200 nodes)", [&]() {
+			VariantParser::StreamString stream;
+			stream.s = scene_text;
+			int line = 1;
+			int tags = 0;
+			while (true) {
+				VariantParser::Tag tag;
+				String error_text;
+				String assign;
+				Variant value;
+				if (VariantParser::parse_tag_assign_eof(&stream, line, error_text, tag, assign, value) != OK) {
+					break;
+				}
+				tags += tag.name.is_empty() ? 0 : 1;
+			}
+			TestBenchmark::do_not_optimize(tags);
+		});
+
+		TestBenchmark::run("JSON::parse_string (200 objects)", [&]() {
+			Variant result = JSON::parse_string(json_text);
+			TestBenchmark::do_not_optimize(result.get_type());
+		});
+
+		TestBenchmark::run("String build from short parts (scripting style)", [&]() {
+			int64_t total = 0;
+			for (int i = 0; i < 200; i++) {
+				String label = "Player " + itos(i) + ": " + String("HP") + " " + itos(100 - i % 100);
+				total += label.length();
+			}
+			TestBenchmark::do_not_optimize(total);
+		});
+
+		CHECK(Array(JSON::parse_string(json_text)).size() == 200);
+	}
+
+	TEST_CASE("[StringName] Creation and comparison") {
+		const String name = "global_transform";
+		const StringName interned = name;
+		TestBenchmark::run("StringName from String (existing)", [&]() {
+			StringName string_name = name;
+			TestBenchmark::do_not_optimize(string_name.data_unique_pointer());
+		});
+
+		TestBenchmark::run("StringName from String (unique)", [&]() {
+			static int counter = 0;
+			StringName string_name = name + itos(counter++ % 1024);
+			TestBenchmark::do_not_optimize(string_name.data_unique_pointer());
+		});
+
+		TestBenchmark::run("StringName compare", [&]() {
+			const StringName other = interned;
+			TestBenchmark::do_not_optimize(other == interned);
+		});
+
+		CHECK(StringName(name) == interned);
+	}
+}
+
+} // namespace BenchmarkString
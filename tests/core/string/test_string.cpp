@@ -83,6 +83,29 @@ TEST_CASE("[String] Assign from char32_t string (copycon)") {
 	CHECK(u32scmp(s.get_data(), U"Wool") == 0);
 }
 
+TEST_CASE("[String] Grow and shrink across the short string capacity") {
+	// Short strings share one buffer capacity that is recycled per thread.
+	String s = "abc";
+	const String copy = s;
+	for (int i = 0; i < 40; i++) {
+		s += String::chr('a' + i % 26);
+	}
+	CHECK(s.length() == 43);
+	CHECK(s.begins_with("abcabcdef"));
+	CHECK(copy == "abc");
+
+	s = s.substr(0, 5);
+	CHECK(s == "abcab");
+	s.remove_at(2);
+	CHECK(s.length() == 4);
+	CHECK(s == "abab");
+
+	for (int i = 0; i < 200; i++) {
+		String temp = itos(i);
+		CHECK(temp.to_int() == i);
+	}
+}
+
 TEST_CASE("[String] UTF8") {
 	/* how can i embed UTF in here? */
 	static const char32_t u32str[] = { 0x0045, 0x0020, 0x304A, 0x360F, 0x3088, 0x3046, 0x1F3A4, 0 };
@@ -0,0 +1,177 @@
+/**************************************************************************/
+/*  benchmark_templates.cpp                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(benchmark_templates)
+
+#include "core/templates/a_hash_map.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/vector.h"
+#include "tests/test_benchmark.h"
+
+namespace BenchmarkTemplates {
+
+constexpr int ELEMENT_COUNT = 10000;
+
+template <typename TMap>
+void benchmark_map(const String &p_name) {
+	TestBenchmark::run(p_name + " insert 10k", [&]() {
+		TMap map;
+		for (int i = 0; i < ELEMENT_COUNT; i++) {
+			map.insert(i, i);
+		}
+		TestBenchmark::do_not_optimize(map.size());
+	});
+
+	TMap map;
+	for (int i = 0; i < ELEMENT_COUNT; i++) {
+		map.insert(i * 7, i);
+	}
+
+	TestBenchmark::run(p_name + " lookup hit 10k", [&]() {
+		int sum = 0;
+		for (int i = 0; i < ELEMENT_COUNT; i++) {
+			sum += *map.getptr(i * 7);
+		}
+		TestBenchmark::do_not_optimize(sum);
+	});
+
+	TestBenchmark::run(p_name + " lookup miss 10k", [&]() {
+		int found = 0;
+		for (int i = 0; i < ELEMENT_COUNT; i++) {
+			found += map.has(i * 7 + 1);
+		}
+		TestBenchmark::do_not_optimize(found);
+	});
+
+	TestBenchmark::run(p_name + " iterate 10k", [&]() {
+		int sum = 0;
+		for (const KeyValue<int, int> &E : map) {
+			sum += E.value;
+		}
+		TestBenchmark::do_not_optimize(sum);
+	});
+
+	TestBenchmark::run(p_name + " insert and erase 10k", [&]() {
+		TMap local;
+		for (int i = 0; i < ELEMENT_COUNT; i++) {
+			local.insert(i, i);
+		}
+		for (int i = 0; i < ELEMENT_COUNT; i++) {
+			local.erase(i);
+		}
+		TestBenchmark::do_not_optimize(local.size());
+	});
+
+	CHECK(map.size() == ELEMENT_COUNT);
+}
+
+TEST_SUITE(TEST_BENCHMARK_SUITE) {
+	TEST_CASE("[HashMap] Insert, lookup, iterate and erase") {
+		benchmark_map<HashMap<int, int>>("HashMap<int, int>");
+	}
+
+	TEST_CASE("[AHashMap] Insert, lookup, iterate and erase") {
+		benchmark_map<AHashMap<int, int>>("AHashMap<int, int>");
+	}
+
+	TEST_CASE("[LocalVector] Push back and iterate") {
+		TestBenchmark::run("LocalVector<int> push_back 10k", [&]() {
+			LocalVector<int> vector;
+			for (int i = 0; i < ELEMENT_COUNT; i++) {
+				vector.push_back(i);
+			}
+			TestBenchmark::do_not_optimize(vector.ptr());
+		});
+
+		TestBenchmark::run("LocalVector<int> reserve and push_back 10k", [&]() {
+			LocalVector<int> vector;
+			vector.reserve(ELEMENT_COUNT);
+			for (int i = 0; i < ELEMENT_COUNT; i++) {
+				vector.push_back(i);
+			}
+			TestBenchmark::do_not_optimize(vector.ptr());
+		});
+
+		LocalVector<int> vector;
+		for (int i = 0; i < ELEMENT_COUNT; i++) {
+			vector.push_back(i);
+		}
+		TestBenchmark::run("LocalVector<int> iterate 10k", [&]() {
+			int sum = 0;
+			for (const int value : vector) {
+				sum += value;
+			}
+			TestBenchmark::do_not_optimize(sum);
+		});
+
+		CHECK(vector.size() == ELEMENT_COUNT);
+	}
+
+	TEST_CASE("[Vector] Push back, copy-on-write and iterate") {
+		TestBenchmark::run("Vector<int> push_back 10k", [&]() {
+			Vector<int> vector;
+			for (int i = 0; i < ELEMENT_COUNT; i++) {
+				vector.push_back(i);
+			}
+			TestBenchmark::do_not_optimize(vector.ptr());
+		});
+
+		Vector<int> vector;
+		for (int i = 0; i < ELEMENT_COUNT; i++) {
+			vector.push_back(i);
+		}
+
+		TestBenchmark::run("Vector<int> copy (shared)", [&]() {
+			Vector<int> copy = vector;
+			TestBenchmark::do_not_optimize(copy.ptr());
+		});
+
+		TestBenchmark::run("Vector<int> copy and write (COW)", [&]() {
+			Vector<int> copy = vector;
+			copy.write[0] = 1;
+			TestBenchmark::do_not_optimize(copy.ptr());
+		});
+
+		TestBenchmark::run("Vector<int> iterate 10k", [&]() {
+			int sum = 0;
+			for (const int value : vector) {
+				sum += value;
+			}
+			TestBenchmark::do_not_optimize(sum);
+		});
+
+		CHECK(vector.size() == ELEMENT_COUNT);
+	}
+}
+
+} // namespace BenchmarkTemplates
@@ -0,0 +1,186 @@
+/**************************************************************************/
+/*  test_stable_hash_map.cpp                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_stable_hash_map)
+
+#include "core/templates/stable_hash_map.h"
+
+namespace TestStableHashMap {
+
+TEST_CASE("[StableHashMap] Insert and overwrite") {
+	StableHashMap<int, int> map;
+	StableHashMap<int, int>::Iterator e = map.insert(42, 84);
+
+	CHECK(e);
+	CHECK(e->key == 42);
+	CHECK(e->value == 84);
+	CHECK(map[42] == 84);
+	CHECK(map.has(42));
+	CHECK(map.find(42));
+
+	map.insert(42, 1234);
+	CHECK(map.size() == 1);
+	CHECK(map[42] == 1234);
+	CHECK(map.getptr(43) == nullptr);
+}
+
+TEST_CASE("[StableHashMap] Pointers stay valid") {
+	StableHashMap<int, String> map;
+	map[0] = "zero";
+	map[1] = "one";
+	const String *zero = map.getptr(0);
+	const String *one = map.getptr(1);
+
+	for (int i = 2; i < 1000; i++) {
+		map[i] = itos(i);
+	}
+	for (int i = 2; i < 1000; i += 2) {
+		map.erase(i);
+	}
+	map.sort();
+
+	CHECK(zero == map.getptr(0));
+	CHECK(one == map.getptr(1));
+	CHECK(*zero == "zero");
+	CHECK(*one == "one");
+}
+
+TEST_CASE("[StableHashMap] Insertion order after erase") {
+	StableHashMap<int, int> map;
+	for (int i = 0; i < 100; i++) {
+		map.insert(i, i * 10);
+	}
+
+	CHECK(map.erase(0));
+	CHECK(map.erase(50));
+	CHECK(map.erase(99));
+	CHECK_FALSE(map.erase(50));
+	CHECK(map.size() == 97);
+
+	int expected = 1;
+	for (const KeyValue<int, int> &E : map) {
+		if (expected == 50) {
+			expected++;
+		}
+		CHECK(E.key == expected);
+		CHECK(E.value == expected * 10);
+		expected++;
+	}
+	CHECK(map.get_by_index(0).key == 1);
+	CHECK(map.get_by_index(49).key == 51);
+	CHECK(map.get_by_index(96).key == 98);
+
+	// Erased elements are reused, but new elements still go last.
+	map.insert(1000, 0);
+	CHECK(map.get_by_index(97).key == 1000);
+}
+
+TEST_CASE("[StableHashMap] Erase most elements") {
+	StableHashMap<int, int> map;
+	for (int i = 0; i < 1000; i++) {
+		map.insert(i, i);
+	}
+	for (int i = 0; i < 1000; i++) {
+		if (i % 10 != 0) {
+			CHECK(map.erase(i));
+		}
+	}
+
+	CHECK(map.size() == 100);
+	for (uint32_t i = 0; i < map.size(); i++) {
+		CHECK(map.get_by_index(i).key == int(i * 10));
+	}
+	for (int i = 0; i < 1000; i++) {
+		CHECK(map.has(i) == (i % 10 == 0));
+	}
+}
+
+TEST_CASE("[StableHashMap] Insert while iterating") {
+	StableHashMap<int, int> map;
+	for (int i = 0; i < 10; i++) {
+		map.insert(i, i);
+	}
+
+	int count = 0;
+	for (const KeyValue<int, int> &E : map) {
+		if (E.key < 10) {
+			map.insert(E.key + 100, E.value);
+		}
+		count++;
+	}
+	CHECK(count == 10);
+	CHECK(map.size() == 20);
+}
+
+TEST_CASE("[StableHashMap] Sort") {
+	StableHashMap<int, String> map;
+	map.insert(3, "three");
+	map.insert(1, "one");
+	map.insert(4, "four");
+	map.insert(2, "two");
+	map.erase(4);
+
+	map.sort();
+
+	int expected = 1;
+	for (const KeyValue<int, String> &E : map) {
+		CHECK(E.key == expected);
+		expected++;
+	}
+	CHECK(expected == 4);
+	CHECK(map[1] == "one");
+	CHECK(map.get_by_index(2).value == "three");
+}
+
+TEST_CASE("[StableHashMap] Copy and clear") {
+	StableHashMap<int, String> map;
+	for (int i = 0; i < 50; i++) {
+		map.insert(i, itos(i));
+	}
+	map.erase(10);
+
+	StableHashMap<int, String> copy = map;
+	CHECK(copy.size() == 49);
+	CHECK(copy.get_by_index(10).key == 11);
+	CHECK(copy[20] == "20");
+
+	map.clear();
+	CHECK(map.is_empty());
+	CHECK_FALSE(map.has(20));
+	CHECK(copy.has(20));
+
+	map.insert(5, "five");
+	CHECK(map.size() == 1);
+	CHECK(map.get_by_index(0).value == "five");
+}
+
+} // namespace TestStableHashMap
@@ -0,0 +1,263 @@
+/**************************************************************************/
+/*  benchmark_variant.cpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(benchmark_variant)
+
+#include "core/object/worker_thread_pool.h"
+#include "core/variant/array.h"
+#include "core/variant/dictionary.h"
+#include "core/variant/variant.h"
+#include "tests/test_benchmark.h"
+
+namespace BenchmarkVariant {
+
+constexpr int ELEMENT_COUNT = 10000;
+
+template <typename T>
+static void construct_pooled_variants(void *p_userdata, uint32_t p_index) {
+	const T &value = *static_cast<const T *>(p_userdata);
+	// Keep a few alive at once, like a math-heavy script would.
+	Variant variants[8];
+	for (int i = 0; i < ELEMENT_COUNT; i++) {
+		variants[i % 8] = value;
+	}
+	TestBenchmark::do_not_optimize(variants);
+}
+
+template <typename T>
+static void benchmark_pooled_type(const String &p_name, const T &p_value) {
+	TestBenchmark::run("Variant(" + p_name + ") x10k, 1 thread", [&]() {
+		construct_pooled_variants<T>((void *)&p_value, 0);
+	});
+
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	const int threads = pool->get_thread_count();
+	TestBenchmark::run(vformat("Variant(%s) x10k, %d threads", p_name, threads), [&]() {
+		WorkerThreadPool::GroupID group = pool->add_native_group_task(&construct_pooled_variants<T>, (void *)&p_value, threads, threads, true);
+		pool->wait_for_group_task_completion(group);
+	});
+}
+
+TEST_SUITE(TEST_BENCHMARK_SUITE) {
+	TEST_CASE("[Variant] Construction and destruction") {
+		TestBenchmark::run("Variant(int)", [&]() {
+			Variant value = 42;
+			TestBenchmark::do_not_optimize(value);
+		});
+
+		const String string = "position";
+		TestBenchmark::run("Variant(String)", [&]() {
+			Variant value = string;
+			TestBenchmark::do_not_optimize(value);
+		});
+
+		TestBenchmark::run("Variant(Vector3)", [&]() {
+			Variant value = Vector3(1, 2, 3);
+			TestBenchmark::do_not_optimize(value);
+		});
+
+		const Transform3D transform(Basis(Vector3(0, 1, 0), 0.5), Vector3(1, 2, 3));
+		TestBenchmark::run("Variant(Transform3D)", [&]() {
+			Variant value = transform;
+			TestBenchmark::do_not_optimize(value);
+		});
+
+		TestBenchmark::run("Variant(AABB)", [&]() {
+			Variant value = AABB(Vector3(), Vector3(1, 1, 1));
+			TestBenchmark::do_not_optimize(value);
+		});
+
+		CHECK(Variant(transform).get_type() == Variant::TRANSFORM3D);
+	}
+
+	TEST_CASE("[Variant] Pooled types construction across threads") {
+		benchmark_pooled_type("Transform2D", Transform2D(0.5, Vector2(1, 2)));
+		benchmark_pooled_type("AABB", AABB(Vector3(), Vector3(1, 1, 1)));
+		benchmark_pooled_type("Basis", Basis(Vector3(0, 1, 0), 0.5));
+		benchmark_pooled_type("Transform3D", Transform3D(Basis(Vector3(0, 1, 0), 0.5), Vector3(1, 2, 3)));
+		benchmark_pooled_type("Projection", Projection::create_perspective(75.0, 1.0, 0.05, 4000.0));
+
+		CHECK(Variant(Projection()).get_type() == Variant::PROJECTION);
+	}
+
+	TEST_CASE("[Variant] Operators, calls and members") {
+		const Variant a = Vector3(1, 2, 3);
+		const Variant b = Vector3(4, 5, 6);
+
+		TestBenchmark::run("Variant::evaluate Vector3 + Vector3", [&]() {
+			Variant ret;
+			bool valid;
+			Variant::evaluate(Variant::OP_ADD, a, b, ret, valid);
+			TestBenchmark::do_not_optimize(ret);
+		});
+
+		const Variant::ValidatedOperatorEvaluator evaluator = Variant::get_validated_operator_evaluator(Variant::OP_ADD, Variant::VECTOR3, Variant::VECTOR3);
+		TestBenchmark::run("Validated operator Vector3 + Vector3", [&]() {
+			Variant ret = Vector3();
+			evaluator(&a, &b, &ret);
+			TestBenchmark::do_not_optimize(ret);
+		});
+
+		Variant base = a;
+		const StringName method = "length";
+		TestBenchmark::run("Variant::callp Vector3.length()", [&]() {
+			Variant ret;
+			Callable::CallError error;
+			base.callp(method, nullptr, 0, ret, error);
+			TestBenchmark::do_not_optimize(ret);
+		});
+
+		const StringName member = "x";
+		TestBenchmark::run("Variant::get_named Vector3.x", [&]() {
+			bool valid;
+			Variant ret = a.get_named(member, valid);
+			TestBenchmark::do_not_optimize(ret);
+		});
+
+		Variant ret;
+		bool valid = false;
+		Variant::evaluate(Variant::OP_ADD, a, b, ret, valid);
+		CHECK(valid);
+		CHECK(ret == Variant(Vector3(5, 7, 9)));
+	}
+
+	TEST_CASE("[Array] Append, read and iterate") {
+		TestBenchmark::run("Array push_back 10k ints", [&]() {
+			Array array;
+			for (int i = 0; i < ELEMENT_COUNT; i++) {
+				array.push_back(i);
+			}
+			TestBenchmark::do_not_optimize(array.size());
+		});
+
+		Array array;
+		for (int i = 0; i < ELEMENT_COUNT; i++) {
+			array.push_back(i);
+		}
+
+		TestBenchmark::run("Array index 10k", [&]() {
+			int64_t sum = 0;
+			for (int i = 0; i < ELEMENT_COUNT; i++) {
+				sum += (int64_t)array[i];
+			}
+			TestBenchmark::do_not_optimize(sum);
+		});
+
+		TestBenchmark::run("Array iterate 10k", [&]() {
+			int64_t sum = 0;
+			for (const Variant &value : array) {
+				sum += (int64_t)value;
+			}
+			TestBenchmark::do_not_optimize(sum);
+		});
+
+		TestBenchmark::run("Array duplicate 10k", [&]() {
+			Array copy = array.duplicate();
+			TestBenchmark::do_not_optimize(copy.size());
+		});
+
+		CHECK(array.size() == ELEMENT_COUNT);
+	}
+
+	TEST_CASE("[Dictionary] Insert, lookup and iterate") {
+		TestBenchmark::run("Dictionary set 10k int keys", [&]() {
+			Dictionary dictionary;
+			for (int i = 0; i < ELEMENT_COUNT; i++) {
+				dictionary[i] = i;
+			}
+			TestBenchmark::do_not_optimize(dictionary.size());
+		});
+
+		Vector<String> keys;
+		for (int i = 0; i < ELEMENT_COUNT; i++) {
+			keys.push_back("key_" + itos(i));
+		}
+
+		TestBenchmark::run("Dictionary set 10k String keys", [&]() {
+			Dictionary dictionary;
+			for (const String &key : keys) {
+				dictionary[key] = 0;
+			}
+			TestBenchmark::do_not_optimize(dictionary.size());
+		});
+
+		TestBenchmark::run("Dictionary create small (4 entries)", [&]() {
+			Dictionary dictionary;
+			dictionary["name"] = keys[0];
+			dictionary["health"] = 100;
+			dictionary["position"] = Vector3(1, 2, 3);
+			dictionary["alive"] = true;
+			TestBenchmark::do_not_optimize(dictionary.size());
+		});
+
+		Dictionary dictionary;
+		for (const String &key : keys) {
+			dictionary[key] = 1;
+		}
+
+		TestBenchmark::run("Dictionary lookup 10k String keys", [&]() {
+			int64_t sum = 0;
+			for (const String &key : keys) {
+				sum += (int64_t)dictionary[key];
+			}
+			TestBenchmark::do_not_optimize(sum);
+		});
+
+		TestBenchmark::run("Dictionary iterate 10k", [&]() {
+			int64_t sum = 0;
+			for (const KeyValue<Variant, Variant> &kv : dictionary) {
+				sum += (int64_t)kv.value;
+			}
+			TestBenchmark::do_not_optimize(sum);
+		});
+
+		TestBenchmark::run("Dictionary get_key_at_index 10k", [&]() {
+			int64_t count = 0;
+			for (int i = 0; i < ELEMENT_COUNT; i += 100) {
+				count += dictionary.get_key_at_index(i).get_type();
+			}
+			TestBenchmark::do_not_optimize(count);
+		});
+
+		TestBenchmark::run("Dictionary erase 1k of 10k", [&]() {
+			Dictionary copy = dictionary.duplicate();
+			for (int i = 0; i < ELEMENT_COUNT; i += 10) {
+				copy.erase(keys[i]);
+			}
+			TestBenchmark::do_not_optimize(copy.size());
+		});
+
+		CHECK(dictionary.size() == ELEMENT_COUNT);
+	}
+}
+
+} // namespace BenchmarkVariant
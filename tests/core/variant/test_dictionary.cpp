@@ -601,6 +601,38 @@ TEST_CASE("[Dictionary] Order and find") {
 	CHECK_EQ(d.find_key("does not exist"), Variant());
 }
 
+TEST_CASE("[Dictionary] Order after erase") {
+	Dictionary d;
+	for (int i = 0; i < 8; i++) {
+		d[i] = i;
+	}
+	d.erase(0);
+	d.erase(5);
+	d[0] = 0;
+
+	Array keys = { 1, 2, 3, 4, 6, 7, 0 };
+	CHECK_EQ(d.keys(), keys);
+	CHECK_EQ(d.get_key_at_index(4), Variant(6));
+	CHECK_EQ(d.get_value_at_index(6), Variant(0));
+	CHECK_EQ(d.get_key_at_index(7), Variant());
+	CHECK_EQ(d.get_key_at_index(-1), Variant());
+}
+
+TEST_CASE("[Dictionary] References stay valid on insert") {
+	Dictionary d;
+	d[0] = "zero";
+	const Variant *value = d.getptr(0);
+	for (int i = 1; i < 100; i++) {
+		d[i] = i;
+	}
+	CHECK(value == d.getptr(0));
+	CHECK_EQ(*value, Variant("zero"));
+
+	// The right-hand side reference must survive inserting the new key.
+	d[100] = d[0];
+	CHECK_EQ(d[100], Variant("zero"));
+}
+
 TEST_CASE("[Dictionary] sort()") {
 	Dictionary d;
 	d[3] = 3;
@@ -32,6 +32,7 @@
 
 TEST_FORCE_LINK(test_variant)
 
+#include "core/object/worker_thread_pool.h"
 #include "core/variant/variant.h"
 #include "core/variant/variant_parser.h"
 
@@ -2246,4 +2247,38 @@ TEST_CASE("[Variant] Operator NOT") {
 	}
 }
 
+static void _create_pooled_variants(void *p_userdata, uint32_t p_index) {
+	Vector<Variant> *variants = static_cast<Vector<Variant> *>(p_userdata);
+	// Replace the values created by another thread, so buckets are freed by a different thread than the one that allocated them.
+	Variant *ptrw = variants[p_index].ptrw();
+	for (int i = 0; i < variants[p_index].size(); i++) {
+		ptrw[i] = Transform3D(Basis(), Vector3(p_index, i, 0));
+	}
+}
+
+TEST_CASE("[Variant] Pooled types created and freed across threads") {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	const int thread_count = MAX(2, pool->get_thread_count());
+	Vector<Variant> *variants = memnew_arr(Vector<Variant>, thread_count);
+	for (int i = 0; i < thread_count; i++) {
+		variants[i].resize(1000);
+		for (Variant &v : variants[i]) {
+			v = AABB(Vector3(i, 0, 0), Vector3(1, 1, 1));
+		}
+	}
+
+	WorkerThreadPool::GroupID group = pool->add_native_group_task(&_create_pooled_variants, variants, thread_count, thread_count, true);
+	pool->wait_for_group_task_completion(group);
+
+	bool all_valid = true;
+	for (int i = 0; i < thread_count; i++) {
+		for (int j = 0; j < variants[i].size(); j++) {
+			all_valid = all_valid && variants[i][j] == Variant(Transform3D(Basis(), Vector3(i, j, 0)));
+		}
+	}
+	CHECK(all_valid);
+
+	memdelete_arr(variants);
+}
+
 } // namespace TestVariant
@@ -0,0 +1,134 @@
+/**************************************************************************/
+/*  test_performance.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_performance)
+
+#include "main/performance.h"
+
+namespace TestPerformance {
+
+static void record_frame_msec(Performance *p_performance, uint64_t p_msec) {
+	p_performance->record_frame(p_msec * 1000, 0, 0, 0);
+}
+
+TEST_CASE("[Performance] Frame samples") {
+	// Use the engine's singleton if there is one, so it stays registered after the test.
+	Performance *performance = Performance::get_singleton();
+	const bool owns_performance = performance == nullptr;
+	if (owns_performance) {
+		performance = memnew(Performance);
+	}
+	const int previous_window_size = performance->get_sample_window_size();
+	performance->set_sample_window_size(4);
+
+	SUBCASE("Empty window") {
+		Dictionary stats = performance->get_frame_sample_stats(Performance::FRAME_SAMPLE_FRAME_TIME);
+		CHECK(int(stats["count"]) == 0);
+		CHECK(performance->get_frame_sample_percentile(Performance::FRAME_SAMPLE_FRAME_TIME, 50.0) == 0.0);
+		CHECK(performance->get_frame_sample_max(Performance::FRAME_SAMPLE_FRAME_TIME) == 0.0);
+	}
+
+	SUBCASE("Recording samples") {
+		for (uint64_t msec : { 3, 1, 2 }) {
+			record_frame_msec(performance, msec);
+		}
+		Dictionary stats = performance->get_frame_sample_stats(Performance::FRAME_SAMPLE_FRAME_TIME);
+		CHECK(int(stats["count"]) == 3);
+		CHECK(double(stats["min"]) == doctest::Approx(0.001));
+		CHECK(double(stats["max"]) == doctest::Approx(0.003));
+		CHECK(double(stats["avg"]) == doctest::Approx(0.002));
+		CHECK(performance->get_frame_sample_max(Performance::FRAME_SAMPLE_FRAME_TIME) == doctest::Approx(0.003));
+		// Only the frame time was recorded.
+		CHECK(performance->get_frame_sample_max(Performance::FRAME_SAMPLE_PROCESS) == 0.0);
+	}
+
+	SUBCASE("Wrapping around the window") {
+		for (uint64_t msec = 1; msec <= 6; msec++) {
+			record_frame_msec(performance, msec);
+		}
+		// The two oldest samples were overwritten.
+		Dictionary stats = performance->get_frame_sample_stats(Performance::FRAME_SAMPLE_FRAME_TIME);
+		CHECK(int(stats["count"]) == 4);
+		CHECK(double(stats["min"]) == doctest::Approx(0.003));
+		CHECK(double(stats["max"]) == doctest::Approx(0.006));
+		CHECK(double(stats["avg"]) == doctest::Approx(0.0045));
+	}
+
+	SUBCASE("Percentiles") {
+		for (uint64_t msec = 1; msec <= 4; msec++) {
+			record_frame_msec(performance, msec);
+		}
+		// Nearest rank, so every percentile is one of the samples.
+		CHECK(performance->get_frame_sample_percentile(Performance::FRAME_SAMPLE_FRAME_TIME, 0.0) == doctest::Approx(0.001));
+		CHECK(performance->get_frame_sample_percentile(Performance::FRAME_SAMPLE_FRAME_TIME, 25.0) == doctest::Approx(0.001));
+		CHECK(performance->get_frame_sample_percentile(Performance::FRAME_SAMPLE_FRAME_TIME, 26.0) == doctest::Approx(0.002));
+		CHECK(performance->get_frame_sample_percentile(Performance::FRAME_SAMPLE_FRAME_TIME, 50.0) == doctest::Approx(0.002));
+		CHECK(performance->get_frame_sample_percentile(Performance::FRAME_SAMPLE_FRAME_TIME, 75.0) == doctest::Approx(0.003));
+		CHECK(performance->get_frame_sample_percentile(Performance::FRAME_SAMPLE_FRAME_TIME, 99.0) == doctest::Approx(0.004));
+		CHECK(performance->get_frame_sample_percentile(Performance::FRAME_SAMPLE_FRAME_TIME, 100.0) == doctest::Approx(0.004));
+		// Out of range percentiles are clamped.
+		CHECK(performance->get_frame_sample_percentile(Performance::FRAME_SAMPLE_FRAME_TIME, 150.0) == doctest::Approx(0.004));
+
+		Dictionary stats = performance->get_frame_sample_stats(Performance::FRAME_SAMPLE_FRAME_TIME);
+		CHECK(double(stats["p50"]) == doctest::Approx(0.002));
+		CHECK(double(stats["p95"]) == doctest::Approx(0.004));
+		CHECK(double(stats["p99"]) == doctest::Approx(0.004));
+	}
+
+	SUBCASE("Resizing and clearing") {
+		for (uint64_t msec = 1; msec <= 4; msec++) {
+			record_frame_msec(performance, msec);
+		}
+		performance->set_sample_window_size(8);
+		CHECK(int(performance->get_frame_sample_stats(Performance::FRAME_SAMPLE_FRAME_TIME)["count"]) == 0);
+
+		record_frame_msec(performance, 5);
+		CHECK(performance->get_frame_sample_percentile(Performance::FRAME_SAMPLE_FRAME_TIME, 50.0) == doctest::Approx(0.005));
+		performance->clear_samples();
+		CHECK(int(performance->get_frame_sample_stats(Performance::FRAME_SAMPLE_FRAME_TIME)["count"]) == 0);
+	}
+
+	SUBCASE("Window size is capped") {
+		ERR_PRINT_OFF;
+		performance->set_sample_window_size(Performance::MAX_SAMPLE_WINDOW_SIZE + 1);
+		ERR_PRINT_ON;
+		CHECK(performance->get_sample_window_size() == 4);
+	}
+
+	if (owns_performance) {
+		memdelete(performance);
+	} else {
+		performance->set_sample_window_size(previous_window_size);
+	}
+}
+
+} // namespace TestPerformance
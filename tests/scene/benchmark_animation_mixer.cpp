@@ -0,0 +1,125 @@
+/**************************************************************************/
+/*  benchmark_animation_mixer.cpp                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(benchmark_animation_mixer)
+
+#include "core/config/project_settings.h"
+#include "scene/3d/node_3d.h"
+#include "scene/animation/animation_player.h"
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
+#include "scene/resources/animation.h"
+#include "tests/test_benchmark.h"
+
+namespace BenchmarkAnimationMixer {
+
+static Ref<AnimationLibrary> make_library(int p_joints) {
+	Ref<Animation> animation;
+	animation.instantiate();
+	animation->set_length(1.0);
+	animation->set_loop_mode(Animation::LOOP_LINEAR);
+	for (int i = 0; i < p_joints; i++) {
+		const NodePath path = NodePath(vformat("Joint%d", i));
+		const int position_track = animation->add_track(Animation::TYPE_POSITION_3D);
+		animation->track_set_path(position_track, path);
+		const int rotation_track = animation->add_track(Animation::TYPE_ROTATION_3D);
+		animation->track_set_path(rotation_track, path);
+		for (int k = 0; k <= 30; k++) {
+			const double time = k / 30.0;
+			animation->position_track_insert_key(position_track, time, Vector3(Math::sin(time + i), Math::cos(time), 0));
+			animation->rotation_track_insert_key(rotation_track, time, Quaternion(Vector3(0, 1, 0), time * Math::TAU));
+		}
+	}
+
+	Ref<AnimationLibrary> library;
+	library.instantiate();
+	library->add_animation("idle", animation);
+	return library;
+}
+
+static Node *make_crowd(const Ref<AnimationLibrary> &p_library, int p_characters, int p_joints) {
+	Node *crowd = memnew(Node);
+	for (int i = 0; i < p_characters; i++) {
+		Node *character = memnew(Node);
+		crowd->add_child(character);
+		for (int j = 0; j < p_joints; j++) {
+			Node3D *joint = memnew(Node3D);
+			joint->set_name(vformat("Joint%d", j));
+			character->add_child(joint);
+		}
+		AnimationPlayer *player = memnew(AnimationPlayer);
+		character->add_child(player);
+		player->add_animation_library("", p_library);
+	}
+	return crowd;
+}
+
+static void play_crowd(Node *p_crowd, int p_update_interval = 1) {
+	for (int i = 0; i < p_crowd->get_child_count(); i++) {
+		Node *character = p_crowd->get_child(i);
+		AnimationPlayer *player = Object::cast_to<AnimationPlayer>(character->get_child(character->get_child_count() - 1));
+		player->set_lod_update_interval(p_update_interval);
+		player->play("idle");
+	}
+}
+
+TEST_SUITE(TEST_BENCHMARK_SUITE) {
+	TEST_CASE("[SceneTree] Process animation mixers") {
+		SceneTree *tree = SceneTree::get_singleton();
+		Node *crowd = make_crowd(make_library(40), 500, 40);
+		tree->get_root()->add_child(crowd);
+		play_crowd(crowd);
+
+		TestBenchmark::Options options;
+		options.repetitions = 20;
+
+		ProjectSettings::get_singleton()->set_setting("animation/mixer/threaded_blending", false);
+		TestBenchmark::run("Process 500 mixers with 80 tracks", [&]() {
+			tree->process(1.0 / 60.0);
+		}, options);
+
+		ProjectSettings::get_singleton()->set_setting("animation/mixer/threaded_blending", true);
+		TestBenchmark::run("Process 500 mixers with 80 tracks, threaded blending", [&]() {
+			tree->process(1.0 / 60.0);
+		}, options);
+
+		ProjectSettings::get_singleton()->set_setting("animation/mixer/threaded_blending", false);
+		play_crowd(crowd, 4);
+		TestBenchmark::run("Process 500 mixers with 80 tracks, updating every 4 frames", [&]() {
+			tree->process(1.0 / 60.0);
+		}, options);
+
+		memdelete(crowd);
+	}
+}
+
+} // namespace BenchmarkAnimationMixer
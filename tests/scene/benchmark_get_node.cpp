@@ -0,0 +1,93 @@
+/**************************************************************************/
+/*  benchmark_get_node.cpp                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(benchmark_get_node)
+
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
+#include "tests/test_benchmark.h"
+
+namespace BenchmarkGetNode {
+
+TEST_SUITE(TEST_BENCHMARK_SUITE) {
+	TEST_CASE("[SceneTree] Resolve a node path repeatedly") {
+		SceneTree *tree = SceneTree::get_singleton();
+
+		// Like a player script looking up its HUD every frame.
+		Node *level = memnew(Node);
+		level->set_name("Level");
+		Node *ui = memnew(Node);
+		ui->set_name("UI");
+		level->add_child(ui);
+		Node *panel = memnew(Node);
+		panel->set_name("Panel");
+		ui->add_child(panel);
+		Node *health_bar = memnew(Node);
+		health_bar->set_name("HealthBar");
+		panel->add_child(health_bar);
+		Node *world = memnew(Node);
+		world->set_name("World");
+		level->add_child(world);
+		Node *player = memnew(Node);
+		player->set_name("Player");
+		world->add_child(player);
+		tree->get_root()->add_child(level);
+
+		const NodePath path = NodePath("../../UI/Panel/HealthBar");
+
+		TestBenchmark::run("get_node ../../UI/Panel/HealthBar", [&]() {
+			TestBenchmark::do_not_optimize(player->get_node(path));
+		});
+
+		// Bullets spawned and freed in the world don't touch the UI branch the path descends into.
+		TestBenchmark::run("get_node ../../UI/Panel/HealthBar, world changed every lookup", [&]() {
+			Node *bullet = memnew(Node);
+			world->add_child(bullet);
+			TestBenchmark::do_not_optimize(player->get_node(path));
+			memdelete(bullet);
+		});
+
+		// Every lookup after a change below UI resolves the path again.
+		TestBenchmark::run("get_node ../../UI/Panel/HealthBar, UI changed every lookup", [&]() {
+			Node *label = memnew(Node);
+			panel->add_child(label);
+			TestBenchmark::do_not_optimize(player->get_node(path));
+			memdelete(label);
+		});
+
+		CHECK_EQ(player->get_node(path), health_bar);
+
+		memdelete(level);
+	}
+}
+
+} // namespace BenchmarkGetNode
@@ -0,0 +1,112 @@
+/**************************************************************************/
+/*  benchmark_node_children.cpp                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(benchmark_node_children)
+
+#include "core/variant/typed_array.h"
+#include "scene/main/node.h"
+#include "tests/test_benchmark.h"
+
+namespace BenchmarkNodeChildren {
+
+constexpr int CHILD_COUNT = 100000;
+
+TEST_SUITE(TEST_BENCHMARK_SUITE) {
+	TEST_CASE("[Node] Add 100k children to one parent") {
+		TestBenchmark::Options options;
+		options.warmup = 1;
+		options.repetitions = 3;
+
+		TestBenchmark::run(
+				"add_child 100k, unique names", [&]() {
+					Node *parent = memnew(Node);
+					for (int i = 0; i < CHILD_COUNT; i++) {
+						Node *child = memnew(Node);
+						child->set_name(itos(i));
+						parent->add_child(child);
+					}
+					memdelete(parent);
+				},
+				options);
+
+		TestBenchmark::run(
+				"add_child 100k, same name", [&]() {
+					Node *parent = memnew(Node);
+					for (int i = 0; i < CHILD_COUNT; i++) {
+						parent->add_child(memnew(Node));
+					}
+					memdelete(parent);
+				},
+				options);
+
+		// Every child asks for the same name, so each one used to scan all the suffixes taken before it.
+		TestBenchmark::run(
+				"add_child 100k, same name, readable", [&]() {
+					Node *parent = memnew(Node);
+					for (int i = 0; i < CHILD_COUNT; i++) {
+						parent->add_child(memnew(Node), true);
+					}
+					memdelete(parent);
+				},
+				options);
+
+		TestBenchmark::run(
+				"add_children 100k, same name, readable", [&]() {
+					Node *parent = memnew(Node);
+					TypedArray<Node> children;
+					children.resize(CHILD_COUNT);
+					for (int i = 0; i < CHILD_COUNT; i++) {
+						children[i] = memnew(Node);
+					}
+					parent->add_children(children, true);
+					memdelete(parent);
+				},
+				options);
+
+		Node *parent = memnew(Node);
+		for (int i = 0; i < CHILD_COUNT; i++) {
+			parent->add_child(memnew(Node), true);
+		}
+		CHECK_EQ(parent->get_child_count(), CHILD_COUNT);
+		CHECK_EQ(parent->get_child(CHILD_COUNT - 1)->get_name(), StringName("Node" + itos(CHILD_COUNT)));
+
+		int lookup = 0;
+		TestBenchmark::run("find_child by name among 100k children", [&]() {
+			lookup = (lookup + 7919) % CHILD_COUNT;
+			TestBenchmark::do_not_optimize(parent->find_child(lookup == 0 ? String("Node") : "Node" + itos(lookup + 1), false));
+		});
+
+		memdelete(parent);
+	}
+}
+
+} // namespace BenchmarkNodeChildren
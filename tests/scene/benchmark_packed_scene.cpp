@@ -0,0 +1,100 @@
+/**************************************************************************/
+/*  benchmark_packed_scene.cpp                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(benchmark_packed_scene)
+
+#include "scene/2d/node_2d.h"
+#include "scene/resources/packed_scene.h"
+#include "tests/test_benchmark.h"
+
+namespace BenchmarkPackedScene {
+
+// A small scene similar to a projectile: a root with a few children, stored properties, groups and a connection.
+static Ref<PackedScene> make_projectile_scene() {
+	Node2D *root = memnew(Node2D);
+	root->set_name("Projectile");
+	root->set_position(Vector2(4, 8));
+	root->add_to_group("projectiles", true);
+
+	for (int i = 0; i < 4; i++) {
+		Node2D *child = memnew(Node2D);
+		child->set_name(vformat("Part%d", i));
+		child->set_rotation(i * 0.25);
+		child->set_scale(Vector2(0.5, 0.5));
+		root->add_child(child);
+		child->set_owner(root);
+	}
+	root->get_child(0)->connect(SceneStringName(visibility_changed), Callable(root, "hide"), Object::CONNECT_PERSIST);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(root);
+	memdelete(root);
+	return packed_scene;
+}
+
+TEST_SUITE(TEST_BENCHMARK_SUITE) {
+	TEST_CASE("[SceneTree][PackedScene] Instantiate") {
+		Ref<PackedScene> packed_scene = make_projectile_scene();
+
+		TestBenchmark::run("PackedScene instantiate + free (5 nodes)", [&]() {
+			Node *instance = packed_scene->instantiate();
+			TestBenchmark::do_not_optimize(instance);
+			memdelete(instance);
+		});
+
+		packed_scene->set_instance_pool_size(1);
+		TestBenchmark::run("PackedScene instantiate + recycle, unchanged (5 nodes)", [&]() {
+			Node *instance = packed_scene->instantiate();
+			TestBenchmark::do_not_optimize(instance);
+			packed_scene->recycle_instance(instance);
+		});
+
+		TestBenchmark::run("PackedScene instantiate + recycle, moved (5 nodes)", [&]() {
+			Node2D *instance = Object::cast_to<Node2D>(packed_scene->instantiate());
+			instance->set_position(Vector2(100, 100));
+			TestBenchmark::do_not_optimize(instance);
+			packed_scene->recycle_instance(instance);
+		});
+
+		CHECK(packed_scene->get_pooled_instance_count() == 1);
+		packed_scene->clear_instance_pool();
+
+		Node2D *instance = Object::cast_to<Node2D>(packed_scene->instantiate());
+		REQUIRE(instance != nullptr);
+		CHECK(instance->get_position() == Vector2(4, 8));
+		CHECK(instance->get_child_count() == 4);
+		memdelete(instance);
+	}
+}
+
+} // namespace BenchmarkPackedScene
@@ -0,0 +1,83 @@
+/**************************************************************************/
+/*  benchmark_scene_tree_free.cpp                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(benchmark_scene_tree_free)
+
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
+#include "tests/test_benchmark.h"
+
+namespace BenchmarkSceneTreeFree {
+
+static Node *make_level(int p_rooms, int p_nodes_per_room) {
+	Node *level = memnew(Node);
+	for (int i = 0; i < p_rooms; i++) {
+		Node *room = memnew(Node);
+		level->add_child(room);
+		for (int j = 0; j < p_nodes_per_room; j++) {
+			room->add_child(memnew(Node));
+		}
+	}
+	return level;
+}
+
+TEST_SUITE(TEST_BENCHMARK_SUITE) {
+	TEST_CASE("[SceneTree] Free a level") {
+		SceneTree *tree = SceneTree::get_singleton();
+		const bool was_threaded = tree->is_threaded_node_free();
+
+		// Includes building the level, which overlaps with freeing the previous one on a thread.
+		TestBenchmark::Options options;
+		options.repetitions = 5;
+
+		tree->set_threaded_node_free(false);
+		TestBenchmark::run("Build and free a level of 20k nodes", [&]() {
+			Node *level = make_level(100, 200);
+			tree->get_root()->add_child(level);
+			level->queue_free();
+			tree->process(0);
+		}, options);
+
+		tree->set_threaded_node_free(true);
+		TestBenchmark::run("Build and free a level of 20k nodes, on a thread", [&]() {
+			Node *level = make_level(100, 200);
+			tree->get_root()->add_child(level);
+			level->queue_free();
+			tree->process(0);
+		}, options);
+		tree->wait_for_threaded_node_free();
+
+		tree->set_threaded_node_free(was_threaded);
+	}
+}
+
+} // namespace BenchmarkSceneTreeFree
@@ -0,0 +1,79 @@
+/**************************************************************************/
+/*  benchmark_scene_tree_groups.cpp                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(benchmark_scene_tree_groups)
+
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
+#include "tests/test_benchmark.h"
+
+namespace BenchmarkSceneTreeGroups {
+
+TEST_SUITE(TEST_BENCHMARK_SUITE) {
+	TEST_CASE("[SceneTree] Call a group of 10k nodes") {
+		SceneTree *tree = SceneTree::get_singleton();
+
+		// Half of the members live in sub-thread process groups, like enemies split into a few independent squads.
+		Node *root = memnew(Node);
+		LocalVector<Node *> members;
+		for (int squad = 0; squad < 8; squad++) {
+			Node *squad_node = memnew(Node);
+			if (squad % 2) {
+				squad_node->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+			}
+			root->add_child(squad_node);
+			for (int i = 0; i < 1250; i++) {
+				Node *member = memnew(Node);
+				member->add_to_group("enemies");
+				squad_node->add_child(member);
+				members.push_back(member);
+			}
+		}
+		tree->get_root()->add_child(root);
+
+		int priority = 0;
+		TestBenchmark::run("call_group 10k nodes", [&]() {
+			tree->call_group("enemies", "set_process_priority", ++priority);
+		});
+
+		TestBenchmark::run("call_group 10k nodes, threaded", [&]() {
+			tree->call_group_flags(SceneTree::GROUP_CALL_THREADED, "enemies", "set_process_priority", ++priority);
+		});
+
+		CHECK_EQ(members[0]->get_process_priority(), priority);
+		CHECK_EQ(members[members.size() - 1]->get_process_priority(), priority);
+
+		memdelete(root);
+	}
+}
+
+} // namespace BenchmarkSceneTreeGroups
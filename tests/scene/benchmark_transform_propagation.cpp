@@ -0,0 +1,136 @@
+/**************************************************************************/
+/*  benchmark_transform_propagation.cpp                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(benchmark_transform_propagation)
+
+#include "scene/2d/node_2d.h"
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
+#include "tests/test_benchmark.h"
+
+#ifndef _3D_DISABLED
+#include "scene/3d/node_3d.h"
+#endif // _3D_DISABLED
+
+namespace BenchmarkTransformPropagation {
+
+// Builds a hierarchy of 20 branches with 1000 nodes each, like a city or a few large vehicles, and returns its leaves.
+template <typename T>
+static T *make_hierarchy(LocalVector<T *> &r_leaves) {
+	T *root = memnew(T);
+	for (int branch = 0; branch < 20; branch++) {
+		T *branch_node = memnew(T);
+		root->add_child(branch_node);
+		for (int part = 0; part < 40; part++) {
+			T *part_node = memnew(T);
+			branch_node->add_child(part_node);
+			for (int leaf = 0; leaf < 24; leaf++) {
+				T *leaf_node = memnew(T);
+				leaf_node->set_notify_transform(true);
+				part_node->add_child(leaf_node);
+				r_leaves.push_back(leaf_node);
+			}
+		}
+	}
+	return root;
+}
+
+TEST_SUITE(TEST_BENCHMARK_SUITE) {
+#ifndef _3D_DISABLED
+	TEST_CASE("[SceneTree][Node3D] Propagate transforms of a 20k node hierarchy") {
+		SceneTree *tree = SceneTree::get_singleton();
+		const bool was_batching = tree->is_batching_transform_propagation();
+
+		LocalVector<Node3D *> leaves;
+		Node3D *root = make_hierarchy(leaves);
+		tree->get_root()->add_child(root);
+		real_t offset = 0;
+
+		// Moves the root a few times per frame, then sends the transform notifications, as a frame would.
+		auto move_root = [&]() {
+			for (int i = 0; i < 4; i++) {
+				offset += 1;
+				root->set_position(Vector3(offset, 0, 0));
+			}
+			tree->flush_transform_notifications();
+		};
+
+		tree->set_batch_transform_propagation(false);
+		TestBenchmark::run("Move Node3D root 4x + flush, immediate propagation", move_root);
+
+		tree->set_batch_transform_propagation(true);
+		TestBenchmark::run("Move Node3D root 4x + flush, batched propagation", move_root);
+
+		root->set_position(Vector3(-5, 0, 0));
+		tree->flush_transform_notifications();
+		CHECK(leaves[leaves.size() - 1]->get_global_position().is_equal_approx(Vector3(-5, 0, 0)));
+
+		memdelete(root);
+		tree->set_batch_transform_propagation(was_batching);
+	}
+#endif // _3D_DISABLED
+
+	TEST_CASE("[SceneTree][Node2D] Propagate transforms of a 20k node hierarchy") {
+		SceneTree *tree = SceneTree::get_singleton();
+		const bool was_batching = tree->is_batching_transform_propagation();
+
+		LocalVector<Node2D *> leaves;
+		Node2D *root = make_hierarchy(leaves);
+		tree->get_root()->add_child(root);
+		real_t offset = 0;
+
+		// Moves the root, then reads back the global transform of every leaf, as a frame of physics or drawing would.
+		auto move_root = [&]() {
+			offset += 1;
+			root->set_position(Vector2(offset, 0));
+			tree->flush_transform_notifications();
+			for (Node2D *leaf : leaves) {
+				TestBenchmark::do_not_optimize(leaf->get_global_transform());
+			}
+		};
+
+		tree->set_batch_transform_propagation(false);
+		TestBenchmark::run("Move Node2D root + read leaves, immediate propagation", move_root);
+
+		tree->set_batch_transform_propagation(true);
+		TestBenchmark::run("Move Node2D root + read leaves, batched propagation", move_root);
+
+		root->set_position(Vector2(-5, 0));
+		tree->flush_transform_notifications();
+		CHECK(leaves[leaves.size() - 1]->get_global_position().is_equal_approx(Vector2(-5, 0)));
+
+		memdelete(root);
+		tree->set_batch_transform_propagation(was_batching);
+	}
+}
+
+} // namespace BenchmarkTransformPropagation
@@ -32,7 +32,12 @@
 
 TEST_FORCE_LINK(test_animation_player)
 
+#include "core/config/project_settings.h"
+#include "scene/3d/node_3d.h"
+#include "scene/3d/visible_on_screen_notifier_3d.h"
 #include "scene/animation/animation_player.h"
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
 #include "scene/resources/animation.h"
 
 namespace TestAnimationPlayer {
@@ -62,4 +67,164 @@ TEST_CASE("[AnimationPlayer] get & set blend_time") {
 	memdelete(animation_player);
 }
 
+TEST_CASE("[SceneTree][AnimationPlayer] Transform tracks") {
+	Ref<Animation> animation;
+	animation.instantiate();
+	animation->set_length(1.0);
+	const int position_track = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(position_track, NodePath("Target"));
+	animation->position_track_insert_key(position_track, 0.0, Vector3());
+	animation->position_track_insert_key(position_track, 1.0, Vector3(0, 4, 0));
+	const int rotation_track = animation->add_track(Animation::TYPE_ROTATION_3D);
+	animation->track_set_path(rotation_track, NodePath("Target"));
+	animation->rotation_track_insert_key(rotation_track, 0.0, Quaternion());
+	animation->rotation_track_insert_key(rotation_track, 1.0, Quaternion(Vector3(0, 1, 0), Math::PI / 2));
+	const int scale_track = animation->add_track(Animation::TYPE_SCALE_3D);
+	animation->track_set_path(scale_track, NodePath("Target"));
+	animation->scale_track_insert_key(scale_track, 0.0, Vector3(1, 1, 1));
+	animation->scale_track_insert_key(scale_track, 1.0, Vector3(3, 3, 3));
+	Ref<AnimationLibrary> animation_library;
+	animation_library.instantiate();
+	animation_library->add_animation("move", animation);
+
+	Node *character = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(character);
+	Node3D *target = memnew(Node3D);
+	target->set_name("Target");
+	character->add_child(target);
+	AnimationPlayer *animation_player = memnew(AnimationPlayer);
+	character->add_child(animation_player);
+	animation_player->add_animation_library("", animation_library);
+	animation_player->play("move");
+
+	SceneTree::get_singleton()->process(0.5);
+	CHECK(target->get_position().is_equal_approx(Vector3(0, 2, 0)));
+	CHECK(target->get_quaternion().is_equal_approx(Quaternion(Vector3(0, 1, 0), Math::PI / 4)));
+	CHECK(target->get_scale().is_equal_approx(Vector3(2, 2, 2)));
+
+	// The pose is reset between frames rather than accumulated.
+	animation_player->seek(0.25, true);
+	CHECK(target->get_position().is_equal_approx(Vector3(0, 1, 0)));
+	CHECK(target->get_scale().is_equal_approx(Vector3(1.5, 1.5, 1.5)));
+
+	memdelete(character);
+}
+
+TEST_CASE("[SceneTree][AnimationPlayer] Level of detail") {
+	Ref<Animation> animation;
+	animation.instantiate();
+	animation->set_length(1.0);
+	for (const char *path : { "Target", "Other" }) {
+		const int track_index = animation->add_track(Animation::TYPE_POSITION_3D);
+		animation->track_set_path(track_index, NodePath(path));
+		animation->position_track_insert_key(track_index, 0.0, Vector3());
+		animation->position_track_insert_key(track_index, 1.0, Vector3(10, 0, 0));
+	}
+	Ref<AnimationLibrary> animation_library;
+	animation_library.instantiate();
+	animation_library->add_animation("move", animation);
+
+	Node *character = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(character);
+	Node3D *target = memnew(Node3D);
+	target->set_name("Target");
+	character->add_child(target);
+	Node3D *other = memnew(Node3D);
+	other->set_name("Other");
+	character->add_child(other);
+	AnimationPlayer *animation_player = memnew(AnimationPlayer);
+	character->add_child(animation_player);
+	animation_player->add_animation_library("", animation_library);
+	animation_player->set_lod_interpolate(false);
+	AnimationMixer::end_frame();
+
+	SUBCASE("Update interval") {
+		animation_player->set_lod_update_interval(2);
+		animation_player->play("move");
+
+		SceneTree::get_singleton()->process(0.25);
+		AnimationMixer::end_frame();
+		CHECK(target->get_position().is_equal_approx(Vector3(2.5, 0, 0)));
+		CHECK(AnimationMixer::get_frame_updated_count() == 1);
+		CHECK(AnimationMixer::get_frame_skipped_count() == 0);
+
+		SceneTree::get_singleton()->process(0.25);
+		AnimationMixer::end_frame();
+		CHECK(target->get_position().is_equal_approx(Vector3(2.5, 0, 0)));
+		CHECK(AnimationMixer::get_frame_updated_count() == 0);
+		CHECK(AnimationMixer::get_frame_skipped_count() == 1);
+
+		// The skipped time is caught up on the next update.
+		SceneTree::get_singleton()->process(0.25);
+		AnimationMixer::end_frame();
+		CHECK(target->get_position().is_equal_approx(Vector3(7.5, 0, 0)));
+	}
+
+	SUBCASE("Offscreen with culled tracks") {
+		VisibleOnScreenNotifier3D *notifier = memnew(VisibleOnScreenNotifier3D);
+		notifier->set_name("Notifier");
+		character->add_child(notifier);
+		animation_player->set_lod_source(NodePath("../Notifier"));
+		animation_player->set_lod_offscreen_update_interval(2);
+		TypedArray<NodePath> culled_tracks;
+		culled_tracks.push_back(NodePath("Target"));
+		animation_player->set_lod_culled_tracks(culled_tracks);
+		animation_player->play("move");
+
+		// Nothing is rendered, so the notifier is never on screen.
+		SceneTree::get_singleton()->process(0.25);
+		CHECK(other->get_position().is_equal_approx(Vector3(2.5, 0, 0)));
+		CHECK(target->get_position().is_equal_approx(Vector3(0, 0, 0)));
+
+		SceneTree::get_singleton()->process(0.25);
+		CHECK(other->get_position().is_equal_approx(Vector3(2.5, 0, 0)));
+	}
+
+	memdelete(character);
+}
+
+TEST_CASE("[SceneTree][AnimationPlayer] Threaded blending") {
+	ProjectSettings::get_singleton()->set_setting("animation/mixer/threaded_blending", true);
+
+	Ref<Animation> animation;
+	animation.instantiate();
+	animation->set_length(1.0);
+	const int track_index = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(track_index, NodePath("Target"));
+	animation->position_track_insert_key(track_index, 0.0, Vector3());
+	animation->position_track_insert_key(track_index, 1.0, Vector3(10, 0, 0));
+	Ref<AnimationLibrary> animation_library;
+	animation_library.instantiate();
+	animation_library->add_animation("move", animation);
+
+	Node *root = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+	LocalVector<Node3D *> targets;
+	for (int i = 0; i < 4; i++) {
+		Node *character = memnew(Node);
+		root->add_child(character);
+		Node3D *target = memnew(Node3D);
+		target->set_name("Target");
+		character->add_child(target);
+		AnimationPlayer *animation_player = memnew(AnimationPlayer);
+		character->add_child(animation_player);
+		animation_player->add_animation_library("", animation_library);
+		animation_player->play("move");
+		targets.push_back(target);
+	}
+
+	SceneTree::get_singleton()->process(0.5);
+	for (Node3D *target : targets) {
+		CHECK(target->get_position().is_equal_approx(Vector3(5, 0, 0)));
+	}
+
+	SceneTree::get_singleton()->process(0.25);
+	for (Node3D *target : targets) {
+		CHECK(target->get_position().is_equal_approx(Vector3(7.5, 0, 0)));
+	}
+
+	memdelete(root);
+	ProjectSettings::get_singleton()->set_setting("animation/mixer/threaded_blending", false);
+}
+
 } // namespace TestAnimationPlayer
@@ -34,6 +34,7 @@ TEST_FORCE_LINK(test_node)
 
 #include "core/io/file_access.h"
 #include "core/io/resource_saver.h"
+#include "core/object/callable_mp.h"
 #include "core/object/class_db.h"
 #include "scene/main/node.h"
 #include "scene/main/scene_tree.h"
@@ -525,6 +526,354 @@ TEST_CASE("[SceneTree][Node] Duplicating node with internal children") {
 	memdelete(dup);
 }
 
+TEST_CASE("[Node] Readable child names") {
+	Node *parent = memnew(Node);
+
+	SUBCASE("Repeated names get increasing suffixes") {
+		for (int i = 0; i < 4; i++) {
+			Node *child = memnew(Node);
+			child->set_name("Child");
+			parent->add_child(child, true);
+		}
+		CHECK_EQ(parent->get_child(0)->get_name(), StringName("Child"));
+		CHECK_EQ(parent->get_child(1)->get_name(), StringName("Child2"));
+		CHECK_EQ(parent->get_child(2)->get_name(), StringName("Child3"));
+		CHECK_EQ(parent->get_child(3)->get_name(), StringName("Child4"));
+	}
+
+	SUBCASE("Freed names are reused") {
+		for (int i = 0; i < 4; i++) {
+			Node *child = memnew(Node);
+			child->set_name("Child");
+			parent->add_child(child, true);
+		}
+
+		Node *removed = parent->get_child(1);
+		parent->remove_child(removed);
+		memdelete(removed);
+
+		Node *child = memnew(Node);
+		child->set_name("Child");
+		parent->add_child(child, true);
+		CHECK_EQ(child->get_name(), StringName("Child2"));
+
+		parent->get_child(0)->set_name("Renamed");
+		child = memnew(Node);
+		child->set_name("Child");
+		parent->add_child(child, true);
+		CHECK_EQ(child->get_name(), StringName("Child"));
+	}
+
+	SUBCASE("Renaming a child to a taken name keeps its own suffix") {
+		for (int i = 0; i < 3; i++) {
+			Node *child = memnew(Node);
+			child->set_name("Child");
+			parent->add_child(child, true);
+		}
+		Node *child = parent->get_child(1);
+		child->set_name("Child");
+		CHECK_EQ(child->get_name(), StringName("Child2"));
+	}
+
+	SUBCASE("Children can be found by name") {
+		Node *child = memnew(Node);
+		child->set_name("Child");
+		parent->add_child(child);
+		Node *grandchild = memnew(Node);
+		grandchild->set_name("Grandchild");
+		child->add_child(grandchild);
+
+		CHECK_EQ(parent->find_child("Child", false, false), child);
+		CHECK(parent->find_child("Child", false, true) == nullptr);
+		CHECK(parent->find_child("Grandchild", false, false) == nullptr);
+		CHECK_EQ(parent->find_child("Grandchild", true, false), grandchild);
+		CHECK_EQ(parent->find_child("Chi*", false, false), child);
+	}
+
+	memdelete(parent);
+}
+
+TEST_CASE("[Node] Adding children in bulk") {
+	Node *parent = memnew(Node);
+	Node *existing = memnew(Node);
+	existing->set_name("Child");
+	parent->add_child(existing);
+
+	TypedArray<Node> children;
+	for (int i = 0; i < 3; i++) {
+		Node *child = memnew(Node);
+		child->set_name("Child");
+		children.push_back(child);
+	}
+
+	SUBCASE("Names are validated like add_child") {
+		parent->add_children(children, true);
+
+		CHECK_EQ(parent->get_child_count(), 4);
+		CHECK_EQ(parent->get_child(1), Object::cast_to<Node>(children[0]));
+		CHECK_EQ(parent->get_child(1)->get_name(), StringName("Child2"));
+		CHECK_EQ(parent->get_child(2)->get_name(), StringName("Child3"));
+		CHECK_EQ(parent->get_child(3)->get_name(), StringName("Child4"));
+	}
+
+	SUBCASE("Nodes that already have a parent are skipped") {
+		Node *other_parent = memnew(Node);
+		other_parent->add_child(Object::cast_to<Node>(children[1]));
+
+		ERR_PRINT_OFF;
+		parent->add_children(children);
+		ERR_PRINT_ON;
+
+		CHECK_EQ(parent->get_child_count(), 3);
+		CHECK_EQ(Object::cast_to<Node>(children[1])->get_parent(), other_parent);
+		CHECK(parent->get_child(1)->get_name() != parent->get_child(2)->get_name());
+
+		memdelete(other_parent);
+	}
+
+	memdelete(parent);
+}
+
+TEST_CASE("[SceneTree][Node] Calling a group") {
+	GDREGISTER_CLASS(TestNode);
+	SceneTree *tree = SceneTree::get_singleton();
+
+	Node *target = memnew(Node);
+	tree->get_root()->add_child(target);
+
+	Node *main_thread_parent = memnew(Node);
+	tree->get_root()->add_child(main_thread_parent);
+	Node *sub_thread_parent = memnew(Node);
+	sub_thread_parent->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+	tree->get_root()->add_child(sub_thread_parent);
+
+	LocalVector<TestNode *> nodes;
+	for (int i = 0; i < 8; i++) {
+		TestNode *node = memnew(TestNode);
+		node->add_to_group("test_group");
+		(i % 2 ? sub_thread_parent : main_thread_parent)->add_child(node);
+		nodes.push_back(node);
+	}
+
+	SUBCASE("Immediate call") {
+		tree->call_group("test_group", "set_exported_node", target);
+		for (TestNode *node : nodes) {
+			CHECK_EQ(node->get_exported_node(), target);
+		}
+	}
+
+	SUBCASE("Threaded call") {
+		tree->call_group_flags(SceneTree::GROUP_CALL_THREADED, "test_group", "set_exported_node", target);
+		for (TestNode *node : nodes) {
+			CHECK_EQ(node->get_exported_node(), target);
+		}
+	}
+
+	SUBCASE("Missing methods are skipped") {
+		tree->call_group("test_group", "missing_method");
+		for (TestNode *node : nodes) {
+			CHECK(node->get_exported_node() == nullptr);
+		}
+	}
+
+	memdelete(main_thread_parent);
+	memdelete(sub_thread_parent);
+	memdelete(target);
+}
+
+TEST_CASE("[SceneTree][Node] Resolving node paths after the tree changes") {
+	Node *root = memnew(Node);
+	root->set_name("Root");
+	Node *ui = memnew(Node);
+	ui->set_name("UI");
+	root->add_child(ui);
+	Node *health_bar = memnew(Node);
+	health_bar->set_name("HealthBar");
+	ui->add_child(health_bar);
+	Node *player = memnew(Node);
+	player->set_name("Player");
+	root->add_child(player);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+
+	const NodePath path = NodePath("../UI/HealthBar");
+	CHECK_EQ(player->get_node_or_null(path), health_bar);
+	CHECK_EQ(player->get_node_or_null(path), health_bar);
+
+	SUBCASE("Renaming a node on the path") {
+		ui->set_name("HUD");
+		CHECK(player->get_node_or_null(path) == nullptr);
+		ui->set_name("UI");
+		CHECK_EQ(player->get_node_or_null(path), health_bar);
+	}
+
+	SUBCASE("Replacing the target") {
+		ui->remove_child(health_bar);
+		CHECK(player->get_node_or_null(path) == nullptr);
+
+		Node *new_health_bar = memnew(Node);
+		new_health_bar->set_name("HealthBar");
+		ui->add_child(new_health_bar);
+		CHECK_EQ(player->get_node_or_null(path), new_health_bar);
+
+		memdelete(health_bar);
+	}
+
+	SUBCASE("Moving the node resolving the path") {
+		root->remove_child(player);
+		ui->add_child(player);
+		CHECK(player->get_node_or_null(path) == nullptr);
+		CHECK_EQ(player->get_node_or_null(NodePath("../HealthBar")), health_bar);
+	}
+
+	SUBCASE("Moving the node resolving the path to a branch at the same depth") {
+		Node *other_root = memnew(Node);
+		other_root->set_name("OtherRoot");
+		Node *other_ui = memnew(Node);
+		other_ui->set_name("UI");
+		other_root->add_child(other_ui);
+		Node *other_health_bar = memnew(Node);
+		other_health_bar->set_name("HealthBar");
+		other_ui->add_child(other_health_bar);
+		SceneTree::get_singleton()->get_root()->add_child(other_root);
+
+		player->reparent(other_root);
+		CHECK_EQ(player->get_node_or_null(path), other_health_bar);
+
+		memdelete(other_root);
+	}
+
+	SUBCASE("Changes outside of the branch the path descends into") {
+		Node *sibling = memnew(Node);
+		sibling->set_name("Sibling");
+		root->add_child(sibling);
+		player->add_child(memnew(Node));
+		CHECK_EQ(player->get_node_or_null(path), health_bar);
+
+		Node *label = memnew(Node);
+		label->set_name("Label");
+		health_bar->add_child(label);
+		CHECK_EQ(player->get_node_or_null(NodePath("../UI/HealthBar/Label")), label);
+		memdelete(label);
+		CHECK(player->get_node_or_null(NodePath("../UI/HealthBar/Label")) == nullptr);
+	}
+
+	SUBCASE("Absolute paths") {
+		const NodePath absolute_path = NodePath("/root/Root/UI/HealthBar");
+		CHECK_EQ(player->get_node_or_null(absolute_path), health_bar);
+		health_bar->set_name("Bar");
+		CHECK(player->get_node_or_null(absolute_path) == nullptr);
+		health_bar->set_name("HealthBar");
+		CHECK_EQ(player->get_node_or_null(absolute_path), health_bar);
+	}
+
+	SUBCASE("Unique names") {
+		ui->set_owner(root);
+		health_bar->set_owner(root);
+		const NodePath unique_path = NodePath("%HealthBar");
+		CHECK(root->get_node_or_null(unique_path) == nullptr);
+		health_bar->set_unique_name_in_owner(true);
+		CHECK_EQ(root->get_node_or_null(unique_path), health_bar);
+		CHECK_EQ(player->get_node_or_null(NodePath("../%HealthBar")), health_bar);
+		health_bar->set_unique_name_in_owner(false);
+		CHECK(player->get_node_or_null(NodePath("../%HealthBar")) == nullptr);
+	}
+
+	memdelete(root);
+}
+
+TEST_CASE("[SceneTree][Node] Freeing nodes on a thread") {
+	SceneTree *tree = SceneTree::get_singleton();
+	const bool was_threaded = tree->is_threaded_node_free();
+	tree->set_threaded_node_free(true);
+
+	Node *level = memnew(Node);
+	level->set_name("Level");
+	tree->get_root()->add_child(level);
+
+	// Plain nodes can be freed on a thread, TestNode can't.
+	Node *enemies = memnew(TestNode);
+	enemies->set_name("Enemies");
+	level->add_child(enemies);
+	enemies->set_owner(level);
+
+	LocalVector<ObjectID> ids;
+	ids.push_back(enemies->get_instance_id());
+	for (int i = 0; i < 4; i++) {
+		Node *enemy = memnew(Node);
+		enemies->add_child(enemy);
+		enemy->set_owner(level);
+		ids.push_back(enemy->get_instance_id());
+		for (int j = 0; j < 4; j++) {
+			Node *part = i == 0 && j == 0 ? memnew(TestNode) : memnew(Node);
+			enemy->add_child(part);
+			part->set_owner(level);
+			ids.push_back(part->get_instance_id());
+		}
+	}
+
+	Node *boss = enemies->get_child(1);
+	boss->set_name("Boss");
+	boss->set_unique_name_in_owner(true);
+	CHECK_EQ(level->get_node_or_null(NodePath("%Boss")), boss);
+
+	SUBCASE("Mixed branch") {
+		enemies->queue_free();
+		tree->process(0);
+		CHECK_EQ(level->get_child_count(), 0);
+		CHECK(level->get_node_or_null(NodePath("%Boss")) == nullptr);
+
+		tree->wait_for_threaded_node_free();
+		for (const ObjectID &id : ids) {
+			CHECK(ObjectDB::get_instance(id) == nullptr);
+		}
+	}
+
+	SUBCASE("Branch made only of plain nodes") {
+		boss->queue_free();
+		tree->process(0);
+		// The branch may be freed at any time from now on.
+		CHECK_EQ(enemies->get_child_count(), 3);
+		CHECK(level->get_node_or_null(NodePath("%Boss")) == nullptr);
+
+		tree->wait_for_threaded_node_free();
+		for (uint32_t i = 6; i <= 10; i++) {
+			CHECK(ObjectDB::get_instance(ids[i]) == nullptr);
+		}
+		CHECK(ObjectDB::get_instance(ids[5]) != nullptr);
+	}
+
+	SUBCASE("Ancestor and descendant both queued") {
+		// Freeing the ancestor first detaches the plain branches, they must not be queued twice.
+		enemies->queue_free();
+		boss->queue_free();
+		boss->get_child(0)->queue_free();
+		tree->process(0);
+		CHECK_EQ(level->get_child_count(), 0);
+
+		tree->wait_for_threaded_node_free();
+		for (const ObjectID &id : ids) {
+			CHECK(ObjectDB::get_instance(id) == nullptr);
+		}
+	}
+
+	SUBCASE("Connected nodes are freed on the main thread") {
+		Node *listener = memnew(Node);
+		level->add_child(listener);
+		enemies->get_child(2)->connect(SNAME("renamed"), callable_mp(listener, &Node::queue_free));
+
+		enemies->queue_free();
+		tree->process(0);
+		tree->wait_for_threaded_node_free();
+		for (const ObjectID &id : ids) {
+			CHECK(ObjectDB::get_instance(id) == nullptr);
+		}
+		CHECK_FALSE(listener->has_any_connections());
+	}
+
+	memdelete(level);
+	tree->set_threaded_node_free(was_threaded);
+}
+
 TEST_CASE("[SceneTree][Node]Exported node checks") {
 	TestNode *node = memnew(TestNode);
 	SceneTree::get_singleton()->get_root()->add_child(node);
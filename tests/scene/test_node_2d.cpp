@@ -84,6 +84,65 @@ TEST_CASE("[SceneTree][Node2D]") {
 		memdelete(outer);
 		memdelete(main);
 	}
+
+	SUBCASE("[Node2D][Global Transform] Global Transform should be correct while transform propagation is batched.") {
+		SceneTree *tree = SceneTree::get_singleton();
+		const bool was_batching = tree->is_batching_transform_propagation();
+		tree->set_batch_transform_propagation(true);
+
+		Node2D *main = memnew(Node2D);
+		tree->get_root()->add_child(main);
+		LocalVector<Node2D *> grandchildren;
+		for (int i = 0; i < 256; i++) {
+			Node2D *child = memnew(Node2D);
+			child->set_position(Point2(i, 0));
+			main->add_child(child);
+			Node2D *grandchild = memnew(Node2D);
+			grandchild->set_position(Point2(0, 1));
+			child->add_child(grandchild);
+			grandchildren.push_back(grandchild);
+		}
+		CHECK_EQ(grandchildren[3]->get_global_position(), Point2(3, 1));
+
+		main->set_position(Point2(100, 100));
+		main->set_position(Point2(200, 200));
+		CHECK(tree->has_pending_transform_propagation());
+		// Reading the moved node itself doesn't need the branch to be updated.
+		CHECK_EQ(main->get_global_position(), Point2(200, 200));
+		CHECK(tree->has_pending_transform_propagation());
+		// Reading a descendant does.
+		CHECK_EQ(grandchildren[3]->get_global_position(), Point2(203, 201));
+		CHECK_FALSE(tree->has_pending_transform_propagation());
+
+		// Branches changed inside of another changed branch.
+		Node2D *child = Object::cast_to<Node2D>(grandchildren[5]->get_parent());
+		child->set_position(Point2(5, 10));
+		CHECK_EQ(child->get_global_position(), Point2(205, 210));
+		main->set_position(Point2(300, 300));
+		child->set_position(Point2(5, 20));
+		tree->flush_transform_notifications();
+		CHECK_EQ(grandchildren[5]->get_global_position(), Point2(305, 321));
+		child->set_position(Point2(5, 0));
+
+		main->set_position(Point2(300, 300));
+		tree->flush_transform_notifications();
+		CHECK_FALSE(tree->has_pending_transform_propagation());
+		for (uint32_t i = 0; i < grandchildren.size(); i++) {
+			CHECK_EQ(grandchildren[i]->get_global_position(), Point2(300 + i, 301));
+		}
+
+		// A queued branch whose own global transform was read before its parent moved.
+		child = Object::cast_to<Node2D>(grandchildren[7]->get_parent());
+		child->set_position(Point2(7, 10));
+		CHECK_EQ(child->get_global_position(), Point2(307, 310));
+		CHECK(tree->has_pending_transform_propagation());
+		main->set_position(Point2(400, 400));
+		CHECK_EQ(child->get_global_position(), Point2(407, 410));
+		CHECK_EQ(grandchildren[7]->get_global_position(), Point2(407, 411));
+
+		memdelete(main);
+		tree->set_batch_transform_propagation(was_batching);
+	}
 }
 
 TEST_CASE("[SceneTree][Node2D] Utility methods") {
@@ -0,0 +1,106 @@
+/**************************************************************************/
+/*  test_node_3d.cpp                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_node_3d)
+
+#include "scene/3d/node_3d.h"
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
+
+namespace TestNode3D {
+
+TEST_CASE("[SceneTree][Node3D] Global transform while transform propagation is batched") {
+	SceneTree *tree = SceneTree::get_singleton();
+	const bool was_batching = tree->is_batching_transform_propagation();
+	tree->set_batch_transform_propagation(true);
+
+	Node3D *main = memnew(Node3D);
+	tree->get_root()->add_child(main);
+	LocalVector<Node3D *> grandchildren;
+	for (int i = 0; i < 256; i++) {
+		Node3D *child = memnew(Node3D);
+		child->set_position(Vector3(i, 0, 0));
+		main->add_child(child);
+		Node3D *grandchild = memnew(Node3D);
+		grandchild->set_position(Vector3(0, 1, 0));
+		child->add_child(grandchild);
+		grandchildren.push_back(grandchild);
+	}
+	CHECK_EQ(grandchildren[3]->get_global_position(), Vector3(3, 1, 0));
+
+	SUBCASE("Reading below a moved branch updates it") {
+		main->set_position(Vector3(100, 0, 100));
+		main->set_position(Vector3(200, 0, 200));
+		CHECK(tree->has_pending_transform_propagation());
+		// Reading the moved node itself doesn't need the branch to be updated.
+		CHECK_EQ(main->get_global_position(), Vector3(200, 0, 200));
+		CHECK(tree->has_pending_transform_propagation());
+		CHECK_EQ(grandchildren[3]->get_global_position(), Vector3(203, 1, 200));
+		CHECK_FALSE(tree->has_pending_transform_propagation());
+	}
+
+	SUBCASE("Branches changed inside of another changed branch") {
+		Node3D *child = grandchildren[5]->get_parent_node_3d();
+		child->set_position(Vector3(5, 10, 0));
+		CHECK_EQ(child->get_global_position(), Vector3(5, 10, 0));
+		main->set_position(Vector3(300, 0, 0));
+		child->set_position(Vector3(5, 20, 0));
+		tree->flush_transform_notifications();
+		CHECK_FALSE(tree->has_pending_transform_propagation());
+		CHECK_EQ(grandchildren[5]->get_global_position(), Vector3(305, 21, 0));
+		for (uint32_t i = 0; i < grandchildren.size(); i++) {
+			if (i != 5) {
+				CHECK_EQ(grandchildren[i]->get_global_position(), Vector3(300 + i, 1, 0));
+			}
+		}
+	}
+
+	SUBCASE("Rotations are propagated") {
+		main->set_rotation(Vector3(0, Math::PI / 2, 0));
+		CHECK(grandchildren[2]->get_global_position().is_equal_approx(Vector3(0, 1, -2)));
+	}
+
+	SUBCASE("Top level nodes are not affected") {
+		Node3D *top_level = memnew(Node3D);
+		top_level->set_as_top_level(true);
+		top_level->set_position(Vector3(1, 2, 3));
+		main->add_child(top_level);
+		main->set_position(Vector3(50, 0, 0));
+		tree->flush_transform_notifications();
+		CHECK_EQ(top_level->get_global_position(), Vector3(1, 2, 3));
+	}
+
+	memdelete(main);
+	tree->set_batch_transform_propagation(was_batching);
+}
+
+} // namespace TestNode3D
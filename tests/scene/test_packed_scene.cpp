@@ -33,6 +33,7 @@
 TEST_FORCE_LINK(test_packed_scene)
 
 #include "core/object/callable_mp.h"
+#include "scene/2d/node_2d.h"
 #include "scene/resources/packed_scene.h"
 
 namespace TestPackedScene {
@@ -282,4 +283,102 @@ TEST_CASE("[PackedScene] Recreate State") {
 	memdelete(scene);
 }
 
+static Node2D *create_pooling_test_scene() {
+	Node2D *scene = memnew(Node2D);
+	scene->set_name("TestScene");
+	scene->set_position(Vector2(1, 2));
+	scene->add_to_group("enemies", true);
+
+	Node2D *child = memnew(Node2D);
+	child->set_name("Child");
+	child->set_rotation(0.5);
+	child->add_to_group("parts", true);
+	scene->add_child(child);
+	child->set_owner(scene);
+	child->set_unique_name_in_owner(true);
+
+	child->connect(SceneStringName(visibility_changed), Callable(scene, "hide"), Object::CONNECT_PERSIST);
+
+	return scene;
+}
+
+TEST_CASE("[SceneTree][PackedScene] Instantiate Packed Scene With Properties, Groups and Connections") {
+	Node2D *scene = create_pooling_test_scene();
+
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+
+	// Instantiate twice, to use the instantiation plan built by the first instantiation.
+	for (int i = 0; i < 2; i++) {
+		Node2D *instance = Object::cast_to<Node2D>(packed_scene.instantiate());
+		REQUIRE(instance != nullptr);
+		CHECK(instance->get_name() == "TestScene");
+		CHECK(instance->get_position() == Vector2(1, 2));
+		CHECK(instance->is_in_group("enemies"));
+
+		REQUIRE(instance->get_child_count() == 1);
+		Node2D *child = Object::cast_to<Node2D>(instance->get_child(0));
+		REQUIRE(child != nullptr);
+		CHECK(child->get_name() == "Child");
+		CHECK(child->get_rotation() == doctest::Approx(0.5));
+		CHECK(child->is_in_group("parts"));
+		CHECK(child->get_owner() == instance);
+		CHECK(child->is_unique_name_in_owner());
+		CHECK(child->is_connected(SceneStringName(visibility_changed), Callable(instance, "hide")));
+
+		memdelete(instance);
+	}
+
+	memdelete(scene);
+}
+
+TEST_CASE("[SceneTree][PackedScene] Recycle Instances") {
+	Node2D *scene = create_pooling_test_scene();
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+	packed_scene->set_instance_pool_size(1);
+	CHECK(packed_scene->get_instance_pool_size() == 1);
+
+	Node2D *instance = Object::cast_to<Node2D>(packed_scene->instantiate());
+	REQUIRE(instance != nullptr);
+	Node2D *child = Object::cast_to<Node2D>(instance->get_child(0));
+	REQUIRE(child != nullptr);
+
+	// Change both properties stored in the scene and properties left to their default.
+	instance->set_position(Vector2(10, 10));
+	child->set_rotation(2.0);
+	child->set_scale(Vector2(3, 3));
+
+	CHECK(packed_scene->recycle_instance(instance));
+	CHECK(packed_scene->get_pooled_instance_count() == 1);
+
+	Node2D *reused = Object::cast_to<Node2D>(packed_scene->instantiate());
+	CHECK_MESSAGE(reused == instance, "The recycled instance should be reused.");
+	CHECK(packed_scene->get_pooled_instance_count() == 0);
+	CHECK(reused->get_position() == Vector2(1, 2));
+	CHECK(child->get_rotation() == doctest::Approx(0.5));
+	CHECK(child->get_scale() == Vector2(1, 1));
+	CHECK(child->is_connected(SceneStringName(visibility_changed), Callable(reused, "hide")));
+
+	SUBCASE("Instances with a different node tree are freed") {
+		reused->add_child(memnew(Node));
+		CHECK_FALSE(packed_scene->recycle_instance(reused));
+		CHECK(packed_scene->get_pooled_instance_count() == 0);
+	}
+
+	SUBCASE("Instances are freed when the pool is full") {
+		Node *other = packed_scene->instantiate();
+		CHECK(packed_scene->recycle_instance(reused));
+		CHECK_FALSE(packed_scene->recycle_instance(other));
+		CHECK(packed_scene->get_pooled_instance_count() == 1);
+
+		packed_scene->set_instance_pool_size(0);
+		CHECK(packed_scene->get_pooled_instance_count() == 0);
+	}
+
+	memdelete(scene);
+}
+
 } // namespace TestPackedScene
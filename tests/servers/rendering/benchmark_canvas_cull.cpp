@@ -0,0 +1,90 @@
+/**************************************************************************/
+/*  benchmark_canvas_cull.cpp                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(benchmark_canvas_cull)
+
+#include "servers/rendering/renderer_canvas_cull.h"
+#include "servers/rendering/rendering_server_globals.h"
+#include "tests/test_benchmark.h"
+
+namespace BenchmarkCanvasCull {
+
+TEST_SUITE(TEST_BENCHMARK_SUITE) {
+	TEST_CASE("[SceneTree][CanvasCull] Cull 100k items") {
+		RendererCanvasCull *canvas_cull = RSG::canvas;
+		const int previous_min_children = canvas_cull->get_spatial_index_min_children();
+
+		RID canvas = canvas_cull->canvas_allocate();
+		canvas_cull->canvas_initialize(canvas);
+		RID root = canvas_cull->canvas_item_allocate();
+		canvas_cull->canvas_item_initialize(root);
+		canvas_cull->canvas_item_set_parent(root, canvas);
+
+		// A 400x250 grid of sprite-sized rects, roughly a tile-based world of which only a screen is visible.
+		LocalVector<RID> items;
+		for (int y = 0; y < 250; y++) {
+			for (int x = 0; x < 400; x++) {
+				RID item = canvas_cull->canvas_item_allocate();
+				canvas_cull->canvas_item_initialize(item);
+				canvas_cull->canvas_item_set_parent(item, root);
+				canvas_cull->canvas_item_set_transform(item, Transform2D(0, Vector2(x * 32, y * 32)));
+				canvas_cull->canvas_item_add_rect(item, Rect2(0, 0, 24, 24), Color(1, 1, 1), false);
+				items.push_back(item);
+			}
+		}
+
+		RendererCanvasCull::Canvas *canvas_ptr = canvas_cull->canvas_owner.get_or_null(canvas);
+		const Transform2D camera = Transform2D(0, Vector2(-4000, -3000));
+		const Rect2 clip_rect(0, 0, 1280, 720);
+
+		auto render = [&]() {
+			canvas_cull->render_canvas(RID(), canvas_ptr, camera, nullptr, nullptr, clip_rect, RSE::CANVAS_ITEM_TEXTURE_FILTER_LINEAR, RSE::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED, false, false, 0xffffffff);
+		};
+
+		// Both cull the same items, see test_canvas_cull.cpp.
+		canvas_cull->set_spatial_index_min_children(0);
+		TestBenchmark::run("Cull 100k canvas items, full walk", render);
+
+		canvas_cull->set_spatial_index_min_children(256);
+		TestBenchmark::run("Cull 100k canvas items, spatial index", render);
+
+		canvas_cull->set_spatial_index_min_children(previous_min_children);
+		// Free the parent first, so the children don't have to be erased from it one by one.
+		canvas_cull->free(root);
+		for (const RID &rid : items) {
+			canvas_cull->free(rid);
+		}
+		canvas_cull->free(canvas);
+	}
+}
+
+} // namespace BenchmarkCanvasCull
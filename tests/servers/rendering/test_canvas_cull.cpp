@@ -0,0 +1,112 @@
+/**************************************************************************/
+/*  test_canvas_cull.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_canvas_cull)
+
+#include "servers/rendering/renderer_canvas_cull.h"
+#include "servers/rendering/rendering_server_globals.h"
+
+namespace TestCanvasCull {
+
+TEST_CASE("[SceneTree][CanvasCull] Spatial index culls like the full walk") {
+	RendererCanvasCull *canvas_cull = RSG::canvas;
+	const int previous_min_children = canvas_cull->get_spatial_index_min_children();
+
+	RID canvas = canvas_cull->canvas_allocate();
+	canvas_cull->canvas_initialize(canvas);
+	RID root = canvas_cull->canvas_item_allocate();
+	canvas_cull->canvas_item_initialize(root);
+	canvas_cull->canvas_item_set_parent(root, canvas);
+
+	LocalVector<RID> items;
+	for (int y = 0; y < 40; y++) {
+		for (int x = 0; x < 60; x++) {
+			RID item = canvas_cull->canvas_item_allocate();
+			canvas_cull->canvas_item_initialize(item);
+			canvas_cull->canvas_item_set_parent(item, root);
+			canvas_cull->canvas_item_set_transform(item, Transform2D(0, Vector2(x * 32, y * 32)));
+			canvas_cull->canvas_item_add_rect(item, Rect2(0, 0, 24, 24), Color(1, 1, 1), false);
+			items.push_back(item);
+		}
+	}
+
+	RendererCanvasCull::Canvas *canvas_ptr = canvas_cull->canvas_owner.get_or_null(canvas);
+
+	// Returns the items that were attached for drawing.
+	auto render_drawn_items = [&](const Transform2D &p_camera, const Rect2 &p_clip_rect) {
+		for (const RID &rid : items) {
+			canvas_cull->canvas_item_owner.get_or_null(rid)->z_final = RSE::CANVAS_ITEM_Z_MIN - 1;
+		}
+		canvas_cull->render_canvas(RID(), canvas_ptr, p_camera, nullptr, nullptr, p_clip_rect, RSE::CANVAS_ITEM_TEXTURE_FILTER_LINEAR, RSE::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED, false, false, 0xffffffff);
+		Vector<RID> drawn;
+		for (const RID &rid : items) {
+			if (canvas_cull->canvas_item_owner.get_or_null(rid)->z_final != RSE::CANVAS_ITEM_Z_MIN - 1) {
+				drawn.push_back(rid);
+			}
+		}
+		return drawn;
+	};
+
+	auto check_same_items = [&](const Transform2D &p_camera, const Rect2 &p_clip_rect) {
+		canvas_cull->set_spatial_index_min_children(0);
+		const Vector<RID> drawn_walk = render_drawn_items(p_camera, p_clip_rect);
+		canvas_cull->set_spatial_index_min_children(16);
+		const Vector<RID> drawn_index = render_drawn_items(p_camera, p_clip_rect);
+
+		CHECK(drawn_walk.size() > 0);
+		CHECK(drawn_walk.size() < (int)items.size());
+		CHECK(drawn_walk == drawn_index);
+	};
+
+	SUBCASE("Clip rect at the origin") {
+		check_same_items(Transform2D(0, Vector2(-500, -300)), Rect2(0, 0, 640, 360));
+	}
+
+	SUBCASE("Clip rect away from the origin") {
+		// As with split screen viewports, global rects are offset by the clip rect position before being tested.
+		check_same_items(Transform2D(0, Vector2(-500, -300)), Rect2(200, 100, 640, 360));
+		check_same_items(Transform2D(0, Vector2(-500, -300)), Rect2(-150, -80, 320, 200));
+	}
+
+	SUBCASE("Rotated and scaled camera") {
+		check_same_items(Transform2D(0.3, Size2(1.5, 1.5), 0, Vector2(-700, -200)), Rect2(50, 30, 640, 360));
+	}
+
+	canvas_cull->set_spatial_index_min_children(previous_min_children);
+	canvas_cull->free(root);
+	for (const RID &rid : items) {
+		canvas_cull->free(rid);
+	}
+	canvas_cull->free(canvas);
+}
+
+} // namespace TestCanvasCull
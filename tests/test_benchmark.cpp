@@ -0,0 +1,139 @@
+/**************************************************************************/
+/*  test_benchmark.cpp                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_benchmark.h"
+
+#include "core/io/file_access.h"
+#include "core/io/json.h"
+#include "core/variant/array.h"
+#include "core/variant/dictionary.h"
+
+namespace TestBenchmark {
+
+static bool enabled = false;
+static String output_file;
+static LocalVector<Result> results;
+
+bool is_enabled() {
+	return enabled;
+}
+
+void set_enabled(bool p_enabled) {
+	enabled = p_enabled;
+}
+
+void set_output_file(const String &p_path) {
+	output_file = p_path;
+}
+
+Result make_result(const String &p_name, uint64_t p_iterations, LocalVector<double> &p_samples) {
+	Result result;
+	result.name = p_name;
+	result.iterations = p_iterations;
+	result.repetitions = p_samples.size();
+	if (p_samples.is_empty()) {
+		return result;
+	}
+
+	p_samples.sort();
+	const uint32_t count = p_samples.size();
+	result.min = p_samples[0];
+	result.max = p_samples[count - 1];
+	result.median = (count % 2) ? p_samples[count / 2] : (p_samples[count / 2 - 1] + p_samples[count / 2]) * 0.5;
+
+	double sum = 0.0;
+	for (const double sample : p_samples) {
+		sum += sample;
+	}
+	result.mean = sum / count;
+
+	double variance = 0.0;
+	for (const double sample : p_samples) {
+		variance += (sample - result.mean) * (sample - result.mean);
+	}
+	result.stddev = count > 1 ? Math::sqrt(variance / (count - 1)) : 0.0;
+
+	return result;
+}
+
+static String _format_time(double p_nsec) {
+	if (p_nsec >= 1e6) {
+		return String::num(p_nsec / 1e6, 3) + " ms";
+	}
+	if (p_nsec >= 1e3) {
+		return String::num(p_nsec / 1e3, 3) + " us";
+	}
+	return String::num(p_nsec, 2) + " ns";
+}
+
+void report(const Result &p_result) {
+	results.push_back(p_result);
+
+	const double deviation = p_result.mean > 0.0 ? p_result.stddev / p_result.mean * 100.0 : 0.0;
+	print_line(vformat("%s: %s/op (min %s, max %s, ±%s%%) [%d iterations x %d]",
+			p_result.name.rpad(48),
+			_format_time(p_result.median),
+			_format_time(p_result.min),
+			_format_time(p_result.max),
+			String::num(deviation, 1),
+			p_result.iterations,
+			p_result.repetitions));
+}
+
+Error write_output_file() {
+	if (output_file.is_empty()) {
+		return OK;
+	}
+
+	Array benchmarks;
+	for (const Result &result : results) {
+		Dictionary entry;
+		entry["name"] = result.name;
+		entry["iterations"] = result.iterations;
+		entry["repetitions"] = result.repetitions;
+		entry["min_ns"] = result.min;
+		entry["max_ns"] = result.max;
+		entry["mean_ns"] = result.mean;
+		entry["median_ns"] = result.median;
+		entry["stddev_ns"] = result.stddev;
+		benchmarks.push_back(entry);
+	}
+
+	Dictionary root;
+	root["benchmarks"] = benchmarks;
+
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(output_file, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, vformat("Cannot write benchmark results to '%s'.", output_file));
+	f->store_string(JSON::stringify(root, "\t", false));
+	return OK;
+}
+
+} // namespace TestBenchmark
@@ -0,0 +1,122 @@
+/**************************************************************************/
+/*  test_benchmark.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/os/os.h"
+#include "core/string/ustring.h"
+#include "core/templates/local_vector.h"
+
+// Microbenchmarks are regular doctest cases placed in the `TEST_BENCHMARK_SUITE` test suite.
+// They are excluded from regular test runs and only run with `--test --benchmark`.
+// Results are printed to the console, and written as JSON with `--benchmark-file <path>`.
+#define TEST_BENCHMARK_SUITE "[Benchmark]"
+
+namespace TestBenchmark {
+
+struct Options {
+	// Repetitions run before measuring, to warm up caches and allocators.
+	uint32_t warmup = 2;
+	// Measured repetitions the statistics are computed from.
+	uint32_t repetitions = 10;
+	// The number of iterations per repetition is scaled so that one repetition takes at least this long.
+	uint64_t min_repetition_usec = 20000;
+};
+
+struct Result {
+	String name;
+	uint64_t iterations = 0; // Per repetition.
+	uint32_t repetitions = 0;
+	// Time per iteration, in nanoseconds.
+	double min = 0.0;
+	double max = 0.0;
+	double mean = 0.0;
+	double median = 0.0;
+	double stddev = 0.0;
+};
+
+bool is_enabled();
+void set_enabled(bool p_enabled);
+void set_output_file(const String &p_path);
+Error write_output_file();
+
+Result make_result(const String &p_name, uint64_t p_iterations, LocalVector<double> &p_samples);
+void report(const Result &p_result);
+
+// Prevents the compiler from optimizing away a computation whose result is otherwise unused.
+template <typename T>
+_FORCE_INLINE_ void do_not_optimize(const T &p_value) {
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "r,m"(p_value) : "memory");
+#else
+	const volatile char *ptr = reinterpret_cast<const volatile char *>(&p_value);
+	(void)*ptr;
+#endif
+}
+
+template <typename F>
+_FORCE_INLINE_ uint64_t _run_iterations(F &p_func, uint64_t p_iterations) {
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (uint64_t i = 0; i < p_iterations; i++) {
+		p_func();
+	}
+	return OS::get_singleton()->get_ticks_usec() - begin;
+}
+
+// Measures `p_func`, reports the result and returns it.
+template <typename F>
+Result run(const String &p_name, F p_func, const Options &p_options = Options()) {
+	// Calibrate the number of iterations so that the timer resolution is negligible.
+	uint64_t iterations = 1;
+	while (iterations < (1u << 30)) {
+		const uint64_t elapsed = _run_iterations(p_func, iterations);
+		if (elapsed >= p_options.min_repetition_usec) {
+			break;
+		}
+		iterations *= 2;
+	}
+
+	for (uint32_t i = 0; i < p_options.warmup; i++) {
+		_run_iterations(p_func, iterations);
+	}
+
+	LocalVector<double> samples;
+	samples.reserve(p_options.repetitions);
+	for (uint32_t i = 0; i < p_options.repetitions; i++) {
+		const uint64_t elapsed = _run_iterations(p_func, iterations);
+		samples.push_back(elapsed * 1000.0 / iterations);
+	}
+
+	const Result result = make_result(p_name, iterations, samples);
+	report(result);
+	return result;
+}
+
+} // namespace TestBenchmark
@@ -46,6 +46,7 @@
 #include "tests/display_server_mock.h"
 #include "tests/force_link.gen.h"
 #include "tests/signal_watcher.h"
+#include "tests/test_benchmark.h"
 #include "tests/test_macros.h"
 #include "tests/test_utils.h"
 
@@ -114,10 +115,14 @@ int test_main(int argc, char *argv[]) {
 	doctest::Context test_context;
 	LocalVector<String> test_args;
 
-	// Clean arguments of "--test" from the args.
+	// Clean arguments of "--test" and benchmark options from the args.
 	for (int x = 0; x < argc; x++) {
 		String arg = String(argv[x]);
-		if (arg != "--test") {
+		if (arg == "--benchmark") {
+			TestBenchmark::set_enabled(true);
+		} else if (arg == "--benchmark-file" && x + 1 < argc) {
+			TestBenchmark::set_output_file(String::utf8(argv[++x]));
+		} else if (arg != "--test") {
 			test_args.push_back(arg);
 		}
 	}
@@ -143,7 +148,18 @@ int test_main(int argc, char *argv[]) {
 		delete[] doctest_args;
 	}
 
-	return test_context.run();
+	// Benchmarks are slow, so they are only run when explicitly requested, and then exclusively.
+	if (TestBenchmark::is_enabled()) {
+		test_context.addFilter("test-suite", "*" TEST_BENCHMARK_SUITE "*");
+	} else {
+		test_context.addFilter("test-suite-exclude", "*" TEST_BENCHMARK_SUITE "*");
+	}
+
+	const int status = test_context.run();
+	if (TestBenchmark::is_enabled()) {
+		TestBenchmark::write_output_file();
+	}
+	return status;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////